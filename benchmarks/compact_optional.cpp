@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstdint>
+#include <cstdio>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/utility.hpp>
+
+/* Fill n optionals (every third one empty) and sum the engaged values */
+template<class Optional>
+void scan(const std::string& name, std::size_t n)
+{
+    using T = typename Optional::value_type;
+
+    std::vector<Optional> values(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        if (i % 3 != 0) {
+            values[i] = static_cast<T>(i);
+        }
+    }
+
+    std::printf("%-48s %14zu bytes (%zu per element)\n",
+                (name + " footprint n=" + std::to_string(n)).c_str(),
+                n * sizeof(Optional), sizeof(Optional));
+
+    const std::size_t iterations = (std::size_t{1} << 27) / n;
+    const double ns = bench::run(name + " scan n=" + std::to_string(n),
+                                 iterations, [&] {
+        T sum{};
+        for (const auto& v: values) {
+            if (v.has_value()) {
+                sum += *v;
+            }
+        }
+        bench::do_not_optimize(sum);
+    });
+    std::printf("%-48s %14.2f GB/s\n", "", n * sizeof(Optional) / ns);
+}
+
+int main()
+{
+    for (std::size_t n: {1u << 12, 1u << 16, 1u << 24}) {
+        scan<std::optional<std::uint64_t>>("std::optional<uint64_t>", n);
+        scan<utility::compact_optional<std::uint64_t>>(
+            "compact_optional<uint64_t>", n);
+        scan<std::optional<double>>("std::optional<double>", n);
+        scan<utility::compact_optional<double>>("compact_optional<double>", n);
+    }
+}
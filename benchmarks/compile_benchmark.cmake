@@ -0,0 +1,45 @@
+# Copyright (c) Nuno Alves de Sousa 2019
+#
+# Use, modification and distribution is subject to the Boost Software License,
+# Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+#
+# Compile time benchmark: compiles SOURCE with -DUSE_STD (the standard library
+# counterpart) and without (this library), REPETITIONS times each, and prints
+# the fastest wall time and the size of the object file.
+#
+# Usage: cmake -DCOMPILER=<c++> -DFLAGS=<flags> -DSOURCE=<file>
+#              -DOUTPUT=<object> [-DREPETITIONS=<n>] -P compile_benchmark.cmake
+cmake_minimum_required(VERSION 3.23) # Microseconds in string(TIMESTAMP)
+
+if(NOT REPETITIONS)
+    set(REPETITIONS 3)
+endif()
+separate_arguments(FLAGS UNIX_COMMAND "${FLAGS}")
+get_filename_component(NAME ${SOURCE} NAME_WE)
+
+foreach(variant std library)
+    if(variant STREQUAL std)
+        set(defines -DUSE_STD)
+    else()
+        set(defines)
+    endif()
+
+    set(best "")
+    foreach(i RANGE 1 ${REPETITIONS})
+        string(TIMESTAMP start "%s%f")
+        execute_process(
+            COMMAND ${COMPILER} ${FLAGS} ${defines} -c ${SOURCE} -o ${OUTPUT}
+            RESULT_VARIABLE result)
+        string(TIMESTAMP stop "%s%f")
+        if(NOT result EQUAL 0)
+            message(FATAL_ERROR "Compiling ${SOURCE} (${variant}) failed")
+        endif()
+        math(EXPR elapsed "(${stop} - ${start}) / 1000")
+        if(best STREQUAL "" OR elapsed LESS best)
+            set(best ${elapsed})
+        endif()
+    endforeach()
+    file(SIZE ${OUTPUT} size)
+    message("${NAME} ${variant}: ${best} ms, object ${size} bytes")
+endforeach()
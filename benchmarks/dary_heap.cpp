@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/containers.hpp>
+
+namespace
+{
+constexpr std::size_t elements = 1 << 18;
+
+std::vector<int> random_values()
+{
+    std::mt19937 rng{42};
+    std::vector<int> values(elements);
+    for (auto& value: values) {
+        value = static_cast<int>(rng());
+    }
+    return values;
+}
+
+// Push every value, then pop them all
+template<class Heap>
+void push_pop(const std::string& name, const std::vector<int>& values)
+{
+    bench::run(name, 10, [&] {
+        Heap heap;
+        for (int value: values) {
+            heap.push(value);
+        }
+        long long sum = 0;
+        while (!heap.empty()) {
+            sum += heap.top();
+            heap.pop();
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+
+template<std::size_t D>
+void push_pop_dary(const std::vector<int>& values)
+{
+    push_pop<containers::dary_heap<int, D>>(
+        "dary_heap<int, " + std::to_string(D) + "> push/pop", values);
+}
+
+/* --- Dijkstra --- */
+struct edge
+{
+    std::size_t to;
+    int weight;
+};
+
+using graph = std::vector<std::vector<edge>>;
+
+graph random_graph(std::size_t vertices, std::size_t degree)
+{
+    std::mt19937 rng{7};
+    std::uniform_int_distribution<std::size_t> vertex{0, vertices - 1};
+    std::uniform_int_distribution<int> weight{1, 1000};
+    graph g(vertices);
+    for (auto& edges: g) {
+        for (std::size_t i = 0; i < degree; ++i) {
+            edges.push_back(edge{vertex(rng), weight(rng)});
+        }
+    }
+    return g;
+}
+
+constexpr int infinity = std::numeric_limits<int>::max();
+
+// Lazy deletion: a vertex is pushed again whenever its distance decreases
+std::vector<int> dijkstra_priority_queue(const graph& g)
+{
+    using item = std::pair<int, std::size_t>;
+    std::vector<int> distance(g.size(), infinity);
+    std::priority_queue<item, std::vector<item>, std::greater<item>> queue;
+    distance[0] = 0;
+    queue.push({0, 0});
+    while (!queue.empty()) {
+        const auto [d, u] = queue.top();
+        queue.pop();
+        if (d > distance[u]) {
+            continue;
+        }
+        for (const edge& e: g[u]) {
+            if (d + e.weight < distance[e.to]) {
+                distance[e.to] = d + e.weight;
+                queue.push({distance[e.to], e.to});
+            }
+        }
+    }
+    return distance;
+}
+
+template<std::size_t D>
+std::vector<int> dijkstra_indexed(const graph& g)
+{
+    std::vector<int> distance(g.size(), infinity);
+    containers::indexed_dary_heap<int, D, std::greater<int>> queue(g.size());
+    distance[0] = 0;
+    queue.push(0, 0);
+    while (!queue.empty()) {
+        const std::size_t u = queue.top_key();
+        const int d = queue.top();
+        queue.pop();
+        for (const edge& e: g[u]) {
+            if (d + e.weight < distance[e.to]) {
+                distance[e.to] = d + e.weight;
+                queue.update(e.to, distance[e.to]);
+            }
+        }
+    }
+    return distance;
+}
+
+template<std::size_t D>
+void dijkstra(const graph& g)
+{
+    bench::run("indexed_dary_heap<int, " + std::to_string(D) + "> Dijkstra",
+               10, [&] {
+        auto distance = dijkstra_indexed<D>(g);
+        bench::do_not_optimize(distance);
+    });
+}
+
+} // namespace
+
+int main()
+{
+    const std::vector<int> values = random_values();
+    push_pop<std::priority_queue<int>>("std::priority_queue push/pop",
+                                       values);
+    push_pop_dary<2>(values);
+    push_pop_dary<4>(values);
+    push_pop_dary<8>(values);
+    push_pop_dary<16>(values);
+
+    bench::run("dary_heap<int> build", 10, [&] {
+        containers::dary_heap<int> heap(values.begin(), values.end());
+        bench::do_not_optimize(heap);
+    });
+    bench::run("std::priority_queue build", 10, [&] {
+        std::priority_queue<int> heap(values.begin(), values.end());
+        bench::do_not_optimize(heap);
+    });
+
+    const graph g = random_graph(elements, 8);
+    bench::run("std::priority_queue Dijkstra", 10, [&] {
+        auto distance = dijkstra_priority_queue(g);
+        bench::do_not_optimize(distance);
+    });
+    dijkstra<2>(g);
+    dijkstra<4>(g);
+    dijkstra<8>(g);
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/numeric.hpp>
+
+/* Count heap allocations to expose the temporaries of eager evaluation */
+namespace
+{
+std::size_t allocations = 0;
+std::size_t allocated_bytes = 0;
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    allocated_bytes += size;
+    if (void* p = std::malloc(size)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+/* Eager evaluation: every operator returns a new vector */
+namespace eager
+{
+template<class T>
+std::vector<T> operator+(const std::vector<T>& l, const std::vector<T>& r)
+{
+    std::vector<T> result(l.size());
+    for (std::size_t i = 0; i < l.size(); ++i) {
+        result[i] = l[i] + r[i];
+    }
+    return result;
+}
+
+template<class T>
+std::vector<T> operator*(const std::vector<T>& l, const std::vector<T>& r)
+{
+    std::vector<T> result(l.size());
+    for (std::size_t i = 0; i < l.size(); ++i) {
+        result[i] = l[i] * r[i];
+    }
+    return result;
+}
+
+} // namespace eager
+
+template<class T>
+void run_expression(const std::string& type, std::size_t n)
+{
+    using eager::operator+;
+    using eager::operator*;
+
+    const std::size_t iterations = (std::size_t{1} << 26) / n;
+    const std::string label = type + " a = b*c + d*e n=" + std::to_string(n);
+
+    std::vector<T> vb(n, T(1)), vc(n, T(2)), vd(n, T(3)), ve(n, T(4)), va(n);
+    numeric::array<T> b(n, T(1)), c(n, T(2)), d(n, T(3)), e(n, T(4)), a(n);
+
+    // Elements read and written per evaluation: eager runs three loops of two
+    // reads and one write each; the fused loop reads four arrays, writes one
+    const double eager_bytes = 9. * n * sizeof(T);
+    const double fused_bytes = 5. * n * sizeof(T);
+
+    allocations = allocated_bytes = 0;
+    const double eager_ns = bench::run(label + " eager", iterations, [&] {
+        va = vb * vc + vd * ve;
+        bench::clobber_memory();
+    });
+    const double eager_allocations =
+        static_cast<double>(allocations) / (iterations + 1);
+    const double eager_allocated =
+        static_cast<double>(allocated_bytes) / (iterations + 1);
+
+    allocations = allocated_bytes = 0;
+    const double fused_ns = bench::run(label + " fused", iterations, [&] {
+        a = b * c + d * e;
+        bench::clobber_memory();
+    });
+    const double fused_allocations =
+        static_cast<double>(allocations) / (iterations + 1);
+    const double fused_allocated =
+        static_cast<double>(allocated_bytes) / (iterations + 1);
+
+    std::printf("  eager: %5.1f allocations, %12.0f bytes allocated, "
+                "%12.0f bytes touched, %6.2f GB/s\n",
+                eager_allocations, eager_allocated, eager_bytes,
+                eager_bytes / eager_ns);
+    std::printf("  fused: %5.1f allocations, %12.0f bytes allocated, "
+                "%12.0f bytes touched, %6.2f GB/s\n",
+                fused_allocations, fused_allocated, fused_bytes,
+                fused_bytes / fused_ns);
+}
+
+int main()
+{
+    for (std::size_t n: {1u << 10, 1u << 16, 1u << 22}) {
+        run_expression<float>("float", n);
+        run_expression<double>("double", n);
+    }
+}
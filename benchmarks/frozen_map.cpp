@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Dispatch on 40 protocol keywords: std::unordered_map<std::string, int> built
+ * at startup, a chain of ifs, and a constexpr containers::frozen_map and
+ * utility::string_switch.
+ */
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/containers.hpp>
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+#define KEYWORDS \
+    "append", "auth", "bgsave", "bitcount", "blpop", "brpop", "client", \
+    "config", "dbsize", "decr", "decrby", "del", "echo", "exists", "expire", \
+    "flushall", "get", "getrange", "getset", "hdel", "hget", "hgetall", \
+    "hset", "incr", "incrby", "info", "keys", "lindex", "llen", "lpop", \
+    "lpush", "mget", "mset", "ping", "publish", "rename", "rpop", "rpush", \
+    "sadd", "set"
+
+constexpr std::string_view keywords[] = {KEYWORDS};
+constexpr std::size_t keyword_count = std::size(keywords);
+
+template<std::size_t... Is>
+constexpr auto make_map(std::index_sequence<Is...>)
+{
+    const std::pair<std::string_view, int> elements[] = {
+        {keywords[Is], static_cast<int>(Is)}...};
+    return containers::make_frozen_map(elements);
+}
+
+constexpr auto frozen = make_map(std::make_index_sequence<keyword_count>{});
+constexpr auto command = utility::make_string_switch({KEYWORDS});
+
+std::unordered_map<std::string, int> make_unordered()
+{
+    std::unordered_map<std::string, int> map;
+    for (std::size_t i = 0; i < keyword_count; ++i) {
+        map.emplace(std::string(keywords[i]), static_cast<int>(i));
+    }
+    return map;
+}
+
+int if_chain(std::string_view s)
+{
+    for (std::size_t i = 0; i < keyword_count; ++i) {
+        if (s == keywords[i]) {
+            return static_cast<int>(i);
+        }
+    }
+    return -1;
+}
+
+} // namespace
+
+int main()
+{
+    // Mostly known keywords, with one unknown in eight
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<std::size_t> pick{0, keyword_count - 1};
+    std::vector<std::string> requests;
+    for (std::size_t i = 0; i < 4096; ++i) {
+        requests.push_back(i % 8 == 7 ? "unknown" + std::to_string(i)
+                                      : std::string(keywords[pick(rng)]));
+    }
+
+    bench::run("startup: build unordered_map", 20000, [] {
+        auto map = make_unordered();
+        bench::do_not_optimize(map);
+    });
+    bench::run("startup: frozen_map (constant)", 20000, [] {
+        auto size = frozen.size();
+        bench::do_not_optimize(size);
+    });
+
+    const auto unordered = make_unordered();
+    const std::size_t iterations = 2000;
+    bench::run("lookup x4096: std::unordered_map", iterations, [&] {
+        long sum = 0;
+        for (const auto& r: requests) {
+            auto it = unordered.find(r);
+            sum += it == unordered.end() ? -1 : it->second;
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::run("lookup x4096: if chain", iterations, [&] {
+        long sum = 0;
+        for (const auto& r: requests) {
+            sum += if_chain(r);
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::run("lookup x4096: frozen_map", iterations, [&] {
+        long sum = 0;
+        for (const auto& r: requests) {
+            auto it = frozen.find(r);
+            sum += it == frozen.end() ? -1 : it->second;
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::run("lookup x4096: string_switch", iterations, [&] {
+        long sum = 0;
+        for (const auto& r: requests) {
+            sum += static_cast<long>(command(r));
+        }
+        bench::do_not_optimize(sum);
+    });
+}
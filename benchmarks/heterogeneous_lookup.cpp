@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <new>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/containers.hpp>
+
+/* --- Allocation counting --- */
+namespace
+{
+std::size_t allocations = 0;
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    ++allocations;
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+constexpr std::size_t keys = 10000;
+
+// Keys longer than the small string buffer, so that constructing a
+// std::string from a lookup key allocates
+std::vector<std::string> make_keys()
+{
+    std::vector<std::string> result;
+    for (std::size_t i = 0; i < keys; ++i) {
+        result.push_back("instrument/exchange/" + std::to_string(i * 7919));
+    }
+    return result;
+}
+
+// Look up every key through a std::string_view, and print the time and the
+// allocations per lookup
+template<class Map, class Find>
+void lookups(const std::string& name, const std::vector<std::string>& words,
+             Find find)
+{
+    Map map;
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        map.emplace(words[i], static_cast<int>(i));
+    }
+    std::vector<std::string_view> views(words.begin(), words.end());
+
+    const auto lookup_all = [&] {
+        int sum = 0;
+        for (std::string_view view: views) {
+            sum += find(map, view);
+        }
+        bench::do_not_optimize(sum);
+    };
+    const double ns = bench::run(name, 100, lookup_all);
+
+    const std::size_t before = allocations;
+    lookup_all();
+    const double per_lookup = static_cast<double>(allocations - before) /
+                              static_cast<double>(views.size());
+    std::printf("    %.2f ns and %.2f allocations per lookup\n",
+                ns / static_cast<double>(views.size()), per_lookup);
+}
+
+} // namespace
+
+int main()
+{
+    const std::vector<std::string> words = make_keys();
+
+    // Without transparent comparisons, every lookup constructs a key
+    lookups<std::map<std::string, int>>(
+        "std::map<std::string, int>", words,
+        [](const auto& map, std::string_view key) {
+            return map.find(std::string(key))->second;
+        });
+    lookups<std::unordered_map<std::string, int>>(
+        "std::unordered_map<std::string, int>", words,
+        [](const auto& map, std::string_view key) {
+            return map.find(std::string(key))->second;
+        });
+
+    const auto find = [](const auto& map, std::string_view key) {
+        return map.find(key)->second;
+    };
+    lookups<containers::flat_map<std::string, int>>(
+        "flat_map<std::string, int>", words, find);
+    lookups<containers::btree_map<std::string, int>>(
+        "btree_map<std::string, int>", words, find);
+    lookups<containers::hash_map<std::string, int>>(
+        "hash_map<std::string, int>", words, find);
+}
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Micro-benchmark harness shared by the runtime benchmarks. bench::run pins
+ * the process to one CPU, warms up, splits the iterations in repetitions and
+ * reports the median time per iteration with its spread. It is configured by
+ * environment variables:
+ *  - BENCH_CPU: CPU to pin the process to, -1 to not pin it (default: the CPU
+ *    on which the first benchmark starts)
+ *  - BENCH_REPETITIONS: number of repetitions (default: 5)
+ *  - BENCH_WARMUP_MS: minimum warm-up time, in milliseconds (default: 20)
+ *  - BENCH_COUNTERS: 1 to also report the cycles, instructions, branch misses
+ *    and cache misses per iteration, read with perf_event_open (Linux only)
+ */
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bench
+{
+/// Prevent the compiler from optimizing away the computation of value
+template<class T>
+inline void do_not_optimize(T& value)
+{
+    asm volatile("" : "+m"(value) : : "memory");
+}
+
+/// Prevent the compiler from reordering memory accesses across this point
+inline void clobber_memory()
+{
+    asm volatile("" : : : "memory");
+}
+
+namespace detail
+{
+/// Value of the environment variable name, or fallback if it is not set
+inline long environment(const char* name, long fallback)
+{
+    const char* value = std::getenv(name);
+    return value != nullptr && *value != '\0' ? std::atol(value) : fallback;
+}
+
+/// Hardware counters of the benchmark thread, summed over its lifetime
+class counters
+{
+public:
+    static constexpr std::size_t count = 4;
+
+    /// Names of the counters, in the order of read()
+    static const char* name(std::size_t i)
+    {
+        static const char* const names[count] =
+            {"cycles", "instructions", "branch-misses", "cache-misses"};
+        return names[i];
+    }
+
+#if defined(__linux__)
+    counters()
+    {
+        const std::uint64_t configs[count] = {
+            PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES};
+        for (std::size_t i = 0; i < count; ++i) {
+            perf_event_attr attr{};
+            attr.size = sizeof(attr);
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.config = configs[i];
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            const int fd = static_cast<int>(
+                syscall(SYS_perf_event_open, &attr, 0, -1, leader_, 0));
+            if (fd < 0) {
+                close_all();
+                return;
+            }
+            (i == 0 ? leader_ : others_[i - 1]) = fd;
+        }
+        ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+
+    ~counters() { close_all(); }
+
+    bool available() const noexcept { return leader_ >= 0; }
+
+    /// Current values of the counters
+    std::vector<double> read() const
+    {
+        struct
+        {
+            std::uint64_t n;
+            std::uint64_t values[count];
+        } group{};
+        if (::read(leader_, &group, sizeof(group)) !=
+            static_cast<ssize_t>(sizeof(group))) {
+            return std::vector<double>(count, 0.0);
+        }
+        return std::vector<double>(group.values, group.values + count);
+    }
+
+private:
+    void close_all()
+    {
+        for (int& fd: others_) {
+            if (fd >= 0) {
+                close(fd);
+                fd = -1;
+            }
+        }
+        if (leader_ >= 0) {
+            close(leader_);
+            leader_ = -1;
+        }
+    }
+
+    int leader_ = -1;
+    int others_[count - 1] = {-1, -1, -1};
+#else
+    bool available() const noexcept { return false; }
+
+    std::vector<double> read() const { return std::vector<double>(count); }
+#endif
+};
+
+/// Settings read from the environment once, on the first benchmark
+struct settings
+{
+    std::size_t repetitions;
+    std::chrono::milliseconds warmup;
+    counters* hardware;
+};
+
+inline const settings& setup()
+{
+    static const settings result = [] {
+#if defined(__linux__)
+        const long cpu = environment("BENCH_CPU", sched_getcpu());
+        if (cpu >= 0) {
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            CPU_SET(static_cast<int>(cpu), &set);
+            if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+                std::printf("(could not pin to CPU %ld)\n", cpu);
+            }
+        }
+#endif
+        counters* hardware = nullptr;
+        if (environment("BENCH_COUNTERS", 0) != 0) {
+            static counters instance;
+            hardware = &instance;
+            if (!instance.available()) {
+                std::printf("(hardware counters are not available)\n");
+                hardware = nullptr;
+            }
+        }
+        return settings{static_cast<std::size_t>(std::max(
+                            1L, environment("BENCH_REPETITIONS", 5))),
+                        std::chrono::milliseconds(
+                            environment("BENCH_WARMUP_MS", 20)),
+                        hardware};
+    }();
+    return result;
+}
+
+} // namespace detail
+
+/**
+ * Run f about iterations times, split in repetitions, after a warm-up. Print
+ * the median time per iteration and the spread of the repetitions, and the
+ * hardware counters per iteration when they are enabled.
+ * @return The median time per iteration, in nanoseconds
+ */
+template<class F>
+double run(const std::string& name, std::size_t iterations, F&& f)
+{
+    using clock = std::chrono::steady_clock;
+    const detail::settings& settings = detail::setup();
+
+    // Warm up caches, branch predictors and the CPU frequency
+    const auto warmup_end = clock::now() + settings.warmup;
+    do {
+        f();
+    } while (clock::now() < warmup_end);
+
+    const std::size_t repetitions =
+        std::min(settings.repetitions, std::max<std::size_t>(iterations, 1));
+    const std::size_t per_repetition =
+        (std::max<std::size_t>(iterations, 1) + repetitions - 1) /
+        repetitions;
+
+    std::vector<double> times;
+    std::vector<double> before;
+    if (settings.hardware != nullptr) {
+        before = settings.hardware->read();
+    }
+    for (std::size_t r = 0; r < repetitions; ++r) {
+        const auto start = clock::now();
+        for (std::size_t i = 0; i < per_repetition; ++i) {
+            f();
+        }
+        const auto stop = clock::now();
+        times.push_back(
+            std::chrono::duration<double, std::nano>(stop - start).count() /
+            static_cast<double>(per_repetition));
+    }
+
+    std::vector<double> sorted = times;
+    std::sort(sorted.begin(), sorted.end());
+    const double median = sorted.size() % 2 == 1
+        ? sorted[sorted.size() / 2]
+        : (sorted[sorted.size() / 2 - 1] + sorted[sorted.size() / 2]) / 2;
+    double mean = 0;
+    for (double t: times) {
+        mean += t / static_cast<double>(times.size());
+    }
+    double variance = 0;
+    for (double t: times) {
+        variance += (t - mean) * (t - mean) / static_cast<double>(times.size());
+    }
+
+    std::printf("%-48s %14.2f ns  (min %.2f, +-%.1f%%, %zux%zu)\n",
+                name.c_str(), median, sorted.front(),
+                mean > 0 ? 100 * std::sqrt(variance) / mean : 0.0,
+                repetitions, per_repetition);
+    if (settings.hardware != nullptr) {
+        const std::vector<double> after = settings.hardware->read();
+        const double total =
+            static_cast<double>(repetitions * per_repetition);
+        std::printf("   ");
+        for (std::size_t i = 0; i < detail::counters::count; ++i) {
+            std::printf(" %s %.1f", detail::counters::name(i),
+                        (after[i] - before[i]) / total);
+        }
+        std::printf("\n");
+    }
+    return median;
+}
+
+} // namespace bench
+
+#endif //BENCHMARK_H
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/detail/functional/invoke.hpp>
+
+namespace
+{
+struct Widget
+{
+    long value;
+
+    long get(long i) const { return value + i; }
+};
+
+long twice(long i)
+{
+    return 2 * i;
+}
+
+std::vector<Widget> make_widgets(std::size_t n)
+{
+    std::vector<Widget> widgets(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        widgets[i].value = static_cast<long>(i);
+    }
+    return widgets;
+}
+
+/**
+ * Time the same call made directly, through std::invoke and through
+ * functional::invoke. Each call maps a widget to a long, summed over n widgets.
+ */
+template<class Direct, class Std, class Functional>
+void compare(const std::string& name, const std::vector<Widget>& widgets,
+             Direct direct, Std std_invoke, Functional functional_invoke)
+{
+    const std::size_t iterations = (std::size_t{1} << 26) / widgets.size();
+    auto sum_with = [&](auto call) {
+        return [&widgets, call] {
+            long sum = 0;
+            for (const auto& w: widgets) {
+                sum += call(w);
+            }
+            bench::do_not_optimize(sum);
+        };
+    };
+
+    bench::run("direct " + name, iterations, sum_with(direct));
+    bench::run("std::invoke " + name, iterations, sum_with(std_invoke));
+    bench::run("functional::invoke " + name, iterations,
+               sum_with(functional_invoke));
+}
+
+} // namespace
+
+int main()
+{
+    const auto widgets = make_widgets(1 << 12);
+
+    // Opaque to the optimizer, so the calls through it stay indirect
+    long (*function_pointer)(long) = twice;
+    long (Widget::*pmf)(long) const = &Widget::get;
+    long Widget::*pmd = &Widget::value;
+    bench::do_not_optimize(function_pointer);
+    bench::do_not_optimize(pmf);
+    bench::do_not_optimize(pmd);
+
+    compare("function pointer", widgets,
+        [=](const Widget& w) { return function_pointer(w.value); },
+        [=](const Widget& w) { return std::invoke(function_pointer, w.value); },
+        [=](const Widget& w) {
+            return functional::invoke(function_pointer, w.value);
+        });
+
+    const long k = 3;
+    auto lambda = [k](long i) { return k * i; };
+    compare("lambda", widgets,
+        [=](const Widget& w) { return lambda(w.value); },
+        [=](const Widget& w) { return std::invoke(lambda, w.value); },
+        [=](const Widget& w) { return functional::invoke(lambda, w.value); });
+
+    compare("member function, object", widgets,
+        [=](const Widget& w) { return (w.*pmf)(1); },
+        [=](const Widget& w) { return std::invoke(pmf, w, 1); },
+        [=](const Widget& w) { return functional::invoke(pmf, w, 1); });
+
+    compare("member function, pointer", widgets,
+        [=](const Widget& w) { return ((&w)->*pmf)(1); },
+        [=](const Widget& w) { return std::invoke(pmf, &w, 1); },
+        [=](const Widget& w) { return functional::invoke(pmf, &w, 1); });
+
+    compare("member function, std::cref", widgets,
+        [=](const Widget& w) { return (std::cref(w).get().*pmf)(1); },
+        [=](const Widget& w) { return std::invoke(pmf, std::cref(w), 1); },
+        [=](const Widget& w) {
+            return functional::invoke(pmf, std::cref(w), 1);
+        });
+
+    compare("member data, object", widgets,
+        [=](const Widget& w) { return w.*pmd; },
+        [=](const Widget& w) { return std::invoke(pmd, w); },
+        [=](const Widget& w) { return functional::invoke(pmd, w); });
+
+    compare("member data, pointer", widgets,
+        [=](const Widget& w) { return (&w)->*pmd; },
+        [=](const Widget& w) { return std::invoke(pmd, &w); },
+        [=](const Widget& w) { return functional::invoke(pmd, &w); });
+
+    compare("member data, std::cref", widgets,
+        [=](const Widget& w) { return std::cref(w).get().*pmd; },
+        [=](const Widget& w) { return std::invoke(pmd, std::cref(w)); },
+        [=](const Widget& w) { return functional::invoke(pmd, std::cref(w)); });
+}
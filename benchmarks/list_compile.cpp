@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Compile time probe: at, index_of, contains, filter, partition, unique and
+ * sort_by over a list of LIST_SIZE types, half of them repeated, with the
+ * algorithms of traits::list or, if USE_STD is defined, with the recursive
+ * implementations which the standard library leaves to its users to write.
+ * Built by the bench_list_compile_<size> targets.
+ */
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/type_traits.hpp>
+
+#ifndef LIST_SIZE
+#define LIST_SIZE 100
+#endif
+
+using traits::list;
+
+#ifdef USE_STD
+namespace recursive
+{
+template<class L, std::size_t I>
+struct at;
+
+template<class T, class... Ts>
+struct at<list<T, Ts...>, 0> { using type = T; };
+
+template<class T, class... Ts, std::size_t I>
+struct at<list<T, Ts...>, I>: at<list<Ts...>, I - 1> { };
+
+template<class L, std::size_t I>
+using at_t = typename at<L, I>::type;
+
+template<class L, class T>
+struct index_of: std::integral_constant<std::size_t, 0> { };
+
+template<class... Ts, class T>
+struct index_of<list<T, Ts...>, T>: std::integral_constant<std::size_t, 0> { };
+
+template<class U, class... Ts, class T>
+struct index_of<list<U, Ts...>, T>
+    : std::integral_constant<std::size_t,
+                             1 + index_of<list<Ts...>, T>::value>
+{ };
+
+template<class L, class T>
+constexpr std::size_t index_of_v = index_of<L, T>::value;
+
+template<class L, class T>
+struct contains: std::false_type { };
+
+template<class U, class... Ts, class T>
+struct contains<list<U, Ts...>, T>
+    : std::bool_constant<std::is_same_v<U, T> ||
+                         contains<list<Ts...>, T>::value>
+{ };
+
+template<class L, class T>
+constexpr bool contains_v = contains<L, T>::value;
+
+template<class T, class L>
+struct push_front;
+
+template<class T, class... Ts>
+struct push_front<T, list<Ts...>> { using type = list<T, Ts...>; };
+
+template<class L, template<class> class Pred>
+struct filter { using type = list<>; };
+
+template<class T, class... Ts, template<class> class Pred>
+struct filter<list<T, Ts...>, Pred>
+{
+    using rest = typename filter<list<Ts...>, Pred>::type;
+    using type = std::conditional_t<Pred<T>::value,
+                                    typename push_front<T, rest>::type, rest>;
+};
+
+template<class L, template<class> class Pred>
+using filter_t = typename filter<L, Pred>::type;
+
+template<template<class> class Pred>
+struct negation
+{
+    template<class T>
+    using type = std::bool_constant<!Pred<T>::value>;
+};
+
+template<class L, template<class> class Pred>
+struct partition
+{
+    using selected = filter_t<L, Pred>;
+    using rejected = filter_t<L, negation<Pred>::template type>;
+};
+
+template<class L, class Seen = list<>>
+struct unique { using type = Seen; };
+
+template<class T, class... Ts, class... Seen>
+struct unique<list<T, Ts...>, list<Seen...>>
+    : unique<list<Ts...>,
+             std::conditional_t<(std::is_same_v<T, Seen> || ...),
+                                list<Seen...>, list<Seen..., T>>>
+{ };
+
+template<class L>
+using unique_t = typename unique<L>::type;
+
+// Top-down merge sort: an insertion sort does not compile 1000 types
+template<class L, class R, template<class> class Key, class Out = list<>>
+struct merge;
+
+template<class... Ls, template<class> class Key, class... Os>
+struct merge<list<Ls...>, list<>, Key, list<Os...>>
+{
+    using type = list<Os..., Ls...>;
+};
+
+template<class R, class... Rs, template<class> class Key, class... Os>
+struct merge<list<>, list<R, Rs...>, Key, list<Os...>>
+{
+    using type = list<Os..., R, Rs...>;
+};
+
+template<class L, class... Ls, class R, class... Rs,
+         template<class> class Key, class... Os>
+struct merge<list<L, Ls...>, list<R, Rs...>, Key, list<Os...>>
+    : std::conditional_t<(Key<R>::value < Key<L>::value),
+                         merge<list<L, Ls...>, list<Rs...>, Key,
+                               list<Os..., R>>,
+                         merge<list<Ls...>, list<R, Rs...>, Key,
+                               list<Os..., L>>>
+{ };
+
+template<class L, std::size_t N, class Front = list<>, bool = N == 0>
+struct split;
+
+template<class Back, std::size_t N, class Front>
+struct split<Back, N, Front, true>
+{
+    using front = Front;
+    using back = Back;
+};
+
+template<class T, class... Ts, std::size_t N, class... Fs>
+struct split<list<T, Ts...>, N, list<Fs...>, false>
+    : split<list<Ts...>, N - 1, list<Fs..., T>>
+{ };
+
+template<class L, template<class> class Key>
+struct sort_by
+{
+    using halves = split<L, L::size / 2>;
+    using type = typename merge<
+        typename sort_by<typename halves::front, Key>::type,
+        typename sort_by<typename halves::back, Key>::type, Key>::type;
+};
+
+template<template<class> class Key>
+struct sort_by<list<>, Key> { using type = list<>; };
+
+template<class T, template<class> class Key>
+struct sort_by<list<T>, Key> { using type = list<T>; };
+
+template<class L, template<class> class Key>
+using sort_by_t = typename sort_by<L, Key>::type;
+
+} // namespace recursive
+
+namespace lib = recursive;
+#else
+namespace lib = traits;
+#endif
+
+template<std::size_t I>
+struct item
+{
+    char data[I % 13 + 1];
+};
+
+template<class T>
+struct size_of: std::integral_constant<std::size_t, sizeof(T)> { };
+
+template<class T>
+struct odd_size: std::bool_constant<sizeof(T) % 2 == 1> { };
+
+template<class Is>
+struct make_list;
+
+template<std::size_t... Is>
+struct make_list<std::index_sequence<Is...>>
+{
+    using type = list<item<Is % (LIST_SIZE / 2)>...>;
+};
+
+using L = make_list<std::make_index_sequence<LIST_SIZE>>::type;
+
+using last = lib::at_t<L, LIST_SIZE - 1>;
+constexpr std::size_t index = lib::index_of_v<L, item<LIST_SIZE / 2 - 1>>;
+constexpr bool found = lib::contains_v<L, item<LIST_SIZE / 2 - 1>>;
+using odd = lib::filter_t<L, odd_size>;
+using parts = lib::partition<L, odd_size>;
+using distinct = lib::unique_t<L>;
+using sorted = lib::sort_by_t<L, size_of>;
+
+static_assert(std::is_same_v<last, item<LIST_SIZE / 2 - 1>>);
+static_assert(index == LIST_SIZE / 2 - 1 && found);
+static_assert(std::is_same_v<odd, parts::selected>);
+static_assert(distinct::size == LIST_SIZE / 2);
+static_assert(sorted::size == LIST_SIZE &&
+              sizeof(lib::at_t<sorted, 0>) == 1 &&
+              sizeof(lib::at_t<sorted, LIST_SIZE - 1>) == 13);
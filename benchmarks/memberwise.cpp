@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+// Unique object representations: == is a memcmp and the hash is bulk
+struct Key
+{
+    std::uint32_t a;
+    std::uint32_t b;
+    std::uint32_t c;
+    std::uint32_t d;
+    std::uint64_t e;
+};
+
+// Padding and a floating point field: every operation is memberwise
+struct Sample
+{
+    char tag;
+    double value;
+    std::int32_t x;
+    std::int32_t y;
+};
+
+std::size_t combine(std::size_t seed, std::size_t hash)
+{
+    return seed ^ (hash + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+}
+
+/* --- Handwritten operations --- */
+bool equal(const Key& l, const Key& r)
+{
+    return l.a == r.a && l.b == r.b && l.c == r.c && l.d == r.d && l.e == r.e;
+}
+
+bool equal(const Sample& l, const Sample& r)
+{
+    return l.tag == r.tag && l.value == r.value && l.x == r.x && l.y == r.y;
+}
+
+std::size_t hash(const Key& k)
+{
+    std::size_t seed = 0;
+    seed = combine(seed, std::hash<std::uint32_t>{}(k.a));
+    seed = combine(seed, std::hash<std::uint32_t>{}(k.b));
+    seed = combine(seed, std::hash<std::uint32_t>{}(k.c));
+    seed = combine(seed, std::hash<std::uint32_t>{}(k.d));
+    return combine(seed, std::hash<std::uint64_t>{}(k.e));
+}
+
+std::size_t hash(const Sample& s)
+{
+    std::size_t seed = 0;
+    seed = combine(seed, std::hash<char>{}(s.tag));
+    seed = combine(seed, std::hash<double>{}(s.value));
+    seed = combine(seed, std::hash<std::int32_t>{}(s.x));
+    return combine(seed, std::hash<std::int32_t>{}(s.y));
+}
+
+template<class T>
+unsigned char* write(const T& field, unsigned char* out)
+{
+    std::memcpy(out, &field, sizeof(T));
+    return out + sizeof(T);
+}
+
+unsigned char* serialize(const Key& k, unsigned char* out)
+{
+    return write(k.e, write(k.d, write(k.c, write(k.b, write(k.a, out)))));
+}
+
+unsigned char* serialize(const Sample& s, unsigned char* out)
+{
+    return write(s.y, write(s.x, write(s.value, write(s.tag, out))));
+}
+
+Key make(std::mt19937& rng, Key*)
+{
+    // Few distinct values, so that half of the comparisons are equal
+    const auto v = rng() % 2;
+    return {1, 2, 3, static_cast<std::uint32_t>(v), 5};
+}
+
+Sample make(std::mt19937& rng, Sample*)
+{
+    const auto v = static_cast<std::int32_t>(rng() % 2);
+    return {'s', 1.5, 3, v};
+}
+
+template<class T>
+void compare(const std::string& name, std::size_t n)
+{
+    std::mt19937 rng{42};
+    std::vector<T> values;
+    for (std::size_t i = 0; i < n + 1; ++i) {
+        values.push_back(make(rng, static_cast<T*>(nullptr)));
+    }
+    std::vector<unsigned char> buffer(n * sizeof(T));
+    const std::size_t iterations = (std::size_t{1} << 24) / n;
+    const std::string suffix = " " + name + " n=" + std::to_string(n);
+
+    bench::run("handwritten ==" + suffix, iterations, [&] {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            count += equal(values[i], values[i + 1]);
+        }
+        bench::do_not_optimize(count);
+    });
+    bench::run("memberwise_equal" + suffix, iterations, [&] {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            count += utility::memberwise_equal(values[i], values[i + 1]);
+        }
+        bench::do_not_optimize(count);
+    });
+
+    bench::run("handwritten hash" + suffix, iterations, [&] {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += hash(values[i]);
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::run("memberwise_hash" + suffix, iterations, [&] {
+        std::size_t sum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += utility::memberwise_hash(values[i]);
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    bench::run("handwritten serialize" + suffix, iterations, [&] {
+        unsigned char* out = buffer.data();
+        for (std::size_t i = 0; i < n; ++i) {
+            out = serialize(values[i], out);
+        }
+        bench::clobber_memory();
+    });
+    bench::run("utility::serialize" + suffix, iterations, [&] {
+        unsigned char* out = buffer.data();
+        for (std::size_t i = 0; i < n; ++i) {
+            out = utility::serialize(values[i], out);
+        }
+        bench::clobber_memory();
+    });
+}
+
+} // namespace
+
+int main()
+{
+    constexpr std::size_t n = 1 << 12;
+    compare<Key>("Key", n);
+    compare<Sample>("Sample", n);
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Latency of functional::memoize on hits and on misses, against calling an
+ * expensive pure function directly, and throughput of sharded_memoize shared
+ * by several threads.
+ */
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/functional.hpp>
+
+namespace
+{
+// A pure function of a few hundred nanoseconds
+struct Expensive
+{
+    std::uint64_t operator()(int x) const
+    {
+        std::uint64_t h = static_cast<std::uint64_t>(x);
+        for (int i = 0; i < 256; ++i) {
+            h = h * 6364136223846793005u + 1442695040888963407u;
+            h ^= h >> 29;
+        }
+        return h;
+    }
+};
+
+constexpr std::size_t calls = 1024;
+
+} // namespace
+
+int main()
+{
+    // Hits: 256 distinct arguments, all of which fit in the cache
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<int> pick{0, 255};
+    std::vector<int> hot;
+    for (std::size_t i = 0; i < calls; ++i) {
+        hot.push_back(pick(rng));
+    }
+
+    const std::size_t iterations = 2000;
+    bench::run("x1024: direct call", iterations, [&] {
+        std::uint64_t sum = 0;
+        for (int x: hot) {
+            sum += Expensive{}(x);
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    functional::memoize<Expensive, 512, int> memo{Expensive{}};
+    bench::run("x1024: memoize hit", iterations, [&] {
+        std::uint64_t sum = 0;
+        for (int x: hot) {
+            sum += memo(x);
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    // Misses: every argument is new, so each call evicts an entry
+    int next = 0;
+    bench::run("x1024: memoize miss", iterations, [&] {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < calls; ++i) {
+            sum += memo(next++);
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    functional::sharded_memoize<Expensive, 512, 16, int> sharded{Expensive{}};
+    bench::run("x1024: sharded_memoize hit, 1 thread", iterations, [&] {
+        std::uint64_t sum = 0;
+        for (int x: hot) {
+            sum += sharded(x);
+        }
+        bench::do_not_optimize(sum);
+    });
+
+    // Each of 4 threads makes 1024 * 64 calls, mostly hits
+    bench::run("x1024x64: sharded_memoize, 4 threads", 50, [&] {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&sharded, &hot] {
+                std::uint64_t sum = 0;
+                for (int r = 0; r < 64; ++r) {
+                    for (int x: hot) {
+                        sum += sharded(x);
+                    }
+                }
+                bench::do_not_optimize(sum);
+            });
+        }
+        for (std::thread& thread: threads) {
+            thread.join();
+        }
+    });
+}
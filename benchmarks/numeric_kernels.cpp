@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/numeric.hpp>
+
+/* Plain loops, as written by hand, for comparison */
+namespace plain
+{
+template<class T>
+void axpy(const T& a, const T* x, T* y, std::size_t n)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        y[i] += a * x[i];
+    }
+}
+
+template<class T>
+T sum(const T* x, std::size_t n)
+{
+    T result{};
+    for (std::size_t i = 0; i < n; ++i) {
+        result += x[i];
+    }
+    return result;
+}
+
+template<class T>
+T dot(const T* x, const T* y, std::size_t n)
+{
+    T result{};
+    for (std::size_t i = 0; i < n; ++i) {
+        result += x[i] * y[i];
+    }
+    return result;
+}
+
+template<class T>
+T max(const T* x, std::size_t n)
+{
+    T result = x[0];
+    for (std::size_t i = 1; i < n; ++i) {
+        if (result < x[i]) {
+            result = x[i];
+        }
+    }
+    return result;
+}
+
+template<class T, class F>
+void map(const T* x, T* out, std::size_t n, F f)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = f(x[i]);
+    }
+}
+
+} // namespace plain
+
+template<class T>
+void run_kernels(const std::string& type, std::size_t n, std::size_t iterations)
+{
+    std::vector<T> x(n);
+    std::vector<T> y(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = static_cast<T>(i % 17);
+        y[i] = static_cast<T>(i % 13);
+    }
+    const auto label = [&](const char* kernel, const char* impl) {
+        return type + ' ' + kernel + " n=" + std::to_string(n) + ' ' + impl;
+    };
+    const auto square = [](const auto& v) { return v * v; };
+    T a = 2;
+    bench::do_not_optimize(a); // Keep axpy from specializing on a known a
+
+    bench::run(label("axpy", "plain"), iterations, [&] {
+        plain::axpy(a, x.data(), y.data(), n);
+        bench::clobber_memory();
+    });
+    bench::run(label("axpy", "simd"), iterations, [&] {
+        numeric::axpy(a, x.data(), y.data(), n);
+        bench::clobber_memory();
+    });
+
+    bench::run(label("sum", "plain"), iterations, [&] {
+        T r = plain::sum(x.data(), n);
+        bench::do_not_optimize(r);
+    });
+    bench::run(label("sum", "simd"), iterations, [&] {
+        T r = numeric::sum(x.data(), n);
+        bench::do_not_optimize(r);
+    });
+
+    bench::run(label("dot", "plain"), iterations, [&] {
+        T r = plain::dot(x.data(), y.data(), n);
+        bench::do_not_optimize(r);
+    });
+    bench::run(label("dot", "simd"), iterations, [&] {
+        T r = numeric::dot(x.data(), y.data(), n);
+        bench::do_not_optimize(r);
+    });
+
+    bench::run(label("max", "plain"), iterations, [&] {
+        T r = plain::max(x.data(), n);
+        bench::do_not_optimize(r);
+    });
+    bench::run(label("max", "simd"), iterations, [&] {
+        T r = numeric::max(x.data(), n);
+        bench::do_not_optimize(r);
+    });
+
+    bench::run(label("map", "plain"), iterations, [&] {
+        plain::map(x.data(), y.data(), n, square);
+        bench::clobber_memory();
+    });
+    bench::run(label("map", "simd"), iterations, [&] {
+        numeric::map(x.data(), y.data(), n, numeric::lanewise(square));
+        bench::clobber_memory();
+    });
+}
+
+int main()
+{
+    for (std::size_t n: {1u << 10, 1u << 16, 1u << 20}) {
+        const std::size_t iterations = (std::size_t{1} << 26) / n;
+        run_kernels<float>("float", n, iterations);
+        run_kernels<double>("double", n, iterations);
+        run_kernels<std::int32_t>("int32", n, iterations);
+    }
+}
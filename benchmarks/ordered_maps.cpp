@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/containers.hpp>
+
+namespace
+{
+using key = std::uint64_t;
+
+// Inserting into a flat_map moves half of it on average: larger maps are
+// built in bulk only
+constexpr std::size_t max_flat_map_inserts = 10000;
+
+std::vector<key> random_keys(std::size_t n)
+{
+    std::mt19937_64 rng{42};
+    std::vector<key> keys(n);
+    for (auto& k: keys) {
+        k = rng();
+    }
+    return keys;
+}
+
+// Insert n keys, find them in another order, and iterate over the map
+template<class Map>
+void compare(const std::string& name, const std::vector<key>& keys,
+             const std::vector<key>& lookups, bool insert)
+{
+    const std::size_t n = keys.size();
+    const std::size_t iterations = std::max<std::size_t>(1, 1000000 / n);
+    const std::string suffix = " n=" + std::to_string(n);
+
+    if (insert) {
+        bench::run(name + " insert" + suffix, iterations, [&] {
+            Map map;
+            for (key k: keys) {
+                map.try_emplace(k, k);
+            }
+            bench::do_not_optimize(map);
+        });
+    }
+
+    Map map;
+    if constexpr (std::is_same_v<Map, containers::flat_map<key, key>>) {
+        std::vector<std::pair<key, key>> elements;
+        for (key k: keys) {
+            elements.emplace_back(k, k);
+        }
+        map = Map(elements.begin(), elements.end());
+    } else {
+        for (key k: keys) {
+            map.try_emplace(k, k);
+        }
+    }
+
+    bench::run(name + " find" + suffix, iterations, [&] {
+        key sum = 0;
+        for (key k: lookups) {
+            sum += map.find(k)->second;
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::run(name + " iterate" + suffix, iterations, [&] {
+        key sum = 0;
+        for (const auto& element: map) {
+            sum += element.second;
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+
+} // namespace
+
+/// Usage: bench_ordered_maps [max keys], 1000000 by default
+int main(int argc, char** argv)
+{
+    const std::size_t max_keys =
+        argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    for (std::size_t n = 1000; n <= max_keys; n *= 10) {
+        const std::vector<key> keys = random_keys(n);
+        std::vector<key> lookups = keys;
+        std::shuffle(lookups.begin(), lookups.end(), std::mt19937{7});
+
+        compare<std::map<key, key>>("std::map", keys, lookups, true);
+        compare<containers::btree_map<key, key>>("btree_map", keys, lookups,
+                                                 true);
+        compare<containers::flat_map<key, key>>("flat_map", keys, lookups,
+                                                n <= max_flat_map_inserts);
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Scaling of algorithm::parallel_sort and parallel_merge from one thread to
+ * all the hardware threads, against std::sort and std::merge and, when built
+ * with OpenMP, the parallel mode of libstdc++. The process is not pinned to a
+ * CPU unless BENCH_CPU is set.
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_OPENMP)
+#include <omp.h>
+#include <parallel/algorithm>
+#endif
+
+#include <benchmark.hpp>
+
+#include <conceptslib/algorithm.hpp>
+
+namespace
+{
+constexpr std::size_t size = std::size_t{1} << 24;
+
+// 1, 2, 4, ... and the number of hardware threads
+std::vector<std::size_t> thread_counts()
+{
+    const std::size_t hardware = algorithm::thread_pool::default_size();
+    std::vector<std::size_t> counts;
+    for (std::size_t t = 1; t < hardware; t *= 2) {
+        counts.push_back(t);
+    }
+    counts.push_back(hardware);
+    return counts;
+}
+
+} // namespace
+
+int main()
+{
+    setenv("BENCH_CPU", "-1", 0);
+
+    std::mt19937_64 rng{42};
+    std::vector<std::uint64_t> input(size);
+    for (auto& value: input) {
+        value = rng();
+    }
+    std::vector<std::uint64_t> values;
+    const std::size_t iterations = 5;
+
+    bench::run("sort 16M: std::sort", iterations, [&] {
+        values = input;
+        std::sort(values.begin(), values.end());
+        bench::clobber_memory();
+    });
+    for (std::size_t t: thread_counts()) {
+        algorithm::thread_pool pool(t);
+        bench::run("sort 16M: parallel_sort, " + std::to_string(t) +
+                   " threads", iterations, [&] {
+            values = input;
+            algorithm::parallel_sort(pool, values.begin(), values.end());
+            bench::clobber_memory();
+        });
+#if defined(_OPENMP)
+        omp_set_num_threads(static_cast<int>(t));
+        bench::run("sort 16M: __gnu_parallel::sort, " + std::to_string(t) +
+                   " threads", iterations, [&] {
+            values = input;
+            __gnu_parallel::sort(values.begin(), values.end());
+            bench::clobber_memory();
+        });
+#endif
+    }
+
+    // Two sorted halves of 8M elements
+    std::vector<std::uint64_t> halves = input;
+    std::sort(halves.begin(), halves.begin() + size / 2);
+    std::sort(halves.begin() + size / 2, halves.end());
+    const auto middle = halves.begin() + size / 2;
+    std::vector<std::uint64_t> merged(size);
+
+    bench::run("merge 2x8M: std::merge", iterations, [&] {
+        std::merge(halves.begin(), middle, middle, halves.end(),
+                   merged.begin());
+        bench::clobber_memory();
+    });
+    for (std::size_t t: thread_counts()) {
+        algorithm::thread_pool pool(t);
+        bench::run("merge 2x8M: parallel_merge, " + std::to_string(t) +
+                   " threads", iterations, [&] {
+            algorithm::parallel_merge(pool, halves.begin(), middle, middle,
+                                      halves.end(), merged.begin());
+            bench::clobber_memory();
+        });
+#if defined(_OPENMP)
+        omp_set_num_threads(static_cast<int>(t));
+        bench::run("merge 2x8M: __gnu_parallel::merge, " + std::to_string(t) +
+                   " threads", iterations, [&] {
+            __gnu_parallel::merge(halves.begin(), middle, middle,
+                                  halves.end(), merged.begin());
+            bench::clobber_memory();
+        });
+#endif
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Compile time probe: finds, for each of 50 message types, the first of 200
+ * handler types which is concepts::Invocable with it, by one
+ * concepts::first_satisfying fold or, if USE_STD is defined, by a recursive
+ * traits::select chain of conditions. Built by the bench_satisfying_compile
+ * target.
+ */
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/concepts.hpp>
+
+constexpr std::size_t handlers = 200;
+constexpr std::size_t messages = 50;
+
+template<std::size_t I>
+struct message { };
+
+// Handler I accepts message I only
+template<std::size_t I>
+struct handler
+{
+    int operator()(message<I>) const { return I; }
+};
+
+#ifdef USE_STD
+template<class M, class Is>
+struct first_handler;
+
+template<class M, std::size_t... Is>
+struct first_handler<M, std::index_sequence<Is...>>
+    : traits::select_t<
+          traits::condition<concepts::Invocable<handler<Is>&, M>,
+                            std::integral_constant<std::size_t, Is>>...,
+          std::integral_constant<std::size_t, handlers>>
+{ };
+#else
+template<class M, class Is>
+struct first_handler;
+
+template<class M, std::size_t... Is>
+struct first_handler<M, std::index_sequence<Is...>>
+    : concepts::first_satisfying<concepts::invocable,
+                                 traits::list<handler<Is>&...>, M>
+{ };
+#endif
+
+// The messages of the last handlers: every search scans most of the list
+template<std::size_t... Js>
+constexpr std::size_t sum_of_indices(std::index_sequence<Js...>)
+{
+    return (std::size_t{0} + ... +
+            first_handler<message<handlers - messages + Js>,
+                          std::make_index_sequence<handlers>>::value);
+}
+
+static_assert(sum_of_indices(std::make_index_sequence<messages>{}) ==
+              messages * (handlers - messages) +
+              messages * (messages - 1) / 2);
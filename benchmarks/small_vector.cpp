@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/algorithm.hpp>
+#include <conceptslib/containers.hpp>
+
+/* Build a list of n elements, read it once, and discard it */
+template<class Vector, class Make>
+void build_and_discard(const std::string& name, std::size_t n, Make make)
+{
+    bench::run(name + " n=" + std::to_string(n), 200000, [&] {
+        Vector v;
+        for (std::size_t i = 0; i < n; ++i) {
+            v.push_back(make(i));
+        }
+        auto size = v.size();
+        bench::do_not_optimize(size);
+        bench::do_not_optimize(v);
+    });
+}
+
+/* Insert n elements, each in the middle of the list */
+template<class Vector, class Make>
+void insert_in_the_middle(const std::string& name, std::size_t n, Make make)
+{
+    bench::run(name + " middle n=" + std::to_string(n), 20000, [&] {
+        Vector v;
+        for (std::size_t i = 0; i < n; ++i) {
+            v.insert(v.begin() + static_cast<std::ptrdiff_t>(v.size() / 2),
+                     make(i));
+        }
+        bench::do_not_optimize(v);
+    });
+}
+
+// A string whose move constructor may throw: growth copies it, and insertion
+// cannot rely on moves
+struct throwing_string
+{
+    throwing_string(std::string s): value{std::move(s)} { }
+    throwing_string(const throwing_string&) = default;
+    throwing_string(throwing_string&& other) noexcept(false)
+        : value{std::move(other.value)}
+    { }
+    throwing_string& operator=(const throwing_string&) = default;
+    throwing_string& operator=(throwing_string&&) = default;
+
+    std::string value;
+};
+
+/* Relocate n elements back and forth between two uninitialized buffers */
+template<class T, class Make>
+void relocate_back_and_forth(const std::string& name, std::size_t n, Make make)
+{
+    std::allocator<T> allocator;
+    T* a = allocator.allocate(n);
+    T* b = allocator.allocate(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        ::new (static_cast<void*>(a + i)) T(make(i));
+    }
+    bench::run(name + " relocate n=" + std::to_string(n), 20000, [&] {
+        algorithm::uninitialized_relocate(a, a + n, b);
+        algorithm::uninitialized_relocate(b, b + n, a);
+        bench::clobber_memory();
+    });
+    std::destroy(a, a + n);
+    allocator.deallocate(a, n);
+    allocator.deallocate(b, n);
+}
+
+int main()
+{
+    const auto make_int = [](std::size_t i) { return static_cast<int>(i); };
+    const auto make_string = [](std::size_t i) { return std::to_string(i); };
+
+    for (std::size_t n: {0, 1, 2, 4, 8, 16, 32, 64}) {
+        build_and_discard<std::vector<int>>("std::vector<int>", n, make_int);
+        build_and_discard<containers::small_vector<int, 8>>(
+            "small_vector<int, 8>", n, make_int);
+        build_and_discard<containers::small_vector<int, 64>>(
+            "small_vector<int, 64>", n, make_int);
+    }
+    for (std::size_t n: {0, 1, 2, 4, 8, 16, 32, 64}) {
+        build_and_discard<std::vector<std::string>>(
+            "std::vector<std::string>", n, make_string);
+        build_and_discard<containers::small_vector<std::string, 8>>(
+            "small_vector<std::string, 8>", n, make_string);
+    }
+
+    // Growth and insertion with and without concepts::NothrowMovable elements
+    const auto make_long_string = [](std::size_t i) {
+        return std::string(32, 'a') + std::to_string(i);
+    };
+    const auto make_throwing = [&](std::size_t i) {
+        return throwing_string{make_long_string(i)};
+    };
+    for (std::size_t n: {16, 64, 256}) {
+        build_and_discard<std::vector<std::string>>(
+            "std::vector<std::string>", n, make_long_string);
+        build_and_discard<containers::small_vector<std::string, 8>>(
+            "small_vector<std::string, 8>", n, make_long_string);
+        build_and_discard<containers::small_vector<throwing_string, 8>>(
+            "small_vector<throwing_string, 8>", n, make_throwing);
+    }
+    for (std::size_t n: {16, 64, 256}) {
+        insert_in_the_middle<std::vector<std::string>>(
+            "std::vector<std::string>", n, make_long_string);
+        insert_in_the_middle<containers::small_vector<std::string, 8>>(
+            "small_vector<std::string, 8>", n, make_long_string);
+        insert_in_the_middle<containers::small_vector<throwing_string, 8>>(
+            "small_vector<throwing_string, 8>", n, make_throwing);
+    }
+    for (std::size_t n: {64, 1024}) {
+        relocate_back_and_forth<std::string>("std::string", n,
+                                             make_long_string);
+        relocate_back_and_forth<throwing_string>("throwing_string", n,
+                                                 make_throwing);
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/containers.hpp>
+
+namespace
+{
+// A simulation record of twelve fields, of which the scans touch two
+struct Particle
+{
+    double x, y, z;
+    double vx, vy, vz;
+    double mass;
+    double charge;
+    std::int64_t id;
+    std::int64_t cell;
+    double age;
+    double energy;
+};
+
+Particle make(std::size_t i)
+{
+    const double d = static_cast<double>(i);
+    return {d, d, d, 1., 1., 1., 1., 0., static_cast<std::int64_t>(i), 0,
+            0., 0.};
+}
+
+/* Advance x by vx * dt for every particle: reads two fields, writes one */
+void scan(std::size_t n)
+{
+    constexpr double dt = 0.01;
+    const std::size_t iterations = (std::size_t{1} << 28) / (n * 96);
+    const std::string suffix = " n=" + std::to_string(n);
+
+    std::vector<Particle> aos;
+    containers::soa_vector<Particle> soa;
+    soa.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        aos.push_back(make(i));
+        soa.push_back(make(i));
+    }
+
+    bench::run("std::vector<Particle>" + suffix, iterations, [&] {
+        for (auto& p: aos) {
+            p.x += p.vx * dt;
+        }
+        bench::clobber_memory();
+    });
+    bench::run("soa_vector<Particle> data<I>()" + suffix, iterations, [&] {
+        double* x = soa.data<0>();
+        const double* vx = soa.data<3>();
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] += vx[i] * dt;
+        }
+        bench::clobber_memory();
+    });
+    bench::run("soa_vector<Particle> references" + suffix, iterations, [&] {
+        for (auto p: soa) {
+            p.get<0>() += p.get<3>() * dt;
+        }
+        bench::clobber_memory();
+    });
+
+    /* Sum of one field */
+    bench::run("std::vector<Particle> sum" + suffix, iterations, [&] {
+        double sum = 0;
+        for (const auto& p: aos) {
+            sum += p.mass;
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::run("soa_vector<Particle> sum" + suffix, iterations, [&] {
+        double sum = 0;
+        const double* mass = soa.data<6>();
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += mass[i];
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+
+} // namespace
+
+int main()
+{
+    // From L1 resident to main memory
+    for (std::size_t n: {std::size_t{1} << 8, std::size_t{1} << 14,
+                         std::size_t{1} << 20}) {
+        scan(n);
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/algorithm.hpp>
+
+namespace
+{
+// Sort 4096 consecutive arrays of N random values of type T
+template<class T, std::size_t N>
+void compare(const std::string& type)
+{
+    constexpr std::size_t arrays = 4096;
+    std::mt19937 rng{42};
+    std::uniform_int_distribution<int> dist{0, 1 << 20};
+    std::vector<T> input(arrays * N);
+    for (auto& value: input) {
+        value = static_cast<T>(dist(rng));
+    }
+    std::vector<T> values;
+    const std::size_t iterations = (std::size_t{1} << 22) / (arrays * N);
+    const std::string suffix = " " + type + " N=" + std::to_string(N);
+
+    bench::run("std::sort" + suffix, iterations, [&] {
+        values = input;
+        for (std::size_t i = 0; i < arrays; ++i) {
+            std::sort(values.data() + i * N, values.data() + (i + 1) * N);
+        }
+        bench::clobber_memory();
+    });
+    bench::run("algorithm::sort_n" + suffix, iterations, [&] {
+        values = input;
+        for (std::size_t i = 0; i < arrays; ++i) {
+            algorithm::sort_n<N>(values.data() + i * N);
+        }
+        bench::clobber_memory();
+    });
+}
+
+template<class T, std::size_t... Ns>
+void compare_all(const std::string& type, std::index_sequence<Ns...>)
+{
+    (compare<T, Ns>(type), ...);
+}
+
+} // namespace
+
+int main()
+{
+    using sizes = std::index_sequence<4, 8, 12, 16, 24, 32>;
+    compare_all<int>("int", sizes{});
+    compare_all<float>("float", sizes{});
+    compare_all<double>("double", sizes{});
+}
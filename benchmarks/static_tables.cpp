@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Startup cost of a service with 48 lookup tables: 16 CRC-32 tables, 16
+ * character classification maps and 16 keyword maps. The tables are either
+ * built when the service starts, as dynamic initialization does, or are
+ * constants built by utility::make_table and containers::static_map, which
+ * the service only reads.
+ */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/containers.hpp>
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+constexpr std::size_t tables = 16;
+
+constexpr std::uint32_t polynomials[tables] = {
+    0xEDB88320u, 0x82F63B78u, 0xEB31D82Eu, 0xD5828281u,
+    0x992C1A4Cu, 0x90022004u, 0xC8DF352Fu, 0xA833982Bu,
+    0x8F6E37A0u, 0xBA0DC66Bu, 0xD419CC15u, 0xF0FDD2A2u,
+    0xA4F0B2C4u, 0x814141ABu, 0x8C4E8B45u, 0xE8A45605u};
+
+constexpr std::uint32_t crc_entry(std::uint32_t polynomial, std::size_t i)
+{
+    auto crc = static_cast<std::uint32_t>(i);
+    for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc >> 1) ^ (crc & 1 ? polynomial : 0u);
+    }
+    return crc;
+}
+
+// Class K of characters: those whose code is a multiple of K + 2, or a letter
+constexpr bool in_class(std::size_t k, std::size_t c)
+{
+    return c % (k + 2) == 0 || (c >= 'a' && c <= 'z');
+}
+
+constexpr std::string_view keywords[] = {
+    "alignas", "auto", "break", "case", "catch", "class", "const", "continue",
+    "default", "delete", "do", "else", "enum", "explicit", "for", "if"};
+
+using keyword_map = containers::static_map<std::string_view, int, 16>;
+
+constexpr keyword_map make_keywords(int k)
+{
+    keyword_map map;
+    for (int i = 0; i < 16; ++i) {
+        map.try_emplace(keywords[i], i * k);
+    }
+    return map;
+}
+
+/* Constant tables */
+template<std::size_t K>
+constexpr auto crc_table = utility::make_table<256>(
+    [](std::size_t i) { return crc_entry(polynomials[K], i); });
+
+template<std::size_t K>
+constexpr auto class_table = utility::make_table<256>(
+    [](std::size_t c) { return in_class(K, c); });
+
+template<std::size_t K>
+constexpr keyword_map keyword_table = make_keywords(static_cast<int>(K));
+
+template<std::size_t... Ks>
+std::uint32_t read_constants(std::index_sequence<Ks...>)
+{
+    return (std::uint32_t{0} + ... +
+            (crc_table<Ks>[255] + class_table<Ks>['q'] +
+             static_cast<std::uint32_t>(keyword_table<Ks>.at("if"))));
+}
+
+/* Tables built at startup */
+struct runtime_tables
+{
+    std::array<std::uint32_t, 256> crc[tables];
+    std::array<bool, 256> classes[tables];
+    keyword_map keywords[tables];
+};
+
+std::uint32_t build_and_read(runtime_tables& t, const std::uint32_t* polys)
+{
+    std::uint32_t sum = 0;
+    for (std::size_t k = 0; k < tables; ++k) {
+        for (std::size_t i = 0; i < 256; ++i) {
+            t.crc[k][i] = crc_entry(polys[k], i);
+            t.classes[k][i] = in_class(k, i);
+        }
+        t.keywords[k] = make_keywords(static_cast<int>(k));
+        sum += t.crc[k][255] + t.classes[k]['q'] +
+               static_cast<std::uint32_t>(t.keywords[k].at("if"));
+    }
+    return sum;
+}
+
+} // namespace
+
+int main()
+{
+    // The polynomials are read through an opaque copy, so the tables built at
+    // startup cannot be folded into constants
+    std::uint32_t polys[tables];
+    for (std::size_t k = 0; k < tables; ++k) {
+        polys[k] = polynomials[k];
+    }
+    bench::do_not_optimize(polys);
+
+    runtime_tables t;
+    bench::run("startup: build 48 tables", 2000, [&] {
+        auto sum = build_and_read(t, polys);
+        bench::do_not_optimize(sum);
+    });
+    bench::run("startup: read 48 constant tables", 2000, [&] {
+        auto sum = read_constants(std::make_index_sequence<tables>{});
+        bench::do_not_optimize(sum);
+    });
+}
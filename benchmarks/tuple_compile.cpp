@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Compile time probe: four message types of 80 members each, with std::tuple
+ * if USE_STD is defined or utility::tuple otherwise. Every member is read and
+ * every message is copied and compared. Built by the bench_tuple_compile
+ * target, which also reports the size of the (debug) object file.
+ */
+#include <cstddef>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <conceptslib/utility.hpp>
+
+#ifdef USE_STD
+namespace lib = std;
+#else
+namespace lib = utility;
+#endif
+
+template<int Message, std::size_t I>
+struct field
+{
+    int value = static_cast<int>(I);
+
+    friend bool operator==(field l, field r) { return l.value == r.value; }
+    friend bool operator!=(field l, field r) { return l.value != r.value; }
+    friend bool operator<(field l, field r) { return l.value < r.value; }
+    friend bool operator>(field l, field r) { return r < l; }
+    friend bool operator<=(field l, field r) { return !(r < l); }
+    friend bool operator>=(field l, field r) { return !(l < r); }
+};
+
+template<int Message, class Is>
+struct message_imp;
+
+template<int Message, std::size_t... Is>
+struct message_imp<Message, std::index_sequence<Is...>>
+{
+    using type = lib::tuple<field<Message, Is>...>;
+
+    static int sum(const type& m)
+    {
+        return (lib::get<Is>(m).value + ...);
+    }
+};
+
+template<int Message>
+int touch()
+{
+    using imp = message_imp<Message, std::make_index_sequence<80>>;
+    typename imp::type m;
+    auto copy = m;
+    lib::get<40>(copy).value = 1;
+    return imp::sum(copy) + (m == copy) + (m < copy);
+}
+
+int touch_all()
+{
+    return touch<0>() + touch<1>() + touch<2>() + touch<3>();
+}
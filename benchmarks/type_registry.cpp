@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstddef>
+#include <random>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+template<std::size_t N>
+struct Plugin { };
+
+/* Look up the handler index of n uniformly distributed registered types */
+template<std::size_t... Is>
+void lookup(std::size_t n, std::index_sequence<Is...>)
+{
+    constexpr std::size_t size = sizeof...(Is);
+    using Registry = utility::type_registry<Plugin<Is>...>;
+
+    const std::unordered_map<std::type_index, std::size_t> map = {
+        {std::type_index(typeid(Plugin<Is>)), Is}...
+    };
+    const std::type_index type_indices[] = {typeid(Plugin<Is>)...};
+    const utility::type_id_t type_ids[] = {utility::type_id_v<Plugin<Is>>...};
+
+    // The same sequence of types for both
+    std::mt19937 rng{42};
+    std::vector<std::type_index> std_keys;
+    std::vector<utility::type_id_t> keys;
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto type = rng() % size;
+        std_keys.push_back(type_indices[type]);
+        keys.push_back(type_ids[type]);
+    }
+
+    const std::string suffix =
+        " " + std::to_string(size) + " types, n=" + std::to_string(n);
+    const std::size_t iterations = (std::size_t{1} << 24) / n;
+
+    bench::run("unordered_map<type_index>" + suffix, iterations, [&] {
+        std::size_t sum = 0;
+        for (const auto& key: std_keys) {
+            sum += map.find(key)->second;
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::run("type_registry" + suffix, iterations, [&] {
+        std::size_t sum = 0;
+        for (const auto key: keys) {
+            sum += Registry::index_of(key);
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+
+} // namespace
+
+int main()
+{
+    constexpr std::size_t n = 1 << 12;
+    lookup(n, std::make_index_sequence<4>{});
+    lookup(n, std::make_index_sequence<16>{});
+    lookup(n, std::make_index_sequence<64>{});
+    lookup(n, std::make_index_sequence<256>{});
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstdio>
+#include <random>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <benchmark.hpp>
+
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+using Small = std::variant<int, long, float, double>;
+using Large = std::variant<char, short, int, long, long long, unsigned char,
+                           unsigned short, unsigned, unsigned long, float,
+                           double, long double>;
+
+// The alternatives return different types: the result is their common type
+struct Increment
+{
+    template<class T>
+    constexpr T operator()(T x) const { return static_cast<T>(x + 1); }
+};
+
+struct Product
+{
+    template<class T, class U>
+    constexpr double operator()(T x, U y) const
+    {
+        return static_cast<double>(x) * static_cast<double>(y);
+    }
+};
+
+template<class V, std::size_t... Is>
+V make_alternative(std::size_t i, std::index_sequence<Is...>)
+{
+    static const V alternatives[] = {V(std::in_place_index<Is>, 1)...};
+    return alternatives[i];
+}
+
+// Variants holding uniformly distributed alternatives
+template<class V>
+std::vector<V> make_variants(std::size_t n, unsigned seed)
+{
+    constexpr auto size = std::variant_size_v<V>;
+    std::mt19937 rng{seed};
+    std::vector<V> values;
+    values.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        values.push_back(make_alternative<V>(rng() % size,
+                                             std::make_index_sequence<size>{}));
+    }
+    return values;
+}
+
+template<class V>
+void unary(const std::string& name, std::size_t n)
+{
+    const auto values = make_variants<V>(n, 42);
+    const std::size_t iterations = (std::size_t{1} << 24) / n;
+
+    bench::run("std::visit " + name, iterations, [&] {
+        long double sum = 0;
+        for (const auto& v: values) {
+            // std::visit requires every alternative to return the same type
+            sum += std::visit([](auto x) -> long double {
+                return Increment{}(x);
+            }, v);
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::run("utility::visit " + name, iterations, [&] {
+        long double sum = 0;
+        for (const auto& v: values) {
+            sum += utility::visit(Increment{}, v);
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+
+template<class V>
+void binary(const std::string& name, std::size_t n)
+{
+    const auto lhs = make_variants<V>(n, 42);
+    const auto rhs = make_variants<V>(n, 7);
+    const std::size_t iterations = (std::size_t{1} << 24) / n;
+
+    bench::run("std::visit " + name, iterations, [&] {
+        double sum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += std::visit(Product{}, lhs[i], rhs[i]);
+        }
+        bench::do_not_optimize(sum);
+    });
+    bench::run("utility::visit " + name, iterations, [&] {
+        double sum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += utility::visit(Product{}, lhs[i], rhs[i]);
+        }
+        bench::do_not_optimize(sum);
+    });
+}
+
+} // namespace
+
+int main()
+{
+    constexpr std::size_t n = 1 << 14;
+    unary<Small>("4 alternatives, n=16384", n);
+    unary<Large>("12 alternatives, n=16384", n);
+    binary<Small>("4x4 alternatives, n=16384", n);
+    binary<Large>("12x12 alternatives, n=16384", n);
+}
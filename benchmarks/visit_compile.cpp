@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Compile time probe: instantiates a three variant visitation with 8^3
+ * combinations, with std::visit if USE_STD is defined or utility::visit
+ * otherwise. Built by the bench_visit_compile target.
+ */
+#include <variant>
+
+#include <conceptslib/utility.hpp>
+
+#ifdef USE_STD
+#define VISIT std::visit
+#else
+#define VISIT utility::visit
+#endif
+
+template<int I>
+struct A
+{
+    int value = I;
+};
+
+using V = std::variant<A<0>, A<1>, A<2>, A<3>, A<4>, A<5>, A<6>, A<7>>;
+
+struct Sum
+{
+    template<class X, class Y, class Z>
+    int operator()(const X& x, const Y& y, const Z& z) const
+    {
+        return x.value + y.value + z.value;
+    }
+};
+
+int visit_all(const V& x, const V& y, const V& z)
+{
+    return VISIT(Sum{}, x, y, z);
+}
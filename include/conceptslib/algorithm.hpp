@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef ALGORITHM_H
+#define ALGORITHM_H
+
+#include <conceptslib/detail/algorithm/parallel_sort.hpp>
+#include <conceptslib/detail/algorithm/sort_n.hpp>
+#include <conceptslib/detail/algorithm/thread_pool.hpp>
+#include <conceptslib/detail/algorithm/uninitialized.hpp>
+
+#endif //ALGORITHM_H
@@ -14,5 +14,8 @@
 #include <conceptslib/detail/concepts/movable.hpp>
 #include <conceptslib/detail/concepts/object.hpp>
 #include <conceptslib/detail/concepts/callable.hpp>
+#include <conceptslib/detail/concepts/arithmetic.hpp>
+#include <conceptslib/detail/concepts/hashing.hpp>
+#include <conceptslib/detail/concepts/satisfying.hpp>
 
 #endif //CONCEPTS_H
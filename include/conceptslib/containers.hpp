@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef CONTAINERS_H
+#define CONTAINERS_H
+
+#include <conceptslib/detail/containers/btree_map.hpp>
+#include <conceptslib/detail/containers/dary_heap.hpp>
+#include <conceptslib/detail/containers/flat_map.hpp>
+#include <conceptslib/detail/containers/frozen_map.hpp>
+#include <conceptslib/detail/containers/hash_map.hpp>
+#include <conceptslib/detail/containers/small_vector.hpp>
+#include <conceptslib/detail/containers/soa_vector.hpp>
+#include <conceptslib/detail/containers/static_map.hpp>
+#include <conceptslib/detail/containers/static_vector.hpp>
+
+#endif //CONTAINERS_H
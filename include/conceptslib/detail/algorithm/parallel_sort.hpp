@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_PARALLEL_SORT_H
+#define DETAIL_PARALLEL_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/core.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+#include <conceptslib/detail/concepts/callable.hpp>
+#include <conceptslib/detail/concepts/movable.hpp>
+#include <conceptslib/detail/algorithm/sort_n.hpp>
+#include <conceptslib/detail/algorithm/thread_pool.hpp>
+#include <conceptslib/detail/functional/invoke.hpp>
+
+namespace algorithm
+{
+namespace detail
+{
+template<class It>
+inline constexpr bool random_access_v = std::is_base_of_v<
+    std::random_access_iterator_tag,
+    typename std::iterator_traits<It>::iterator_category>;
+
+template<class Compare, class It>
+inline constexpr bool parallel_sortable_v =
+    random_access_v<It> &&
+    sortable_v<Compare, It> &&
+    concepts::Movable<iter_value_t<It>>;
+
+template<class Compare, class It1, class It2, class OutIt>
+inline constexpr bool parallel_mergeable_v =
+    random_access_v<It1> && random_access_v<It2> && random_access_v<OutIt> &&
+    concepts::StrictWeakOrder<Compare&, iter_reference_t<It1>
+                             ,iter_reference_t<It2>> &&
+    concepts::Movable<iter_value_t<It1>> &&
+    std::is_assignable_v<iter_reference_t<OutIt>, iter_reference_t<It1>> &&
+    std::is_assignable_v<iter_reference_t<OutIt>, iter_reference_t<It2>>;
+
+// Ranges shorter than this are sorted or merged by a single thread
+inline constexpr std::size_t parallel_threshold = std::size_t{1} << 15;
+
+// Samples taken per bucket to choose the splitters
+inline constexpr std::size_t oversampling = 32;
+
+/// Comparison which calls comp through functional::invoke, for the algorithms
+/// of the standard library
+template<class Compare>
+struct invoke_compare
+{
+    Compare& comp;
+
+    template<class T, class U>
+    bool operator()(T&& lhs, U&& rhs) const
+    {
+        return functional::invoke(comp, std::forward<T>(lhs),
+                                  std::forward<U>(rhs));
+    }
+};
+
+/// Uninitialized storage for n objects of type T
+template<class T>
+class raw_buffer
+{
+public:
+    explicit raw_buffer(std::size_t n)
+        : data_(std::allocator<T>().allocate(n)), size_(n)
+    { }
+
+    raw_buffer(const raw_buffer&) = delete;
+    raw_buffer& operator=(const raw_buffer&) = delete;
+
+    ~raw_buffer() { std::allocator<T>().deallocate(data_, size_); }
+
+    T* data() const noexcept { return data_; }
+
+private:
+    T* data_;
+    std::size_t size_;
+};
+
+/**
+ * Sample sort of the n elements at first, with the threads of pool
+ * @details Sorted samples choose buckets - 1 splitters. Each thread then
+ * classifies a block of elements, counting the elements of each bucket in the
+ * block, and moves them to a buffer at the offsets given by the counts: every
+ * bucket is contiguous, and the blocks write to disjoint positions. Finally
+ * each bucket is moved back to its place and sorted by one thread. All the
+ * comparisons against the splitters are done before the first element moves.
+ */
+template<class RandomIt, class Compare>
+void sample_sort(thread_pool& pool, RandomIt first, std::size_t n,
+                 Compare& comp)
+{
+    using T = iter_value_t<RandomIt>;
+    const invoke_compare<Compare> less{comp};
+
+    const std::size_t threads = pool.size();
+    const std::size_t buckets = std::min<std::size_t>(8 * threads, 4096);
+    const std::size_t blocks = 4 * threads;
+
+    // The splitters, as positions of elements
+    std::vector<std::size_t> samples(buckets * oversampling);
+    std::minstd_rand rng{static_cast<std::minstd_rand::result_type>(n)};
+    std::uniform_int_distribution<std::size_t> pick{0, n - 1};
+    for (std::size_t& s: samples) {
+        s = pick(rng);
+    }
+    std::sort(samples.begin(), samples.end(),
+              [&](std::size_t a, std::size_t b) {
+                  return less(first[a], first[b]);
+              });
+    std::vector<std::size_t> splitters(buckets - 1);
+    for (std::size_t b = 1; b < buckets; ++b) {
+        splitters[b - 1] = samples[b * oversampling];
+    }
+
+    // Bucket of each element, and count of each bucket in each block
+    std::unique_ptr<std::uint16_t[]> ids(new std::uint16_t[n]);
+    std::vector<std::size_t> offsets(blocks * buckets);
+    const auto block_begin = [n, blocks](std::size_t t) {
+        return t * n / blocks;
+    };
+    pool.parallel_for(blocks, [&](std::size_t t) {
+        std::size_t* counts = offsets.data() + t * buckets;
+        for (std::size_t i = block_begin(t); i < block_begin(t + 1); ++i) {
+            std::size_t lo = 0;
+            std::size_t count = splitters.size();
+            while (count > 0) {
+                const std::size_t half = count / 2;
+                if (!less(first[i], first[splitters[lo + half]])) {
+                    lo += half + 1;
+                    count -= half + 1;
+                } else {
+                    count = half;
+                }
+            }
+            ids[i] = static_cast<std::uint16_t>(lo);
+            ++counts[lo];
+        }
+    });
+
+    // Offset of each bucket in each block, bucket by bucket
+    std::vector<std::size_t> bucket_begin(buckets + 1);
+    std::size_t total = 0;
+    for (std::size_t b = 0; b < buckets; ++b) {
+        bucket_begin[b] = total;
+        for (std::size_t t = 0; t < blocks; ++t) {
+            const std::size_t count = offsets[t * buckets + b];
+            offsets[t * buckets + b] = total;
+            total += count;
+        }
+    }
+    bucket_begin[buckets] = total;
+
+    // Moves and destructions cannot throw: every element which is moved to
+    // the buffer is moved back to the range
+    raw_buffer<T> buffer(n);
+    T* const data = buffer.data();
+    pool.parallel_for(blocks, [&](std::size_t t) {
+        std::size_t* next = offsets.data() + t * buckets;
+        for (std::size_t i = block_begin(t); i < block_begin(t + 1); ++i) {
+            ::new (static_cast<void*>(data + next[ids[i]]++))
+                T(std::move(first[i]));
+        }
+    });
+    pool.parallel_for(buckets, [&](std::size_t b) {
+        const std::size_t begin = bucket_begin[b];
+        const std::size_t end = bucket_begin[b + 1];
+        for (std::size_t i = begin; i < end; ++i) {
+            first[i] = std::move(data[i]);
+            data[i].~T();
+        }
+        std::sort(first + begin, first + end, less);
+    });
+}
+
+// Position in the first range of the split of the first d elements of the
+// stable merge of the two ranges (the merge path)
+template<class It1, class It2, class Less>
+std::size_t merge_split(It1 first1, std::size_t n1, It2 first2,
+                        std::size_t n2, std::size_t d, const Less& less)
+{
+    std::size_t lo = d > n2 ? d - n2 : 0;
+    std::size_t hi = std::min(d, n1);
+    while (lo < hi) {
+        const std::size_t i = lo + (hi - lo) / 2;
+        // Equal elements of the first range come first: take first1[i] too
+        if (!less(first2[d - i - 1], first1[i])) {
+            lo = i + 1;
+        } else {
+            hi = i;
+        }
+    }
+    return lo;
+}
+
+} // namespace detail
+
+/* --- Function parallel_sort --- */
+/**
+ * Sort the elements of [first, last) with the threads of pool
+ * @details Sample sort: the elements are distributed to a few buckets per
+ * thread, delimited by splitters chosen from sorted random samples, and the
+ * buckets are sorted independently with std::sort. It uses a buffer of
+ * last - first elements. Ranges shorter than about 32K elements, pools of one
+ * thread, and elements whose moves may throw (which could not be moved back
+ * from the buffer after an exception) are sorted with std::sort. Ranges with
+ * few distinct elements balance poorly: equal elements go to one bucket. The
+ * sort is not stable. If comp throws, the exception is rethrown and the range
+ * holds its elements in an unspecified order.
+ * @param comp Comparison which must satisfy \c concepts::StrictWeakOrder on
+ * the elements. It is called concurrently from the threads of pool.
+ */
+template<class RandomIt, class Compare = std::less<>>
+auto parallel_sort(thread_pool& pool, RandomIt first, RandomIt last,
+                   Compare comp = {})
+    -> std::enable_if_t<detail::parallel_sortable_v<Compare, RandomIt>>
+{
+    using T = detail::iter_value_t<RandomIt>;
+    const auto n = static_cast<std::size_t>(last - first);
+    if constexpr (concepts::NothrowMovable<T> &&
+                  std::is_nothrow_destructible_v<T>) {
+        if (pool.size() > 1 && n >= detail::parallel_threshold) {
+            detail::sample_sort(pool, first, n, comp);
+            return;
+        }
+    }
+    std::sort(first, last, detail::invoke_compare<Compare>{comp});
+}
+
+/// Sort the elements of [first, last) with the default_thread_pool()
+template<class RandomIt, class Compare = std::less<>>
+auto parallel_sort(RandomIt first, RandomIt last, Compare comp = {})
+    -> std::enable_if_t<detail::parallel_sortable_v<Compare, RandomIt>>
+{
+    algorithm::parallel_sort(default_thread_pool(), first, last, comp);
+}
+
+/* --- Function parallel_merge --- */
+/**
+ * Merge the sorted ranges [first1, last1) and [first2, last2) into the range
+ * starting at d_first, with the threads of pool
+ * @details The output is cut in a few chunks per thread. The merge path finds
+ * by binary search the parts of the inputs which form each chunk, and the
+ * chunks are merged independently with std::merge. Like std::merge, the merge
+ * is stable and copies the elements: pass std::move_iterator to move them.
+ * The output must not overlap the inputs.
+ * @param comp Comparison which must satisfy \c concepts::StrictWeakOrder on
+ * the elements. It is called concurrently from the threads of pool.
+ * @return The end of the output
+ */
+template<class It1, class It2, class OutIt, class Compare = std::less<>>
+auto parallel_merge(thread_pool& pool, It1 first1, It1 last1, It2 first2,
+                    It2 last2, OutIt d_first, Compare comp = {})
+    -> std::enable_if_t<
+        detail::parallel_mergeable_v<Compare, It1, It2, OutIt>, OutIt>
+{
+    const detail::invoke_compare<Compare> less{comp};
+    const auto n1 = static_cast<std::size_t>(last1 - first1);
+    const auto n2 = static_cast<std::size_t>(last2 - first2);
+    const std::size_t n = n1 + n2;
+    if (pool.size() == 1 || n < detail::parallel_threshold) {
+        return std::merge(first1, last1, first2, last2, d_first, less);
+    }
+
+    // All the splits are found before any element is merged: with move
+    // iterators, merging a chunk moves from the elements around its ends
+    const std::size_t chunks = 4 * pool.size();
+    std::vector<std::size_t> splits(chunks + 1);
+    for (std::size_t c = 0; c <= chunks; ++c) {
+        splits[c] = detail::merge_split(first1, n1, first2, n2,
+                                        c * n / chunks, less);
+    }
+    pool.parallel_for(chunks, [&](std::size_t c) {
+        const std::size_t begin = c * n / chunks;
+        const std::size_t end = (c + 1) * n / chunks;
+        const std::size_t i = splits[c];
+        const std::size_t j = splits[c + 1];
+        std::merge(first1 + i, first1 + j, first2 + (begin - i),
+                   first2 + (end - j), d_first + begin, less);
+    });
+    return d_first + n;
+}
+
+/// Merge two sorted ranges with the default_thread_pool()
+template<class It1, class It2, class OutIt, class Compare = std::less<>>
+auto parallel_merge(It1 first1, It1 last1, It2 first2, It2 last2,
+                    OutIt d_first, Compare comp = {})
+    -> std::enable_if_t<
+        detail::parallel_mergeable_v<Compare, It1, It2, OutIt>, OutIt>
+{
+    return algorithm::parallel_merge(default_thread_pool(), first1, last1,
+                                     first2, last2, d_first, comp);
+}
+
+} // namespace algorithm
+
+#endif //DETAIL_PARALLEL_SORT_H
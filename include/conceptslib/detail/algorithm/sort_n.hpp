@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_SORT_N_H
+#define DETAIL_SORT_N_H
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/core.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+#include <conceptslib/detail/concepts/callable.hpp>
+#include <conceptslib/detail/functional/invoke.hpp>
+
+namespace algorithm
+{
+namespace detail
+{
+/* --- Sorting networks --- */
+// Orders the elements first and second: first receives the smaller one
+struct comparator
+{
+    std::size_t first;
+    std::size_t second;
+};
+
+/**
+ * Invoke f with each comparator of Batcher's odd-even merge sort of n
+ * elements, pruned from the next power of two to n
+ * @details The comparators are visited in layers of independent comparators,
+ * so consecutive compare-exchanges do not depend on each other. The networks
+ * are size optimal up to 8 elements, and within 12% of the best known ones up
+ * to 16 elements.
+ */
+template<class F>
+constexpr void odd_even_merge_network(std::size_t n, F f)
+{
+    for (std::size_t p = 1; p < n; p *= 2) {
+        for (std::size_t k = p; k >= 1; k /= 2) {
+            for (std::size_t j = k % p; j + k < n; j += 2 * k) {
+                for (std::size_t i = 0; i < k && i + j + k < n; ++i) {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p)) {
+                        f(comparator{i + j, i + j + k});
+                    }
+                }
+            }
+        }
+    }
+}
+
+constexpr std::size_t network_size(std::size_t n)
+{
+    std::size_t size = 0;
+    odd_even_merge_network(n, [&size](comparator) { ++size; });
+    return size;
+}
+
+template<std::size_t N>
+constexpr auto make_network()
+{
+    std::array<comparator, network_size(N)> network{};
+    std::size_t i = 0;
+    odd_even_merge_network(N, [&network, &i](comparator c) {
+        network[i++] = c;
+    });
+    return network;
+}
+
+/// Comparators of the sorting network of N elements
+template<std::size_t N>
+inline constexpr auto network_v = make_network<N>();
+
+/* --- Compare-exchange --- */
+template<class It>
+using iter_reference_t = typename std::iterator_traits<It>::reference;
+
+template<class It>
+using iter_value_t = typename std::iterator_traits<It>::value_type;
+
+// Values that are cheap to copy are exchanged with conditional moves, so the
+// network has no branches
+template<class It>
+inline constexpr bool select_exchange_v =
+    std::is_lvalue_reference_v<iter_reference_t<It>> &&
+    std::is_trivially_copyable_v<iter_value_t<It>> &&
+    sizeof(iter_value_t<It>) <= 2 * sizeof(void*);
+
+// Comparisons of arithmetic values with the built-in < and >, which compile
+// to min and max instructions
+template<class Compare, class T>
+inline constexpr bool is_less_v =
+    std::is_arithmetic_v<T> &&
+    (std::is_same_v<Compare, std::less<>> ||
+     std::is_same_v<Compare, std::less<T>>);
+
+template<class Compare, class T>
+inline constexpr bool is_greater_v =
+    std::is_arithmetic_v<T> &&
+    (std::is_same_v<Compare, std::greater<>> ||
+     std::is_same_v<Compare, std::greater<T>>);
+
+template<std::size_t I, std::size_t J, class It, class Compare>
+inline void compare_exchange(It first, Compare& comp)
+{
+    if constexpr (select_exchange_v<It>) {
+        using T = iter_value_t<It>;
+        T& a = first[I];
+        T& b = first[J];
+        if constexpr (is_less_v<Compare, T>) {
+            const T lo = b < a ? b : a;
+            const T hi = a < b ? b : a;
+            a = lo;
+            b = hi;
+        } else if constexpr (is_greater_v<Compare, T>) {
+            const T hi = a < b ? b : a;
+            const T lo = b < a ? b : a;
+            a = hi;
+            b = lo;
+        } else {
+            const bool swap = functional::invoke(comp, b, a);
+            const T lo = swap ? b : a;
+            const T hi = swap ? a : b;
+            a = lo;
+            b = hi;
+        }
+    } else {
+        if (functional::invoke(comp, first[J], first[I])) {
+            std::iter_swap(first + I, first + J);
+        }
+    }
+}
+
+template<std::size_t N, class It, class Compare, std::size_t... Is>
+inline void apply_network(It first, Compare& comp, std::index_sequence<Is...>)
+{
+    static_cast<void>(first); // Networks of fewer than 2 elements are empty
+    (compare_exchange<network_v<N>[Is].first, network_v<N>[Is].second>(
+         first, comp), ...);
+}
+
+template<class Compare, class It>
+inline constexpr bool sortable_v =
+    concepts::StrictWeakOrder<Compare&, iter_reference_t<It>
+                             ,iter_reference_t<It>>;
+
+} // namespace detail
+
+/* --- Function sort_n --- */
+/**
+ * Sort the N elements starting at first with a sorting network
+ * @details The network is generated at compile time and unrolled: every
+ * comparison is at a constant offset, and elements which are cheap to copy
+ * are exchanged without branches (with min and max instructions for
+ * arithmetic types compared with std::less or std::greater). Intended for
+ * small N, up to a few dozen elements. The sort is not stable.
+ * @tparam N The number of elements.
+ * @param comp Comparison which must satisfy \c concepts::StrictWeakOrder on
+ * the elements.
+ */
+template<std::size_t N, class RandomIt, class Compare = std::less<>>
+inline auto sort_n(RandomIt first, Compare comp = {})
+    -> std::enable_if_t<detail::sortable_v<Compare, RandomIt>>
+{
+    detail::apply_network<N>(first, comp,
+        std::make_index_sequence<detail::network_v<N>.size()>{});
+}
+
+/// Sort the elements of values with a sorting network
+template<class T, std::size_t N, class Compare = std::less<>>
+inline auto sort_n(std::array<T, N>& values, Compare comp = {})
+    -> std::enable_if_t<detail::sortable_v<Compare, T*>>
+{
+    algorithm::sort_n<N>(values.data(), comp);
+}
+
+/// Sort the elements of the array values with a sorting network
+template<class T, std::size_t N, class Compare = std::less<>>
+inline auto sort_n(T (&values)[N], Compare comp = {})
+    -> std::enable_if_t<detail::sortable_v<Compare, T*>>
+{
+    algorithm::sort_n<N>(values + 0, comp);
+}
+
+} // namespace algorithm
+
+#endif //DETAIL_SORT_N_H
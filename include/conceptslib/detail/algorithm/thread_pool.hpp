@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_THREAD_POOL_H
+#define DETAIL_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace algorithm
+{
+/* --- Class thread_pool --- */
+/**
+ * Fixed set of threads which run the iterations of parallel loops.
+ * @details A pool of n threads starts n - 1 workers: the thread calling
+ * parallel_for is the last one. The iterations are handed out one at a time
+ * from an atomic counter, so uneven iterations balance themselves. One loop
+ * runs at a time: parallel_for called from several threads runs their loops
+ * one after the other, and a parallel_for called from an iteration deadlocks.
+ */
+class thread_pool
+{
+    // A loop being run, which lives on the stack of parallel_for
+    struct job
+    {
+        void (*run)(void*, std::size_t);
+        void* f;
+        std::size_t n;
+        std::atomic<std::size_t> next{0};
+        std::exception_ptr error;
+    };
+
+public:
+    /// Pool of threads threads, the calling thread included
+    explicit thread_pool(std::size_t threads = default_size())
+    {
+        threads = std::max<std::size_t>(threads, 1);
+        workers_.reserve(threads - 1);
+        for (std::size_t i = 1; i < threads; ++i) {
+            workers_.emplace_back([this] { work(); });
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    ~thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& worker: workers_) {
+            worker.join();
+        }
+    }
+
+    /// Number of threads which run the iterations, the calling one included
+    std::size_t size() const noexcept { return workers_.size() + 1; }
+
+    /// One thread per hardware thread
+    static std::size_t default_size() noexcept
+    {
+        return std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    /**
+     * Call f(i) for each i in [0, n), in parallel, and return when all the
+     * calls have returned.
+     * @details If calls throw, the remaining calls are still made, and the
+     * first exception is rethrown.
+     */
+    template<class F>
+    void parallel_for(std::size_t n, F&& f)
+    {
+        if (n == 0) {
+            return;
+        }
+
+        std::lock_guard<std::mutex> submit(submit_);
+        job j;
+        j.run = [](void* g, std::size_t i) {
+            (*static_cast<std::remove_reference_t<F>*>(g))(i);
+        };
+        j.f = const_cast<void*>(static_cast<const void*>(std::addressof(f)));
+        j.n = n;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_ = &j;
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        run(j);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        finished_.wait(lock, [this] { return active_ == 0; });
+        job_ = nullptr;
+        if (j.error) {
+            std::rethrow_exception(j.error);
+        }
+    }
+
+private:
+    void work()
+    {
+        std::size_t seen = 0;
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;) {
+            wake_.wait(lock, [this, seen] {
+                return stop_ || (job_ != nullptr && generation_ != seen);
+            });
+            if (stop_) {
+                return;
+            }
+            seen = generation_;
+            job& j = *job_;
+            ++active_;
+            lock.unlock();
+            run(j);
+            lock.lock();
+            if (--active_ == 0) {
+                finished_.notify_one();
+            }
+        }
+    }
+
+    void run(job& j)
+    {
+        for (std::size_t i = j.next++; i < j.n; i = j.next++) {
+            try {
+                j.run(j.f, i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(error_);
+                if (!j.error) {
+                    j.error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex submit_;
+    std::mutex error_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable finished_;
+    job* job_ = nullptr;
+    std::size_t generation_ = 0;
+    std::size_t active_ = 0;
+    bool stop_ = false;
+};
+
+/// The pool of default_size() threads used by the parallel algorithms,
+/// started on first use
+inline thread_pool& default_thread_pool()
+{
+    static thread_pool pool;
+    return pool;
+}
+
+} // namespace algorithm
+
+#endif //DETAIL_THREAD_POOL_H
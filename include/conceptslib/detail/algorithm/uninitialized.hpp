@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_UNINITIALIZED_H
+#define DETAIL_UNINITIALIZED_H
+
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace algorithm
+{
+namespace detail
+{
+template<class It>
+using uninitialized_value_t = typename std::iterator_traits<It>::value_type;
+
+// Whether the elements at ForwardIt are constructed from the moved elements
+// of InputIt without throwing: the source may be const, or of another type
+template<class InputIt, class ForwardIt>
+inline constexpr bool nothrow_move_construct_v =
+    std::is_nothrow_constructible_v<
+        uninitialized_value_t<ForwardIt>,
+        decltype(std::move(*std::declval<InputIt&>()))>;
+
+template<class ForwardIt>
+void* voidify(ForwardIt it)
+{
+    return const_cast<void*>(static_cast<const volatile void*>(
+        std::addressof(*it)));
+}
+
+} // namespace detail
+
+/* --- Function uninitialized_move_if_noexcept --- */
+/**
+ * Construct the elements of [first, last) in the uninitialized storage
+ * starting at d_first, moving them if that cannot throw and copying them
+ * otherwise (as std::move_if_noexcept)
+ * @details When constructing the elements of d_first from the moved elements
+ * of [first, last) cannot throw, the loop keeps no count of the constructed
+ * elements and has no rollback, and the call is noexcept. This is decided on
+ * the construction the loop makes: from a const or converted source it may be
+ * a copy or a conversion which throws. Otherwise the elements are copied (or
+ * moved, if they are not copyable), and if a construction throws the elements
+ * constructed so far are destroyed. [first, last) is then left untouched,
+ * unless its elements were moved: a move-only element whose move throws may
+ * leave moved-from elements behind.
+ * @return The end of the constructed range
+ */
+template<class InputIt, class ForwardIt>
+ForwardIt uninitialized_move_if_noexcept(InputIt first, InputIt last,
+                                         ForwardIt d_first)
+    noexcept(detail::nothrow_move_construct_v<InputIt, ForwardIt>)
+{
+    using T = detail::uninitialized_value_t<ForwardIt>;
+    if constexpr (detail::nothrow_move_construct_v<InputIt, ForwardIt>) {
+        for (; first != last; ++first, ++d_first) {
+            ::new (detail::voidify(d_first)) T(std::move(*first));
+        }
+        return d_first;
+    } else {
+        ForwardIt current = d_first;
+        try {
+            for (; first != last; ++first, ++current) {
+                ::new (detail::voidify(current))
+                    T(std::move_if_noexcept(*first));
+            }
+        } catch (...) {
+            std::destroy(d_first, current);
+            throw;
+        }
+        return current;
+    }
+}
+
+/* --- Function uninitialized_relocate --- */
+/**
+ * Relocate the elements of [first, last) to the uninitialized storage
+ * starting at d_first: after the call the elements live at d_first, and
+ * [first, last) is uninitialized storage.
+ * @details Elements whose move constructor cannot throw are moved and
+ * destroyed with no rollback, and the call is noexcept. Otherwise they are
+ * copied, and only destroyed once all the copies succeeded: if a copy throws,
+ * [first, last) is left untouched (strong exception guarantee). Move-only
+ * elements whose move may throw only have the basic guarantee: see
+ * uninitialized_move_if_noexcept.
+ * @return The end of the relocated range
+ */
+template<class ForwardIt1, class ForwardIt2>
+ForwardIt2 uninitialized_relocate(ForwardIt1 first, ForwardIt1 last,
+                                  ForwardIt2 d_first)
+    noexcept(detail::nothrow_move_construct_v<ForwardIt1, ForwardIt2> &&
+             std::is_nothrow_destructible_v<
+                 detail::uninitialized_value_t<ForwardIt1>>)
+{
+    ForwardIt2 d_last = algorithm::uninitialized_move_if_noexcept(
+        first, last, d_first);
+    std::destroy(first, last);
+    return d_last;
+}
+
+} // namespace algorithm
+
+#endif //DETAIL_UNINITIALIZED_H
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_ARITHMETIC_H
+#define DETAIL_ARITHMETIC_H
+
+#include <type_traits>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/core.hpp>
+#include <conceptslib/detail/concepts/object.hpp>
+
+namespace concepts
+{
+/* --- Concept Arithmetic --- */
+namespace detail
+{
+REQUIREMENT ArithmeticReq
+{
+    template<class T, class V = std::remove_reference_t<T>>
+    auto REQUIRES(V& a, const V& b)
+        -> decltype(valid_expr(
+            a += b, valid_if<Same<decltype(a += b), V&>>(),
+            a -= b, valid_if<Same<decltype(a -= b), V&>>(),
+            a *= b, valid_if<Same<decltype(a *= b), V&>>(),
+            b + b,  valid_if<ConvertibleTo<decltype(b + b), T>>(),
+            b - b,  valid_if<ConvertibleTo<decltype(b - b), T>>(),
+            b * b,  valid_if<ConvertibleTo<decltype(b * b), T>>()
+        ));
+};
+
+REQUIREMENT FieldReq
+{
+    template<class T, class V = std::remove_reference_t<T>>
+    auto REQUIRES(V& a, const V& b)
+        -> decltype(valid_expr(
+            a /= b, valid_if<Same<decltype(a /= b), V&>>(),
+            b / b,  valid_if<ConvertibleTo<decltype(b / b), T>>()
+        ));
+};
+} // namespace detail
+
+/**
+ * @concept Specifies that a type supports the arithmetic operators +, - and *
+ * together with their compound assignment forms
+ * @details Satisfied if T is Semiregular, the compound assignments +=, -= and
+ * *= yield an lvalue referring to the left operand, and the results of the
+ * binary operators +, - and * are convertible to T. A value initialized T is
+ * expected to be the additive identity.
+ */
+template<class T>
+CONCEPT Arithmetic =
+    Semiregular<T> &&
+    requires_<detail::ArithmeticReq, T>;
+
+/* --- Concept Field --- */
+/**
+ * @concept Specifies that an Arithmetic type also supports division
+ * @details Satisfied if T is Arithmetic, the compound assignment /= yields an
+ * lvalue referring to the left operand, and the result of the binary operator
+ * / is convertible to T.
+ * @note Integral types model the syntax of Field but not its semantics: the
+ * distinction is purely semantic.
+ */
+template<class T>
+CONCEPT Field =
+    Arithmetic<T> &&
+    requires_<detail::FieldReq, T>;
+
+} // namespace concepts
+
+#endif //DETAIL_ARITHMETIC_H
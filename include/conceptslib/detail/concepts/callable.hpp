@@ -12,6 +12,7 @@
 #include <utility>
 
 #include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/functional/invoke.hpp>
 #include <conceptslib/detail/macros/platform_detection.hpp>
 
 namespace concepts
@@ -30,6 +31,26 @@ REQUIREMENT InvocableReq: platform::InvocableReqImp
 template<class F, class... Args>
 CONCEPT Invocable = requires_<detail::InvocableReq, F, Args...>;
 
+/* --- Concept NothrowInvocable --- */
+namespace detail
+{
+// Only detected if invoking F with Args... is declared noexcept
+template<class F, class... Args>
+using nothrow_invoke_t = std::enable_if_t<noexcept(
+    functional::invoke(std::declval<F>(), std::declval<Args>()...))>;
+
+} // namespace detail
+/**
+ * @concept Specifies that a callable type F can be called with a set of
+ * argument types Args... without throwing
+ * @details Specifies that F is Invocable with Args... and that the call, as
+ * made by \c functional::invoke, is declared \c noexcept.
+ */
+template<class F, class... Args>
+CONCEPT NothrowInvocable =
+    Invocable<F, Args...> &&
+    is_detected_v<detail::nothrow_invoke_t, F, Args...>;
+
 /* --- Concept RegularInvocable --- */
 /**
  * @concept The RegularInvocable concept adds to the Invocable concept by
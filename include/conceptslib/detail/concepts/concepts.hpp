@@ -16,7 +16,7 @@
 #ifndef DETAIL_CONCEPTS_H
 #define DETAIL_CONCEPTS_H
 
-#define CONCEPT constexpr bool
+#define CONCEPT inline constexpr bool
 #define REQUIREMENT struct
 #define REQUIRES requires_fn
 
@@ -63,7 +63,8 @@ using test_requires_t =
  * be used to test the validity of a sequence of requirements.
  */
 template<class Req, class... Args>
-const bool requires_ = is_detected_v<detail::test_requires_t, Req, Args...>;
+inline constexpr bool requires_ =
+    is_detected_v<detail::test_requires_t, Req, Args...>;
 
 /* Special names to use with Concepts */
 // Most likely unecessary
@@ -77,13 +78,13 @@ const bool requires_ = is_detected_v<detail::test_requires_t, Req, Args...>;
 //constexpr bool disallow = !require<bools...>;
 
 template<template <class...> class Op, class... Args>
-constexpr bool exists = is_detected_v<Op, Args...>;
+inline constexpr bool exists = is_detected_v<Op, Args...>;
 
 template<class To, template <class...> class Op, class... Args>
-constexpr bool converts_to = is_detected_convertible_v<To, Op, Args...>;
+inline constexpr bool converts_to = is_detected_convertible_v<To, Op, Args...>;
 
 template <class Exact, template <class...> class Op, class... Args>
-constexpr bool identical_to = is_detected_exact_v<Exact, Op, Args...>;
+inline constexpr bool identical_to = is_detected_exact_v<Exact, Op, Args...>;
 
 /* Operator detectors */
 
@@ -170,6 +170,15 @@ CONCEPT SwappableWith =
     std::is_swappable_with_v<T, U> &&
     std::is_swappable_with_v<U, T>;
 
+/* --- Concept NothrowSwappable --- */
+/**
+ * @concept Specifies that a type can be swapped without throwing
+ * @details Specifies that T is Swappable and that swapping lvalues of type T
+ * is declared \c noexcept.
+ */
+template<class T>
+CONCEPT NothrowSwappable = Swappable<T> && std::is_nothrow_swappable_v<T>;
+
 /* --- Concept Destructible --- */
 /**
  * @concept Specifies that an object of the type can be destroyed
@@ -213,6 +222,18 @@ CONCEPT DefaultConstructible = Constructible<T>;
 template<class T>
 CONCEPT MoveConstructible = Constructible<T, T> && ConvertibleTo<T, T>;
 
+/* --- Concept NothrowMoveConstructible --- */
+/**
+ * @concept Specifies that a variable of the type can be move constructed
+ * without throwing
+ * @details Specifies that T is MoveConstructible and that constructing it
+ * from an rvalue of type T is declared \c noexcept. Containers relocate such
+ * elements by moving them, with no copy to roll back to.
+ */
+template<class T>
+CONCEPT NothrowMoveConstructible =
+    MoveConstructible<T> && std::is_nothrow_constructible_v<T, T>;
+
 /* --- Concept CopyConstructible --- */
 /**
  * @concept Specifies that an object of a type can be copy constructed and move
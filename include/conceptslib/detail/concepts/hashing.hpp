@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_HASHING_H
+#define DETAIL_HASHING_H
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/core.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+
+namespace concepts
+{
+/* --- Concept Hashable --- */
+namespace detail
+{
+REQUIREMENT HashableReq
+{
+    template<class T, class Hash>
+    auto REQUIRES(const std::remove_reference_t<T>& t, const Hash& hash)
+        -> decltype(valid_expr(
+            hash(t), valid_if<ConvertibleTo<decltype(hash(t)), std::size_t>>()
+        ));
+};
+} // namespace detail
+
+/**
+ * @concept Specifies that a const Hash computes std::size_t hash values of
+ * the objects of type T
+ * @details Equal objects must have equal hash values.
+ */
+template<class T, class Hash = std::hash<T>>
+CONCEPT Hashable = requires_<detail::HashableReq, T, Hash>;
+
+/* --- Concept HashableWith --- */
+/**
+ * @concept Specifies that Hash computes hash values of both T and U which are
+ * consistent with the equality of mixed operands: if t == u, then hash(t) ==
+ * hash(u).
+ * @details A container of keys T can then find a key equal to an object of
+ * type U without converting it to T.
+ */
+template<class T, class U, class Hash>
+CONCEPT HashableWith =
+    Hashable<T, Hash> &&
+    Hashable<U, Hash> &&
+    EqualityComparableWith<T, U>;
+
+} // namespace concepts
+
+#endif //DETAIL_HASHING_H
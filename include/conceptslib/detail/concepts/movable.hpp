@@ -27,6 +27,20 @@ CONCEPT Movable =
     Assignable<detected_t<ops::lreference, T>, T> &&
     Swappable<T>;
 
+/* --- Concept NothrowMovable --- */
+/**
+ * @concept Specifies that an object of a type can be moved and swapped without
+ * throwing
+ * @details Specifies that T is Movable, NothrowMoveConstructible and
+ * NothrowSwappable, and that its move assignment is declared \c noexcept.
+ */
+template<class T>
+CONCEPT NothrowMovable =
+    Movable<T> &&
+    NothrowMoveConstructible<T> &&
+    std::is_nothrow_assignable_v<detected_t<ops::lreference, T>, T> &&
+    NothrowSwappable<T>;
+
 } // namespace concepts
 
 #endif //DETAIL_MOVABLE_H
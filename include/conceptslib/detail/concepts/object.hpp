@@ -30,6 +30,21 @@ CONCEPT Copyable =
     Movable<T> &&
     Assignable<detected_t<ops::lreference, T>, detected_t<ops::clreference, T>>;
 
+/* --- Concept NothrowCopyable --- */
+/**
+ * @concept Specifies that an object of a type can be copied, moved, and swapped
+ * without throwing
+ * @details Specifies that T is Copyable and NothrowMovable, and that its copy
+ * constructor and copy assignment are declared \c noexcept.
+ */
+template<class T>
+CONCEPT NothrowCopyable =
+    Copyable<T> &&
+    NothrowMovable<T> &&
+    std::is_nothrow_constructible_v<T, detected_t<ops::clreference, T>> &&
+    std::is_nothrow_assignable_v<detected_t<ops::lreference, T>
+                                ,detected_t<ops::clreference, T>>;
+
 /* --- Concept Semiregular --- */
 /**
  * @concept Specifies that an object of a type can be copied, moved, swapped,
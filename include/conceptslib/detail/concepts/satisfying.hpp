@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_SATISFYING_H
+#define DETAIL_SATISFYING_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/callable.hpp>
+#include <conceptslib/detail/type_traits/list.hpp>
+
+/**
+ * Define the class template Name<Ts...>, whose value is Concept<Ts...>.
+ * @details Concepts are variable templates, which cannot be template
+ * arguments: their predicate form can, to \c satisfying and
+ * \c first_satisfying.
+ */
+#define CONCEPT_PREDICATE(Name, Concept) \
+    template<class... Ts> \
+    struct Name: std::bool_constant<Concept<Ts...>> { }
+
+namespace concepts
+{
+/// Predicate form of the concept Invocable
+CONCEPT_PREDICATE(invocable, Invocable);
+
+/// Predicate form of the concept RegularInvocable
+CONCEPT_PREDICATE(regular_invocable, RegularInvocable);
+
+namespace detail
+{
+// Indices of the types T of Ts for which Concept<T, Args...> holds. Each one
+// is checked once, in a single pack expansion.
+template<template<class...> class Concept, class List, class... Args>
+struct satisfying_indices;
+
+template<template<class...> class Concept, class... Ts, class... Args>
+struct satisfying_indices<Concept, traits::list<Ts...>, Args...>
+    : traits::detail::kept<static_cast<bool>(Concept<Ts, Args...>::value)...>
+{ };
+
+template<class Indices, class Ks>
+struct as_index_sequence;
+
+template<class Indices, std::size_t... Ks>
+struct as_index_sequence<Indices, std::index_sequence<Ks...>>
+{
+    using type = std::index_sequence<Indices::value[Ks]...>;
+};
+
+} // namespace detail
+
+/* --- Metafunction satisfying --- */
+/**
+ * @metafunction Types T of the list L which satisfy Concept<T, Args...>
+ * @details Concept is the predicate form of a concept (see
+ * \c CONCEPT_PREDICATE). \c type is the sub-list of those types, in their
+ * order in L, and \c indices their indices in L, as a \c std::index_sequence.
+ */
+template<template<class...> class Concept, class L, class... Args>
+struct satisfying;
+
+template<template<class...> class Concept, class... Ts, class... Args>
+struct satisfying<Concept, traits::list<Ts...>, Args...>
+{
+private:
+    using found =
+        detail::satisfying_indices<Concept, traits::list<Ts...>, Args...>;
+
+public:
+    using type = traits::detail::pick_t<found, Ts...>;
+    using indices = typename detail::as_index_sequence<
+        found, std::make_index_sequence<found::value.size()>>::type;
+};
+
+template<template<class...> class Concept, class L, class... Args>
+using satisfying_t = typename satisfying<Concept, L, Args...>::type;
+
+/* --- Metafunction first_satisfying --- */
+/**
+ * @metafunction Index of the first type T of the list L which satisfies
+ * Concept<T, Args...>, or the size of L if none does
+ */
+template<template<class...> class Concept, class L, class... Args>
+struct first_satisfying;
+
+template<template<class...> class Concept, class... Ts, class... Args>
+struct first_satisfying<Concept, traits::list<Ts...>, Args...>
+    : std::integral_constant<std::size_t, traits::detail::first_true<
+          static_cast<bool>(Concept<Ts, Args...>::value)...>()>
+{ };
+
+template<template<class...> class Concept, class L, class... Args>
+inline constexpr std::size_t first_satisfying_v =
+    first_satisfying<Concept, L, Args...>::value;
+
+} // namespace concepts
+
+#endif //DETAIL_SATISFYING_H
@@ -0,0 +1,915 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_BTREE_MAP_H
+#define DETAIL_BTREE_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/core.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+#include <conceptslib/detail/concepts/movable.hpp>
+#include <conceptslib/detail/containers/ordered_lookup.hpp>
+#include <conceptslib/detail/containers/small_vector.hpp>
+#include <conceptslib/detail/macros/platform_detection.hpp>
+
+namespace containers
+{
+namespace detail
+{
+/* --- Node storage --- */
+/// Default size, in bytes, of the keys and values of a node of a btree_map
+constexpr std::size_t btree_node_bytes = 4 * CACHE_LINE_BYTES;
+
+/// Uninitialized storage for N objects of type T
+template<class T, std::size_t N>
+class slot_array
+{
+public:
+    T* data() noexcept { return reinterpret_cast<T*>(storage_); }
+
+    const T* data() const noexcept
+    {
+        return reinterpret_cast<const T*>(storage_);
+    }
+
+    T& operator[](std::size_t i) noexcept { return data()[i]; }
+    const T& operator[](std::size_t i) const noexcept { return data()[i]; }
+
+private:
+    alignas(T) unsigned char storage_[N * sizeof(T)];
+};
+
+/*
+ * Operations on the first n objects of an array of slots, for types whose
+ * move operations do not throw
+ */
+
+// Insert value at the position i, shifting the objects from i one slot right
+template<class T>
+void slot_insert(T* data, std::size_t n, std::size_t i, T&& value) noexcept
+{
+    if (i == n) {
+        ::new (static_cast<void*>(data + n)) T(std::move(value));
+        return;
+    }
+    ::new (static_cast<void*>(data + n)) T(std::move(data[n - 1]));
+    std::move_backward(data + i, data + n - 1, data + n);
+    data[i] = std::move(value);
+}
+
+// Erase the object at the position i, shifting the next ones one slot left
+template<class T>
+void slot_erase(T* data, std::size_t n, std::size_t i) noexcept
+{
+    std::move(data + i + 1, data + n, data + i);
+    data[n - 1].~T();
+}
+
+/* --- B+ tree nodes --- */
+/*
+ * The elements are stored in the leaves, which are linked in order. Inner
+ * nodes store count separator keys and count + 1 children: the keys of the
+ * child c are not less than the separator c - 1 and less than the separator
+ * c. Every node but the root holds at least half of its capacity.
+ */
+struct btree_node
+{
+    explicit btree_node(bool is_leaf) noexcept
+        : count{0}, leaf{is_leaf}
+    { }
+
+    std::uint16_t count;
+    bool leaf;
+};
+
+template<class K, class V, std::size_t Slots>
+struct btree_leaf: btree_node
+{
+    btree_leaf() noexcept: btree_node(true), prev{nullptr}, next{nullptr}
+    { }
+
+    btree_leaf* prev;
+    btree_leaf* next;
+    slot_array<K, Slots> keys;
+    slot_array<V, Slots> values;
+};
+
+template<class K, std::size_t Slots>
+struct btree_inner: btree_node
+{
+    btree_inner() noexcept: btree_node(false), children{}
+    { }
+
+    slot_array<K, Slots> keys;
+    btree_node* children[Slots + 1];
+};
+
+/* --- Class btree_iterator --- */
+/// Bidirectional iterator over the elements of the leaves of a btree_map
+template<class K, class V, std::size_t Slots, bool Const>
+class btree_iterator
+{
+    using leaf_type = btree_leaf<K, V, Slots>;
+
+    template<class, class, std::size_t, bool>
+    friend class btree_iterator;
+
+public:
+    using value_type = std::pair<K, V>;
+    using reference = map_reference<K, V, Const>;
+    using pointer = arrow_proxy<reference>;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::bidirectional_iterator_tag;
+
+    btree_iterator() noexcept: leaf_{nullptr}, index_{0}
+    { }
+
+    btree_iterator(leaf_type* leaf, std::size_t i) noexcept
+        : leaf_{leaf}, index_{i}
+    { }
+
+    // Iterators convert to iterators to const elements
+    template<bool C = Const, class = std::enable_if_t<C>>
+    btree_iterator(const btree_iterator<K, V, Slots, false>& other) noexcept
+        : leaf_{other.leaf_}, index_{other.index_}
+    { }
+
+    reference operator*() const noexcept
+    {
+        return {leaf_->keys[index_], leaf_->values[index_]};
+    }
+
+    pointer operator->() const noexcept { return pointer(**this); }
+
+    // The end iterator is one past the last element of the last leaf
+    btree_iterator& operator++() noexcept
+    {
+        if (++index_ == leaf_->count && leaf_->next) {
+            leaf_ = leaf_->next;
+            index_ = 0;
+        }
+        return *this;
+    }
+
+    btree_iterator& operator--() noexcept
+    {
+        if (index_ == 0) {
+            leaf_ = leaf_->prev;
+            index_ = leaf_->count;
+        }
+        --index_;
+        return *this;
+    }
+
+    btree_iterator operator++(int) noexcept
+    {
+        auto it = *this;
+        ++*this;
+        return it;
+    }
+
+    btree_iterator operator--(int) noexcept
+    {
+        auto it = *this;
+        --*this;
+        return it;
+    }
+
+    friend bool operator==(const btree_iterator& lhs,
+                           const btree_iterator& rhs) noexcept
+    {
+        return lhs.leaf_ == rhs.leaf_ && lhs.index_ == rhs.index_;
+    }
+
+    friend bool operator!=(const btree_iterator& lhs,
+                           const btree_iterator& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    leaf_type* leaf_;
+    std::size_t index_;
+};
+
+} // namespace detail
+
+/* --- Class btree_map --- */
+/**
+ * Ordered associative container of unique keys, implemented as a B+ tree
+ * whose nodes span a few cache lines.
+ * @details Each node stores many keys contiguously, so a lookup reads a few
+ * cache lines per level of a shallow tree, where std::map follows a pointer
+ * per level of a binary tree. The elements are stored in the leaves, which are
+ * linked in order, so iterating reads memory mostly sequentially. Inserting
+ * and erasing take logarithmic time. The elements are accessed as pairs of
+ * references, std::pair<const K&, V&>. Lookups accept any key type Q which
+ * satisfies \c concepts::StrictTotallyOrderedWith<K, Q>, without converting it
+ * to K.
+ * @tparam K The key type. Must satisfy \c concepts::StrictTotallyOrdered and
+ * \c concepts::CopyConstructible, as inner nodes store copies of keys.
+ * @tparam V The mapped type.
+ * @tparam NodeBytes The size, in bytes, of the keys and values of a leaf, and
+ * of the keys and children of an inner node. Nodes have at least 4 slots.
+ * @attention The move operations of K and V must not throw. Inserting or
+ * erasing elements invalidates every iterator.
+ */
+template<class K, class V, std::size_t NodeBytes = detail::btree_node_bytes>
+class btree_map
+{
+    static_assert(concepts::StrictTotallyOrdered<K>,
+                  "btree_map requires StrictTotallyOrdered keys");
+    static_assert(concepts::CopyConstructible<K>,
+                  "btree_map requires CopyConstructible keys");
+    static_assert(std::is_nothrow_move_constructible_v<K> &&
+                  std::is_nothrow_move_assignable_v<K> &&
+                  std::is_nothrow_move_constructible_v<V> &&
+                  std::is_nothrow_move_assignable_v<V>,
+                  "btree_map requires keys and values which are moved "
+                  "without throwing");
+
+    template<class Q>
+    using if_lookup_t =
+        std::enable_if_t<detail::heterogeneous_lookup_v<K, Q>, int>;
+
+public:
+    /// Maximum number of elements of a leaf
+    static constexpr std::size_t leaf_slots =
+        std::clamp<std::size_t>(NodeBytes / (sizeof(K) + sizeof(V)), 4, 255);
+
+    /// Maximum number of keys of an inner node
+    static constexpr std::size_t inner_slots =
+        std::clamp<std::size_t>(NodeBytes / (sizeof(K) + sizeof(void*)), 4,
+                                255);
+
+private:
+    using node_type = detail::btree_node;
+    using leaf_type = detail::btree_leaf<K, V, leaf_slots>;
+    using inner_type = detail::btree_inner<K, inner_slots>;
+
+    // Splitting a full node leaves both halves with at least these counts
+    static constexpr std::size_t leaf_min = leaf_slots / 2;
+    static constexpr std::size_t inner_min = (inner_slots - 1) / 2;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = detail::map_reference<K, V, false>;
+    using const_reference = detail::map_reference<K, V, true>;
+    using iterator = detail::btree_iterator<K, V, leaf_slots, false>;
+    using const_iterator = detail::btree_iterator<K, V, leaf_slots, true>;
+
+    btree_map() noexcept
+        : root_{nullptr}, first_{nullptr}, last_{nullptr}, size_{0}
+    { }
+
+    template<class InputIt>
+    btree_map(InputIt first, InputIt last): btree_map()
+    {
+        insert(first, last);
+    }
+
+    btree_map(std::initializer_list<value_type> elements)
+        : btree_map(elements.begin(), elements.end())
+    { }
+
+    btree_map(const btree_map& other): btree_map()
+    {
+        for (const auto& element: other) {
+            try_emplace(element.first, element.second);
+        }
+    }
+
+    btree_map(btree_map&& other) noexcept: btree_map()
+    {
+        swap(other);
+    }
+
+    btree_map& operator=(btree_map other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~btree_map()
+    {
+        clear();
+    }
+
+    /* Element access */
+    V& at(const K& key)
+    {
+        return const_cast<V&>(std::as_const(*this).at(key));
+    }
+
+    const V& at(const K& key) const
+    {
+        const auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("btree_map::at: key not found");
+        }
+        return it->second;
+    }
+
+    V& operator[](const K& key) { return try_emplace(key).first->second; }
+
+    V& operator[](K&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    /* Iterators */
+    iterator begin() noexcept { return iterator(first_, 0); }
+    iterator end() noexcept { return iterator(last_, last_count()); }
+    const_iterator begin() const noexcept { return iterator(first_, 0); }
+
+    const_iterator end() const noexcept
+    {
+        return iterator(last_, last_count());
+    }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /* Capacity */
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+
+    /* Modifiers */
+    void clear() noexcept
+    {
+        if (root_) {
+            destroy(root_);
+        }
+        root_ = nullptr;
+        first_ = nullptr;
+        last_ = nullptr;
+        size_ = 0;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& element)
+    {
+        return try_emplace(element.first, element.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& element)
+    {
+        return try_emplace(std::move(element.first),
+                           std::move(element.second));
+    }
+
+    template<class InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        return try_emplace_key(key, std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return try_emplace_key(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const K& key, M&& value)
+    {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    /// Erase the element at pos, returning an iterator to the next element
+    /// @details Takes a second lookup, as erasing may rebalance the tree.
+    iterator erase(const_iterator pos)
+    {
+        std::optional<K> removed;
+        erase_key(pos->first, &removed);
+        return lower_bound(*removed);
+    }
+
+    size_type erase(const K& key)
+    {
+        return erase_key(key, nullptr) ? 1 : 0;
+    }
+
+    void swap(btree_map& other) noexcept
+    {
+        std::swap(root_, other.root_);
+        std::swap(first_, other.first_);
+        std::swap(last_, other.last_);
+        std::swap(size_, other.size_);
+    }
+
+    friend void swap(btree_map& lhs, btree_map& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    /* Lookup */
+    iterator find(const K& key) { return find_key(key); }
+    const_iterator find(const K& key) const { return find_key(key); }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    iterator find(const Q& key) { return find_key(key); }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    const_iterator find(const Q& key) const { return find_key(key); }
+
+    bool contains(const K& key) const { return find(key) != end(); }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    bool contains(const Q& key) const { return find(key) != end(); }
+
+    size_type count(const K& key) const { return contains(key) ? 1 : 0; }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    size_type count(const Q& key) const { return contains(key) ? 1 : 0; }
+
+    /// First element whose key is not less than key
+    iterator lower_bound(const K& key) { return lower_bound_key(key); }
+
+    const_iterator lower_bound(const K& key) const
+    {
+        return lower_bound_key(key);
+    }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    iterator lower_bound(const Q& key) { return lower_bound_key(key); }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    const_iterator lower_bound(const Q& key) const
+    {
+        return lower_bound_key(key);
+    }
+
+    /// First element whose key is greater than key
+    iterator upper_bound(const K& key) { return upper_bound_key(key); }
+
+    const_iterator upper_bound(const K& key) const
+    {
+        return upper_bound_key(key);
+    }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    iterator upper_bound(const Q& key) { return upper_bound_key(key); }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    const_iterator upper_bound(const Q& key) const
+    {
+        return upper_bound_key(key);
+    }
+
+    std::pair<iterator, iterator> equal_range(const K& key)
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    std::pair<iterator, iterator> equal_range(const Q& key)
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    std::pair<const_iterator, const_iterator> equal_range(const Q& key) const
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    /* Comparison */
+    template<class U = V
+            ,class = std::enable_if_t<concepts::EqualityComparable<U>>>
+    friend bool operator==(const btree_map& lhs, const btree_map& rhs)
+    {
+        return lhs.size_ == rhs.size_ &&
+               std::equal(lhs.begin(), lhs.end(), rhs.begin(),
+                          [](const_reference l, const_reference r) {
+                              return l.first == r.first &&
+                                     l.second == r.second;
+                          });
+    }
+
+    template<class U = V
+            ,class = std::enable_if_t<concepts::EqualityComparable<U>>>
+    friend bool operator!=(const btree_map& lhs, const btree_map& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    static leaf_type* as_leaf(node_type* node) noexcept
+    {
+        return static_cast<leaf_type*>(node);
+    }
+
+    static inner_type* as_inner(node_type* node) noexcept
+    {
+        return static_cast<inner_type*>(node);
+    }
+
+    static bool full(const node_type* node) noexcept
+    {
+        return node->count == (node->leaf ? leaf_slots : inner_slots);
+    }
+
+    static bool underfull(const node_type* node) noexcept
+    {
+        return node->count < (node->leaf ? leaf_min : inner_min);
+    }
+
+    size_type last_count() const noexcept { return last_ ? last_->count : 0; }
+
+    /* Lookup */
+    // Leaf whose range of keys contains key
+    template<class Q>
+    leaf_type* find_leaf(const Q& key) const
+    {
+        node_type* node = root_;
+        while (!node->leaf) {
+            inner_type* inner = as_inner(node);
+            node = inner->children[detail::upper_bound_index(
+                inner->keys.data(), inner->count, key)];
+        }
+        return as_leaf(node);
+    }
+
+    // Iterator to the position i of leaf, which may be one past its end
+    iterator make_iterator(leaf_type* leaf, size_type i) const noexcept
+    {
+        if (i == leaf->count && leaf->next) {
+            return iterator(leaf->next, 0);
+        }
+        return iterator(leaf, i);
+    }
+
+    template<class Q>
+    iterator find_key(const Q& key) const
+    {
+        if (!root_) {
+            return iterator();
+        }
+        leaf_type* leaf = find_leaf(key);
+        const size_type i =
+            detail::lower_bound_index(leaf->keys.data(), leaf->count, key);
+        if (i == leaf->count || key < leaf->keys[i]) {
+            return iterator(last_, last_count());
+        }
+        return iterator(leaf, i);
+    }
+
+    template<class Q>
+    iterator lower_bound_key(const Q& key) const
+    {
+        if (!root_) {
+            return iterator();
+        }
+        leaf_type* leaf = find_leaf(key);
+        return make_iterator(leaf, detail::lower_bound_index(
+                                       leaf->keys.data(), leaf->count, key));
+    }
+
+    template<class Q>
+    iterator upper_bound_key(const Q& key) const
+    {
+        if (!root_) {
+            return iterator();
+        }
+        leaf_type* leaf = find_leaf(key);
+        return make_iterator(leaf, detail::upper_bound_index(
+                                       leaf->keys.data(), leaf->count, key));
+    }
+
+    /* Insertion */
+    /*
+     * Full nodes are split on the way down, before the element is
+     * constructed: if that throws, the tree is valid and holds the same
+     * elements.
+     */
+    template<class Key, class... Args>
+    std::pair<iterator, bool> try_emplace_key(Key&& key, Args&&... args)
+    {
+        if (!root_) {
+            root_ = first_ = last_ = new leaf_type;
+        }
+        if (full(root_)) {
+            auto* root = new inner_type;
+            root->children[0] = root_;
+            try {
+                split_child(root, 0);
+            } catch (...) {
+                delete root;
+                throw;
+            }
+            root_ = root;
+        }
+
+        node_type* node = root_;
+        while (!node->leaf) {
+            inner_type* inner = as_inner(node);
+            size_type c = detail::upper_bound_index(inner->keys.data(),
+                                                    inner->count, key);
+            if (full(inner->children[c])) {
+                split_child(inner, c);
+                c += !(key < inner->keys[c]);
+            }
+            node = inner->children[c];
+        }
+
+        leaf_type* leaf = as_leaf(node);
+        const size_type i =
+            detail::lower_bound_index(leaf->keys.data(), leaf->count, key);
+        if (i != leaf->count && !(key < leaf->keys[i])) {
+            return {iterator(leaf, i), false};
+        }
+        K new_key(std::forward<Key>(key));
+        V new_value(std::forward<Args>(args)...);
+        detail::slot_insert(leaf->keys.data(), leaf->count, i,
+                            std::move(new_key));
+        detail::slot_insert(leaf->values.data(), leaf->count, i,
+                            std::move(new_value));
+        ++leaf->count;
+        ++size_;
+        return {iterator(leaf, i), true};
+    }
+
+    // Split the full child c of parent, which is not full, in two halves
+    void split_child(inner_type* parent, size_type c)
+    {
+        node_type* child = parent->children[c];
+        node_type* right;
+        const size_type m = child->count / 2;
+        if (child->leaf) {
+            leaf_type* left = as_leaf(child);
+            K separator(left->keys[m]);
+            auto* next = new leaf_type;
+
+            const size_type moved = left->count - m;
+            detail::relocate(left->keys.data() + m, moved, next->keys.data());
+            detail::relocate(left->values.data() + m, moved,
+                             next->values.data());
+            next->count = static_cast<std::uint16_t>(moved);
+            left->count = static_cast<std::uint16_t>(m);
+
+            next->prev = left;
+            next->next = left->next;
+            (left->next ? left->next->prev : last_) = next;
+            left->next = next;
+            detail::slot_insert(parent->keys.data(), parent->count, c,
+                                std::move(separator));
+            right = next;
+        } else {
+            inner_type* left = as_inner(child);
+            auto* next = new inner_type;
+            const size_type moved = left->count - m - 1;
+            detail::relocate(left->keys.data() + m + 1, moved,
+                             next->keys.data());
+            std::copy(left->children + m + 1, left->children + left->count + 1,
+                      next->children);
+            next->count = static_cast<std::uint16_t>(moved);
+
+            detail::slot_insert(parent->keys.data(), parent->count, c,
+                                std::move(left->keys[m]));
+            left->keys[m].~K();
+            left->count = static_cast<std::uint16_t>(m);
+            right = next;
+        }
+        std::copy_backward(parent->children + c + 1,
+                           parent->children + parent->count + 1,
+                           parent->children + parent->count + 2);
+        parent->children[c + 1] = right;
+        ++parent->count;
+    }
+
+    /* Erasure */
+    // If removed is not null, the erased key is moved to it
+    template<class Q>
+    bool erase_key(const Q& key, std::optional<K>* removed)
+    {
+        if (!root_ || !erase_from(root_, key, removed)) {
+            return false;
+        }
+        if (root_->count == 0) {
+            node_type* root = root_;
+            if (root->leaf) {
+                root_ = first_ = last_ = nullptr;
+                delete as_leaf(root);
+            } else {
+                root_ = as_inner(root)->children[0];
+                delete as_inner(root);
+            }
+        }
+        return true;
+    }
+
+    template<class Q>
+    bool erase_from(node_type* node, const Q& key, std::optional<K>* removed)
+    {
+        if (node->leaf) {
+            leaf_type* leaf = as_leaf(node);
+            const size_type i = detail::lower_bound_index(leaf->keys.data(),
+                                                          leaf->count, key);
+            if (i == leaf->count || key < leaf->keys[i]) {
+                return false;
+            }
+            if (removed) {
+                removed->emplace(std::move(leaf->keys[i]));
+            }
+            detail::slot_erase(leaf->keys.data(), leaf->count, i);
+            detail::slot_erase(leaf->values.data(), leaf->count, i);
+            --leaf->count;
+            --size_;
+            return true;
+        }
+        inner_type* inner = as_inner(node);
+        const size_type c =
+            detail::upper_bound_index(inner->keys.data(), inner->count, key);
+        if (!erase_from(inner->children[c], key, removed)) {
+            return false;
+        }
+        if (underfull(inner->children[c])) {
+            rebalance(inner, c);
+        }
+        return true;
+    }
+
+    // Refill the underfull child c of parent from a sibling, or merge them
+    void rebalance(inner_type* parent, size_type c)
+    {
+        const auto spare = [](const node_type* node) {
+            return node->count > (node->leaf ? leaf_min : inner_min);
+        };
+        if (c > 0 && spare(parent->children[c - 1])) {
+            borrow_from_left(parent, c);
+        } else if (c < parent->count && spare(parent->children[c + 1])) {
+            borrow_from_right(parent, c);
+        } else if (c > 0) {
+            merge_children(parent, c - 1);
+        } else {
+            merge_children(parent, c);
+        }
+    }
+
+    void borrow_from_left(inner_type* parent, size_type c)
+    {
+        node_type* child = parent->children[c];
+        node_type* sibling = parent->children[c - 1];
+        const size_type last = sibling->count - 1u;
+        if (child->leaf) {
+            leaf_type* to = as_leaf(child);
+            leaf_type* from = as_leaf(sibling);
+            K separator(from->keys[last]);
+            detail::slot_insert(to->keys.data(), to->count, 0,
+                                std::move(from->keys[last]));
+            detail::slot_insert(to->values.data(), to->count, 0,
+                                std::move(from->values[last]));
+            from->keys[last].~K();
+            from->values[last].~V();
+            parent->keys[c - 1] = std::move(separator);
+        } else {
+            inner_type* to = as_inner(child);
+            inner_type* from = as_inner(sibling);
+            detail::slot_insert(to->keys.data(), to->count, 0,
+                                std::move(parent->keys[c - 1]));
+            std::copy_backward(to->children, to->children + to->count + 1,
+                               to->children + to->count + 2);
+            to->children[0] = from->children[from->count];
+            parent->keys[c - 1] = std::move(from->keys[last]);
+            from->keys[last].~K();
+        }
+        ++child->count;
+        --sibling->count;
+    }
+
+    void borrow_from_right(inner_type* parent, size_type c)
+    {
+        node_type* child = parent->children[c];
+        node_type* sibling = parent->children[c + 1];
+        if (child->leaf) {
+            leaf_type* to = as_leaf(child);
+            leaf_type* from = as_leaf(sibling);
+            K separator(from->keys[1]);
+            detail::slot_insert(to->keys.data(), to->count, to->count,
+                                std::move(from->keys[0]));
+            detail::slot_insert(to->values.data(), to->count, to->count,
+                                std::move(from->values[0]));
+            detail::slot_erase(from->keys.data(), from->count, 0);
+            detail::slot_erase(from->values.data(), from->count, 0);
+            parent->keys[c] = std::move(separator);
+        } else {
+            inner_type* to = as_inner(child);
+            inner_type* from = as_inner(sibling);
+            detail::slot_insert(to->keys.data(), to->count, to->count,
+                                std::move(parent->keys[c]));
+            to->children[to->count + 1] = from->children[0];
+            parent->keys[c] = std::move(from->keys[0]);
+            detail::slot_erase(from->keys.data(), from->count, 0);
+            std::copy(from->children + 1, from->children + from->count + 1,
+                      from->children);
+        }
+        ++child->count;
+        --sibling->count;
+    }
+
+    // Merge the child c + 1 of parent into the child c
+    void merge_children(inner_type* parent, size_type c)
+    {
+        node_type* left = parent->children[c];
+        node_type* right = parent->children[c + 1];
+        if (left->leaf) {
+            leaf_type* to = as_leaf(left);
+            leaf_type* from = as_leaf(right);
+            detail::relocate(from->keys.data(), from->count,
+                             to->keys.data() + to->count);
+            detail::relocate(from->values.data(), from->count,
+                             to->values.data() + to->count);
+            to->count = static_cast<std::uint16_t>(to->count + from->count);
+            to->next = from->next;
+            (from->next ? from->next->prev : last_) = to;
+            delete from;
+        } else {
+            inner_type* to = as_inner(left);
+            inner_type* from = as_inner(right);
+            ::new (static_cast<void*>(to->keys.data() + to->count))
+                K(std::move(parent->keys[c]));
+            detail::relocate(from->keys.data(), from->count,
+                             to->keys.data() + to->count + 1);
+            std::copy(from->children, from->children + from->count + 1,
+                      to->children + to->count + 1);
+            to->count =
+                static_cast<std::uint16_t>(to->count + 1 + from->count);
+            delete from;
+        }
+        detail::slot_erase(parent->keys.data(), parent->count, c);
+        std::copy(parent->children + c + 2,
+                  parent->children + parent->count + 1,
+                  parent->children + c + 1);
+        --parent->count;
+    }
+
+    // Destroy the elements and free the nodes of the subtree of node
+    static void destroy(node_type* node) noexcept
+    {
+        if (node->leaf) {
+            leaf_type* leaf = as_leaf(node);
+            std::destroy_n(leaf->keys.data(), leaf->count);
+            std::destroy_n(leaf->values.data(), leaf->count);
+            delete leaf;
+        } else {
+            inner_type* inner = as_inner(node);
+            std::destroy_n(inner->keys.data(), inner->count);
+            for (size_type c = 0; c <= inner->count; ++c) {
+                destroy(inner->children[c]);
+            }
+            delete inner;
+        }
+    }
+
+    node_type* root_;
+    leaf_type* first_;
+    leaf_type* last_;
+    size_type size_;
+};
+
+} // namespace containers
+
+#endif //DETAIL_BTREE_MAP_H
@@ -0,0 +1,512 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_DARY_HEAP_H
+#define DETAIL_DARY_HEAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/core.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+#include <conceptslib/detail/concepts/callable.hpp>
+#include <conceptslib/detail/concepts/movable.hpp>
+#include <conceptslib/detail/functional/invoke.hpp>
+#include <conceptslib/detail/macros/platform_detection.hpp>
+
+namespace containers
+{
+namespace detail
+{
+/* --- Heap algorithms --- */
+/*
+ * The heap algorithms operate on the array data of n elements, in which the
+ * children of the element i are the elements D * i + 1 to D * i + D. less(a, b)
+ * is true if a has lower priority than b. moved(i) is invoked whenever an
+ * element is moved to the position i. If less throws, the element taken out
+ * of the array is moved back to the hole, so no element is lost (unless a move
+ * throws too), but the elements may no longer be in heap order.
+ */
+
+// Move the element i towards the root until its parent has no lower priority
+template<std::size_t D, class T, class Less, class Moved>
+void sift_up(T* data, std::size_t i, Less& less, Moved moved)
+{
+    T value = std::move(data[i]);
+    try {
+        while (i > 0) {
+            const std::size_t parent = (i - 1) / D;
+            if (!less(data[parent], value)) {
+                break;
+            }
+            data[i] = std::move(data[parent]);
+            moved(i);
+            i = parent;
+        }
+    } catch (...) {
+        data[i] = std::move(value);
+        moved(i);
+        throw;
+    }
+    data[i] = std::move(value);
+    moved(i);
+}
+
+// Child of i with the highest priority, from the children first to last
+template<std::size_t D, class T, class Less>
+std::size_t top_child(const T* data, std::size_t first, std::size_t last,
+                      Less& less)
+{
+    std::size_t top = first;
+    if (last - first == D) {
+        // All the children are present: the loop has a constant trip count
+        for (std::size_t c = first + 1; c < first + D; ++c) {
+            top = less(data[top], data[c]) ? c : top;
+        }
+    } else {
+        for (std::size_t c = first + 1; c < last; ++c) {
+            top = less(data[top], data[c]) ? c : top;
+        }
+    }
+    return top;
+}
+
+// Move the element i towards the leaves until no child has higher priority
+template<std::size_t D, class T, class Less, class Moved>
+void sift_down(T* data, std::size_t n, std::size_t i, Less& less, Moved moved)
+{
+    T value = std::move(data[i]);
+    try {
+        for (;;) {
+            const std::size_t first = D * i + 1;
+            if (first >= n) {
+                break;
+            }
+            const std::size_t top =
+                top_child<D>(data, first, std::min(first + D, n), less);
+            if (!less(value, data[top])) {
+                break;
+            }
+            data[i] = std::move(data[top]);
+            moved(i);
+            i = top;
+        }
+    } catch (...) {
+        data[i] = std::move(value);
+        moved(i);
+        throw;
+    }
+    data[i] = std::move(value);
+    moved(i);
+}
+
+/*
+ * Remove the root of the heap of n elements, leaving the heap in the first
+ * n - 1 elements: the hole at the root is moved down to a leaf along the
+ * children of highest priority, and the last element is sifted up from there.
+ * The last element usually belongs near the leaves, so this takes fewer
+ * comparisons than sifting it down from the root. If less throws, the root is
+ * removed all the same: the caller must still drop the last element.
+ */
+template<std::size_t D, class T, class Less, class Moved>
+void pop_heap(T* data, std::size_t n, Less& less, Moved moved)
+{
+    const std::size_t last = n - 1;
+    std::size_t i = 0;
+    try {
+        for (;;) {
+            const std::size_t first = D * i + 1;
+            if (first >= last) {
+                break;
+            }
+            const std::size_t top =
+                top_child<D>(data, first, std::min(first + D, last), less);
+            data[i] = std::move(data[top]);
+            moved(i);
+            i = top;
+        }
+    } catch (...) {
+        if (i != last) {
+            data[i] = std::move(data[last]);
+            moved(i);
+        }
+        throw;
+    }
+    if (i != last) {
+        data[i] = std::move(data[last]);
+        sift_up<D>(data, i, less, moved);
+    }
+}
+
+// Build a heap from n arbitrary elements in O(n), sifting down every parent
+template<std::size_t D, class T, class Less, class Moved>
+void make_heap(T* data, std::size_t n, Less& less, Moved moved)
+{
+    if (n < 2) {
+        return;
+    }
+    for (std::size_t i = (n - 2) / D + 1; i-- > 0;) {
+        sift_down<D>(data, n, i, less, moved);
+    }
+}
+
+struct no_op
+{
+    constexpr void operator()(std::size_t) const noexcept { }
+};
+
+template<class Compare>
+class priority_less
+{
+public:
+    explicit priority_less(const Compare& comp): comp_(comp)
+    { }
+
+    template<class T>
+    bool operator()(const T& lhs, const T& rhs)
+    {
+        return functional::invoke(comp_, lhs, rhs);
+    }
+
+    const Compare& compare() const noexcept { return comp_; }
+
+private:
+    Compare comp_;
+};
+
+} // namespace detail
+
+/* --- Variable template cache_line_arity_v --- */
+/**
+ * Default arity of a dary_heap<T>: the number of T which fit in a cache line,
+ * at least 2 and at most 4
+ * @details The children of a node then span at most one cache line. Beyond 4
+ * children, comparing them costs more than the shallower tree saves.
+ */
+template<class T>
+inline constexpr std::size_t cache_line_arity_v =
+    std::clamp<std::size_t>(CACHE_LINE_BYTES / sizeof(T), 2, 4);
+
+/* --- Class dary_heap --- */
+/**
+ * Priority queue implemented as a D-ary heap: a complete tree, stored in an
+ * array, whose nodes have D children.
+ * @details As std::priority_queue, top() is the element with the highest
+ * priority, the one for which comp(x, top()) is true for no other element x:
+ * with std::less, the greatest element. A larger arity makes the tree
+ * shallower, so push is faster and pop, which compares the D children of each
+ * node on the path to a leaf, touches fewer cache lines. pop moves the hole
+ * left by the top down to a leaf, and sifts the last element up from there.
+ * Building from a range takes linear time.
+ * @tparam T The element type. Must satisfy \c concepts::Movable.
+ * @tparam D The number of children of each node, at least 2.
+ * @tparam Compare Must satisfy \c concepts::StrictWeakOrder on T.
+ * @attention If a comparison throws, the elements are kept but may no longer
+ * be in heap order, except that pop still removes the top. This assumes that
+ * the moves of T do not throw.
+ */
+template<class T
+        ,std::size_t D = cache_line_arity_v<T>
+        ,class Compare = std::less<T>>
+class dary_heap
+{
+    static_assert(D >= 2, "dary_heap requires an arity of at least 2");
+    static_assert(concepts::Movable<T>,
+                  "dary_heap requires a Movable element type");
+    static_assert(concepts::StrictWeakOrder<Compare&, const T&, const T&>,
+                  "dary_heap requires a StrictWeakOrder on its elements");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using value_compare = Compare;
+    using const_reference = const T&;
+
+    /// Number of children of each node
+    static constexpr size_type arity = D;
+
+    dary_heap(): dary_heap(Compare{})
+    { }
+
+    explicit dary_heap(const Compare& comp): less_(comp)
+    { }
+
+    /// Heap of the elements of [first, last), built in linear time
+    template<class InputIt>
+    dary_heap(InputIt first, InputIt last, const Compare& comp = Compare{})
+        : data_(first, last), less_(comp)
+    {
+        detail::make_heap<D>(data_.data(), data_.size(), less_,
+                             detail::no_op{});
+    }
+
+    /* Element access */
+    const_reference top() const noexcept { return data_.front(); }
+
+    /* Capacity */
+    bool empty() const noexcept { return data_.empty(); }
+    size_type size() const noexcept { return data_.size(); }
+    void reserve(size_type n) { data_.reserve(n); }
+
+    /* Modifiers */
+    void push(const T& value) { emplace(value); }
+    void push(T&& value) { emplace(std::move(value)); }
+
+    template<class... Args>
+    void emplace(Args&&... args)
+    {
+        data_.emplace_back(std::forward<Args>(args)...);
+        detail::sift_up<D>(data_.data(), data_.size() - 1, less_,
+                           detail::no_op{});
+    }
+
+    /// Add the elements of [first, last), rebuilding the heap if that is
+    /// cheaper than pushing them one by one
+    template<class InputIt>
+    void push_range(InputIt first, InputIt last)
+    {
+        const size_type old_size = data_.size();
+        data_.insert(data_.end(), first, last);
+        const size_type added = data_.size() - old_size;
+        if (added > old_size) {
+            detail::make_heap<D>(data_.data(), data_.size(), less_,
+                                 detail::no_op{});
+        } else {
+            for (size_type i = old_size; i < data_.size(); ++i) {
+                detail::sift_up<D>(data_.data(), i, less_, detail::no_op{});
+            }
+        }
+    }
+
+    void pop()
+    {
+        try {
+            detail::pop_heap<D>(data_.data(), data_.size(), less_,
+                                detail::no_op{});
+        } catch (...) {
+            data_.pop_back();
+            throw;
+        }
+        data_.pop_back();
+    }
+
+    /// Replace the top element with value: a pop followed by a push which
+    /// sifts only once
+    void replace_top(T value)
+    {
+        data_.front() = std::move(value);
+        detail::sift_down<D>(data_.data(), data_.size(), 0, less_,
+                             detail::no_op{});
+    }
+
+    void clear() noexcept { data_.clear(); }
+
+    value_compare value_comp() const { return less_.compare(); }
+
+private:
+    std::vector<T> data_;
+    detail::priority_less<Compare> less_;
+};
+
+/* --- Class indexed_dary_heap --- */
+/**
+ * D-ary heap of the priorities of keys 0 to n - 1, which supports changing
+ * the priority of a key, as Dijkstra's and Prim's algorithms need.
+ * @details Each key is in the heap at most once. The heap stores the
+ * priorities with their keys, so sifting does not follow indirections, and a
+ * table maps each key to its position in the heap. Priorities are ordered as
+ * in dary_heap: top() is the priority of highest priority, with std::greater
+ * the smallest one.
+ * @tparam T The priority type. Must satisfy \c concepts::Movable.
+ * @tparam D The number of children of each node, at least 2.
+ * @tparam Compare Must satisfy \c concepts::StrictWeakOrder on T.
+ * @attention If a comparison throws, the keys and the positions recorded for
+ * them are kept, as in dary_heap, but may no longer be in heap order.
+ */
+template<class T
+        ,std::size_t D = cache_line_arity_v<std::pair<T, std::size_t>>
+        ,class Compare = std::less<T>>
+class indexed_dary_heap
+{
+    static_assert(D >= 2, "indexed_dary_heap requires an arity of at least 2");
+    static_assert(concepts::Movable<T>,
+                  "indexed_dary_heap requires a Movable priority type");
+    static_assert(concepts::StrictWeakOrder<Compare&, const T&, const T&>,
+                  "indexed_dary_heap requires a StrictWeakOrder on its "
+                  "priorities");
+
+    struct entry
+    {
+        T priority;
+        std::size_t key;
+    };
+
+    // Orders entries by priority
+    class entry_less
+    {
+    public:
+        explicit entry_less(const Compare& comp): less_(comp)
+        { }
+
+        bool operator()(const entry& lhs, const entry& rhs)
+        {
+            return less_(lhs.priority, rhs.priority);
+        }
+
+        bool operator()(const T& lhs, const T& rhs)
+        {
+            return less_(lhs, rhs);
+        }
+
+        const Compare& compare() const noexcept { return less_.compare(); }
+
+    private:
+        detail::priority_less<Compare> less_;
+    };
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using key_type = std::size_t;
+    using value_compare = Compare;
+    using const_reference = const T&;
+
+    /// Position of the keys which are not in the heap
+    static constexpr size_type npos = std::numeric_limits<size_type>::max();
+
+    /// Number of children of each node
+    static constexpr size_type arity = D;
+
+    /// Empty heap of the keys 0 to keys - 1
+    explicit indexed_dary_heap(size_type keys,
+                               const Compare& comp = Compare{})
+        : positions_(keys, npos), less_(comp)
+    { }
+
+    /// Heap in which the key i has the priority first[i], built in linear
+    /// time
+    template<class ForwardIt>
+    indexed_dary_heap(ForwardIt first, ForwardIt last,
+                      const Compare& comp = Compare{})
+        : positions_(static_cast<size_type>(std::distance(first, last)))
+        , less_(comp)
+    {
+        data_.reserve(positions_.size());
+        for (; first != last; ++first) {
+            positions_[data_.size()] = data_.size();
+            data_.push_back(entry{*first, data_.size()});
+        }
+        detail::make_heap<D>(data_.data(), data_.size(), less_, moved());
+    }
+
+    /* Element access */
+    /// Priority of highest priority
+    const_reference top() const noexcept { return data_.front().priority; }
+
+    /// Key of the priority of highest priority
+    key_type top_key() const noexcept { return data_.front().key; }
+
+    /// Priority of key, which must be in the heap
+    const_reference priority(key_type key) const noexcept
+    {
+        return data_[positions_[key]].priority;
+    }
+
+    bool contains(key_type key) const noexcept
+    {
+        return positions_[key] != npos;
+    }
+
+    /* Capacity */
+    bool empty() const noexcept { return data_.empty(); }
+    size_type size() const noexcept { return data_.size(); }
+
+    /// Number of keys: the keys are 0 to key_count() - 1
+    size_type key_count() const noexcept { return positions_.size(); }
+
+    /* Modifiers */
+    /// Add key, which must not be in the heap, with the priority value
+    void push(key_type key, T value)
+    {
+        data_.push_back(entry{std::move(value), key});
+        detail::sift_up<D>(data_.data(), data_.size() - 1, less_, moved());
+    }
+
+    /**
+     * Raise the priority of key, which must be in the heap, to value
+     * @details value must not have lower priority than the current one of
+     * key: with std::greater, value must not be greater than it.
+     */
+    void decrease_key(key_type key, T value)
+    {
+        const size_type i = positions_[key];
+        data_[i].priority = std::move(value);
+        detail::sift_up<D>(data_.data(), i, less_, moved());
+    }
+
+    /// Set the priority of key to value, adding key if it is not in the heap
+    void update(key_type key, T value)
+    {
+        if (!contains(key)) {
+            push(key, std::move(value));
+            return;
+        }
+        const size_type i = positions_[key];
+        const bool raised = less_(data_[i].priority, value);
+        data_[i].priority = std::move(value);
+        if (raised) {
+            detail::sift_up<D>(data_.data(), i, less_, moved());
+        } else {
+            detail::sift_down<D>(data_.data(), data_.size(), i, less_,
+                                 moved());
+        }
+    }
+
+    void pop()
+    {
+        positions_[data_.front().key] = npos;
+        try {
+            detail::pop_heap<D>(data_.data(), data_.size(), less_, moved());
+        } catch (...) {
+            data_.pop_back();
+            throw;
+        }
+        data_.pop_back();
+    }
+
+    void clear() noexcept
+    {
+        for (const entry& e: data_) {
+            positions_[e.key] = npos;
+        }
+        data_.clear();
+    }
+
+    value_compare value_comp() const { return less_.compare(); }
+
+private:
+    // Records the position of the entries moved by the heap algorithms
+    auto moved() noexcept
+    {
+        return [this](size_type i) { positions_[data_[i].key] = i; };
+    }
+
+    std::vector<entry> data_;
+    std::vector<size_type> positions_;
+    entry_less less_;
+};
+
+} // namespace containers
+
+#endif //DETAIL_DARY_HEAP_H
@@ -0,0 +1,657 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_FLAT_MAP_H
+#define DETAIL_FLAT_MAP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+#include <conceptslib/detail/concepts/movable.hpp>
+#include <conceptslib/detail/containers/ordered_lookup.hpp>
+
+namespace containers
+{
+namespace detail
+{
+/* --- Class bool_vector --- */
+/**
+ * Vector of bools which stores them as bool objects, unlike std::vector<bool>
+ * @details The flat containers hand out pointers to and references to their
+ * elements, which the bit packing of std::vector<bool> does not allow. Only
+ * the part of the interface of std::vector that they use is provided.
+ */
+class bool_vector
+{
+public:
+    using value_type = bool;
+    using size_type = std::size_t;
+    using iterator = bool*;
+    using const_iterator = const bool*;
+
+    bool_vector() = default;
+
+    bool_vector(const bool_vector& other)
+        : data_{other.size_ ? new bool[other.size_] : nullptr}
+        , size_{other.size_}, capacity_{other.size_}
+    {
+        std::copy(other.begin(), other.end(), begin());
+    }
+
+    bool_vector(bool_vector&& other) noexcept { swap(other); }
+
+    bool_vector& operator=(bool_vector other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    bool& operator[](size_type i) noexcept { return data_[i]; }
+    const bool& operator[](size_type i) const noexcept { return data_[i]; }
+    bool& back() noexcept { return data_[size_ - 1]; }
+    const bool& back() const noexcept { return data_[size_ - 1]; }
+    bool* data() noexcept { return data_.get(); }
+    const bool* data() const noexcept { return data_.get(); }
+
+    iterator begin() noexcept { return data(); }
+    iterator end() noexcept { return data() + size_; }
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator end() const noexcept { return data() + size_; }
+
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+
+    void reserve(size_type n)
+    {
+        if (n > capacity_) {
+            std::unique_ptr<bool[]> data(new bool[n]);
+            std::copy(begin(), end(), data.get());
+            data_ = std::move(data);
+            capacity_ = n;
+        }
+    }
+
+    void clear() noexcept { size_ = 0; }
+
+    template<class... Args>
+    bool& emplace_back(Args&&... args)
+    {
+        return *emplace(end(), std::forward<Args>(args)...);
+    }
+
+    void push_back(bool value) { emplace_back(value); }
+    void pop_back() noexcept { --size_; }
+
+    template<class... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        const auto i = static_cast<size_type>(pos - begin());
+        const bool value = bool(std::forward<Args>(args)...);
+        if (size_ == capacity_) {
+            reserve(capacity_ == 0 ? 8 : 2 * capacity_);
+        }
+        std::copy_backward(begin() + i, end(), end() + 1);
+        data_[i] = value;
+        ++size_;
+        return begin() + i;
+    }
+
+    iterator insert(const_iterator pos, bool value)
+    {
+        return emplace(pos, value);
+    }
+
+    iterator erase(const_iterator pos) noexcept
+    {
+        const auto i = static_cast<size_type>(pos - begin());
+        std::copy(begin() + i + 1, end(), begin() + i);
+        --size_;
+        return begin() + i;
+    }
+
+    void swap(bool_vector& other) noexcept
+    {
+        std::swap(data_, other.data_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    friend bool operator==(const bool_vector& lhs, const bool_vector& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend bool operator!=(const bool_vector& lhs, const bool_vector& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    std::unique_ptr<bool[]> data_;
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+};
+
+/// Contiguous storage of the keys or values of the flat containers
+template<class T>
+using dense_vector_t =
+    std::conditional_t<std::is_same_v<T, bool>, bool_vector, std::vector<T>>;
+
+/* --- Class flat_map_iterator --- */
+/// Random access iterator over the keys and values of a flat_map
+template<class K, class V, bool Const>
+class flat_map_iterator
+{
+    using mapped_t = std::conditional_t<Const, const V, V>;
+
+    template<class, class, bool>
+    friend class flat_map_iterator;
+
+public:
+    using value_type = std::pair<K, V>;
+    using reference = map_reference<K, V, Const>;
+    using pointer = arrow_proxy<reference>;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    flat_map_iterator() noexcept: keys_{nullptr}, values_{nullptr}
+    { }
+
+    flat_map_iterator(const K* keys, mapped_t* values) noexcept
+        : keys_{keys}, values_{values}
+    { }
+
+    // Iterators convert to iterators to const elements
+    template<bool C = Const, class = std::enable_if_t<C>>
+    flat_map_iterator(const flat_map_iterator<K, V, false>& other) noexcept
+        : keys_{other.keys_}, values_{other.values_}
+    { }
+
+    reference operator*() const noexcept { return {*keys_, *values_}; }
+    pointer operator->() const noexcept { return pointer(**this); }
+
+    reference operator[](difference_type n) const noexcept
+    {
+        return {keys_[n], values_[n]};
+    }
+
+    flat_map_iterator& operator++() noexcept
+    {
+        ++keys_;
+        ++values_;
+        return *this;
+    }
+
+    flat_map_iterator& operator--() noexcept
+    {
+        --keys_;
+        --values_;
+        return *this;
+    }
+
+    flat_map_iterator operator++(int) noexcept
+    {
+        auto it = *this;
+        ++*this;
+        return it;
+    }
+
+    flat_map_iterator operator--(int) noexcept
+    {
+        auto it = *this;
+        --*this;
+        return it;
+    }
+
+    flat_map_iterator& operator+=(difference_type n) noexcept
+    {
+        keys_ += n;
+        values_ += n;
+        return *this;
+    }
+
+    flat_map_iterator& operator-=(difference_type n) noexcept
+    {
+        return *this += -n;
+    }
+
+    friend flat_map_iterator operator+(flat_map_iterator it,
+                                       difference_type n) noexcept
+    {
+        return it += n;
+    }
+
+    friend flat_map_iterator operator+(difference_type n,
+                                       flat_map_iterator it) noexcept
+    {
+        return it += n;
+    }
+
+    friend flat_map_iterator operator-(flat_map_iterator it,
+                                       difference_type n) noexcept
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const flat_map_iterator& lhs,
+                                     const flat_map_iterator& rhs) noexcept
+    {
+        return lhs.keys_ - rhs.keys_;
+    }
+
+    /* Comparison: iterators of the same map compare their positions */
+    friend bool operator==(const flat_map_iterator& lhs,
+                           const flat_map_iterator& rhs) noexcept
+    {
+        return lhs.keys_ == rhs.keys_;
+    }
+
+    friend bool operator!=(const flat_map_iterator& lhs,
+                           const flat_map_iterator& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const flat_map_iterator& lhs,
+                          const flat_map_iterator& rhs) noexcept
+    {
+        return lhs.keys_ < rhs.keys_;
+    }
+
+    friend bool operator>(const flat_map_iterator& lhs,
+                          const flat_map_iterator& rhs) noexcept
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const flat_map_iterator& lhs,
+                           const flat_map_iterator& rhs) noexcept
+    {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const flat_map_iterator& lhs,
+                           const flat_map_iterator& rhs) noexcept
+    {
+        return !(lhs < rhs);
+    }
+
+private:
+    const K* keys_;
+    mapped_t* values_;
+};
+
+} // namespace detail
+
+/* --- Class flat_map --- */
+/**
+ * Ordered associative container of unique keys, which stores its keys and its
+ * values in two sorted vectors.
+ * @details Lookups are binary searches over contiguous keys, and iterating
+ * reads memory sequentially, so both are much faster than with std::map.
+ * Inserting or erasing an element moves all the elements after it: flat_map
+ * suits maps which are built once, or in bulk, and searched often. The
+ * elements are accessed as pairs of references, std::pair<const K&, V&>.
+ * Lookups accept any key type Q which satisfies \c
+ * concepts::StrictTotallyOrderedWith<K, Q>, without converting it to K.
+ * @tparam K The key type. Must satisfy \c concepts::StrictTotallyOrdered and
+ * \c concepts::Movable.
+ * @tparam V The mapped type. Must satisfy \c concepts::Movable.
+ * @attention Inserting or erasing elements invalidates every iterator.
+ */
+template<class K, class V>
+class flat_map
+{
+    static_assert(concepts::StrictTotallyOrdered<K>,
+                  "flat_map requires StrictTotallyOrdered keys");
+    static_assert(concepts::Movable<K> && concepts::Movable<V>,
+                  "flat_map requires Movable keys and values");
+
+    template<class Q>
+    using if_lookup_t =
+        std::enable_if_t<detail::heterogeneous_lookup_v<K, Q>, int>;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = detail::map_reference<K, V, false>;
+    using const_reference = detail::map_reference<K, V, true>;
+    using iterator = detail::flat_map_iterator<K, V, false>;
+    using const_iterator = detail::flat_map_iterator<K, V, true>;
+
+    flat_map() = default;
+
+    /// Map of the elements of [first, last): of elements with equal keys,
+    /// only the first one is inserted
+    template<class InputIt>
+    flat_map(InputIt first, InputIt last)
+    {
+        std::vector<value_type> elements(first, last);
+        std::stable_sort(elements.begin(), elements.end(),
+                         [](const value_type& l, const value_type& r) {
+                             return l.first < r.first;
+                         });
+        keys_.reserve(elements.size());
+        values_.reserve(elements.size());
+        for (auto& element: elements) {
+            if (keys_.empty() || keys_.back() < element.first) {
+                keys_.push_back(std::move(element.first));
+                values_.push_back(std::move(element.second));
+            }
+        }
+    }
+
+    flat_map(std::initializer_list<value_type> elements)
+        : flat_map(elements.begin(), elements.end())
+    { }
+
+    /* Element access */
+    V& at(const K& key)
+    {
+        return values_[index_of(key)];
+    }
+
+    const V& at(const K& key) const
+    {
+        return values_[index_of(key)];
+    }
+
+    V& operator[](const K& key) { return try_emplace(key).first->second; }
+
+    V& operator[](K&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    /// Sorted keys
+    const detail::dense_vector_t<K>& keys() const noexcept { return keys_; }
+
+    /// Values, in the order of their keys
+    const detail::dense_vector_t<V>& values() const noexcept
+    { return values_; }
+
+    /* Iterators */
+    iterator begin() noexcept { return make_iterator(0); }
+    iterator end() noexcept { return make_iterator(size()); }
+    const_iterator begin() const noexcept { return make_iterator(0); }
+    const_iterator end() const noexcept { return make_iterator(size()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /* Capacity */
+    bool empty() const noexcept { return keys_.empty(); }
+    size_type size() const noexcept { return keys_.size(); }
+
+    void reserve(size_type n)
+    {
+        keys_.reserve(n);
+        values_.reserve(n);
+    }
+
+    /* Modifiers */
+    void clear() noexcept
+    {
+        keys_.clear();
+        values_.clear();
+    }
+
+    std::pair<iterator, bool> insert(const value_type& element)
+    {
+        return try_emplace(element.first, element.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& element)
+    {
+        return try_emplace(std::move(element.first),
+                           std::move(element.second));
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        return try_emplace_key(key, std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return try_emplace_key(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const K& key, M&& value)
+    {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        const auto i = static_cast<difference_type>(pos - begin());
+        keys_.erase(keys_.begin() + i);
+        values_.erase(values_.begin() + i);
+        return begin() + i;
+    }
+
+    size_type erase(const K& key)
+    {
+        const auto it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+        erase(it);
+        return 1;
+    }
+
+    void swap(flat_map& other) noexcept
+    {
+        keys_.swap(other.keys_);
+        values_.swap(other.values_);
+    }
+
+    friend void swap(flat_map& lhs, flat_map& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    /* Lookup */
+    iterator find(const K& key) { return find_key(key); }
+    const_iterator find(const K& key) const { return find_key(key); }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    iterator find(const Q& key) { return find_key(key); }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    const_iterator find(const Q& key) const { return find_key(key); }
+
+    bool contains(const K& key) const { return find(key) != end(); }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    bool contains(const Q& key) const { return find(key) != end(); }
+
+    size_type count(const K& key) const { return contains(key) ? 1 : 0; }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    size_type count(const Q& key) const { return contains(key) ? 1 : 0; }
+
+    /// First element whose key is not less than key
+    iterator lower_bound(const K& key)
+    {
+        return make_iterator(lower_index(key));
+    }
+
+    const_iterator lower_bound(const K& key) const
+    {
+        return make_iterator(lower_index(key));
+    }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    iterator lower_bound(const Q& key)
+    {
+        return make_iterator(lower_index(key));
+    }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    const_iterator lower_bound(const Q& key) const
+    {
+        return make_iterator(lower_index(key));
+    }
+
+    /// First element whose key is greater than key
+    iterator upper_bound(const K& key)
+    {
+        return make_iterator(upper_index(key));
+    }
+
+    const_iterator upper_bound(const K& key) const
+    {
+        return make_iterator(upper_index(key));
+    }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    iterator upper_bound(const Q& key)
+    {
+        return make_iterator(upper_index(key));
+    }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    const_iterator upper_bound(const Q& key) const
+    {
+        return make_iterator(upper_index(key));
+    }
+
+    std::pair<iterator, iterator> equal_range(const K& key)
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    std::pair<iterator, iterator> equal_range(const Q& key)
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    std::pair<const_iterator, const_iterator> equal_range(const Q& key) const
+    {
+        return {lower_bound(key), upper_bound(key)};
+    }
+
+    /* Comparison */
+    template<class U = V
+            ,class = std::enable_if_t<concepts::EqualityComparable<U>>>
+    friend bool operator==(const flat_map& lhs, const flat_map& rhs)
+    {
+        return lhs.keys_ == rhs.keys_ && lhs.values_ == rhs.values_;
+    }
+
+    template<class U = V
+            ,class = std::enable_if_t<concepts::EqualityComparable<U>>>
+    friend bool operator!=(const flat_map& lhs, const flat_map& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    iterator make_iterator(size_type i) noexcept
+    {
+        return iterator(keys_.data() + i, values_.data() + i);
+    }
+
+    const_iterator make_iterator(size_type i) const noexcept
+    {
+        return const_iterator(keys_.data() + i, values_.data() + i);
+    }
+
+    template<class Q>
+    size_type lower_index(const Q& key) const
+    {
+        return detail::lower_bound_index(keys_.data(), keys_.size(), key);
+    }
+
+    template<class Q>
+    size_type upper_index(const Q& key) const
+    {
+        return detail::upper_bound_index(keys_.data(), keys_.size(), key);
+    }
+
+    template<class Q>
+    iterator find_key(const Q& key)
+    {
+        const size_type i = lower_index(key);
+        return i != size() && !(key < keys_[i]) ? make_iterator(i) : end();
+    }
+
+    template<class Q>
+    const_iterator find_key(const Q& key) const
+    {
+        const size_type i = lower_index(key);
+        return i != size() && !(key < keys_[i]) ? make_iterator(i) : end();
+    }
+
+    size_type index_of(const K& key) const
+    {
+        const size_type i = lower_index(key);
+        if (i == size() || key < keys_[i]) {
+            throw std::out_of_range("flat_map::at: key not found");
+        }
+        return i;
+    }
+
+    // The value is inserted after the key: if that throws, the key is erased
+    template<class Key, class... Args>
+    std::pair<iterator, bool> try_emplace_key(Key&& key, Args&&... args)
+    {
+        const size_type i = lower_index(key);
+        if (i != size() && !(key < keys_[i])) {
+            return {make_iterator(i), false};
+        }
+        const auto pos = static_cast<difference_type>(i);
+        keys_.insert(keys_.begin() + pos, std::forward<Key>(key));
+        try {
+            values_.emplace(values_.begin() + pos,
+                            std::forward<Args>(args)...);
+        } catch (...) {
+            keys_.erase(keys_.begin() + pos);
+            throw;
+        }
+        return {make_iterator(i), true};
+    }
+
+    detail::dense_vector_t<K> keys_;
+    detail::dense_vector_t<V> values_;
+};
+
+} // namespace containers
+
+#endif //DETAIL_FLAT_MAP_H
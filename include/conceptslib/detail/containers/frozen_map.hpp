@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_FROZEN_MAP_H
+#define DETAIL_FROZEN_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/object.hpp>
+#include <conceptslib/detail/containers/static_map.hpp>
+
+namespace containers
+{
+/* --- Class template frozen_hash --- */
+namespace detail
+{
+/// Finalizer of splitmix64: every bit of x affects every bit of the result
+constexpr std::uint64_t mix(std::uint64_t x) noexcept
+{
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9u;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBu;
+    x ^= x >> 31;
+    return x;
+}
+
+} // namespace detail
+
+/**
+ * Seeded hash of the keys of a frozen_map, usable in constant expressions.
+ * @details Defined for integral and enumeration types, and for string views.
+ * Specialize it for other key types: \c operator()(key, seed) must be
+ * constexpr and return a std::uint64_t which depends on all the bits of seed.
+ */
+template<class K, class = void>
+struct frozen_hash;
+
+template<class K>
+struct frozen_hash<K, std::enable_if_t<std::is_integral_v<K> ||
+                                       std::is_enum_v<K>>>
+{
+    constexpr std::uint64_t operator()(K key, std::uint64_t seed) const noexcept
+    {
+        return detail::mix(static_cast<std::uint64_t>(key) ^ detail::mix(seed));
+    }
+};
+
+template<class Char, class Traits>
+struct frozen_hash<std::basic_string_view<Char, Traits>>
+{
+    // FNV-1a, from a basis which depends on seed
+    constexpr std::uint64_t operator()(std::basic_string_view<Char, Traits> key,
+                                       std::uint64_t seed) const noexcept
+    {
+        std::uint64_t h = 0xCBF29CE484222325u ^ detail::mix(seed);
+        for (Char c: key) {
+            h ^= static_cast<std::uint64_t>(c);
+            h *= 0x100000001B3u;
+        }
+        return detail::mix(h);
+    }
+};
+
+/* --- Class frozen_map --- */
+/**
+ * Immutable associative container of N unique keys, with a perfect hash
+ * function found during constant evaluation.
+ * @details The keys are hashed once into M buckets, M being the smallest power
+ * of two not less than N. Each bucket holds a displacement which sends its
+ * keys to distinct slots of a table of M slots: a lookup hashes the key once,
+ * reads the displacement of its bucket and compares the key with the single
+ * candidate in its slot, with no probing and no collision chain. The search
+ * for the seed and the displacements is done by the constructor: a constexpr
+ * frozen_map is built by the compiler and needs no work at startup.
+ * Duplicate keys throw std::invalid_argument, which is a compile error during
+ * constant evaluation. Iterating visits the elements in their given order.
+ * @tparam K The key type. Must satisfy \c concepts::Regular.
+ * @tparam V The mapped type. Must satisfy \c concepts::Semiregular.
+ * @tparam N The number of elements.
+ * @tparam Hash The seeded hash of the keys (see \c frozen_hash).
+ */
+template<class K, class V, std::size_t N, class Hash = frozen_hash<K>>
+class frozen_map
+{
+    static_assert(concepts::Regular<K>,
+                  "frozen_map requires a Regular key type");
+    static_assert(concepts::Semiregular<V>,
+                  "frozen_map requires a Semiregular mapped type");
+
+    static constexpr std::size_t slot_count()
+    {
+        std::size_t m = 1;
+        while (m < N) {
+            m *= 2;
+        }
+        return m;
+    }
+
+    static constexpr std::size_t M = slot_count();
+    static constexpr std::size_t empty_slot = N;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = static_map_entry<K, V>;
+    using size_type = std::size_t;
+    using const_iterator = const value_type*;
+    using iterator = const_iterator;
+
+    /// Build the perfect hash of the keys of elements
+    constexpr explicit frozen_map(const std::pair<K, V> (&elements)[N],
+                                  Hash hash = Hash())
+        : hash_{hash}
+    {
+        for (std::size_t i = 0; i < N; ++i) {
+            elements_[i] = value_type{elements[i].first, elements[i].second};
+            for (std::size_t j = 0; j < i; ++j) {
+                if (elements_[j].first == elements_[i].first) {
+                    throw std::invalid_argument("frozen_map duplicate key");
+                }
+            }
+        }
+        build();
+    }
+
+    /* Element access */
+    constexpr const V& at(const K& key) const
+    {
+        const_iterator it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("frozen_map key not found");
+        }
+        return it->second;
+    }
+
+    /* Iterators */
+    constexpr const_iterator begin() const noexcept { return elements_; }
+    constexpr const_iterator end() const noexcept { return elements_ + N; }
+    constexpr const_iterator cbegin() const noexcept { return begin(); }
+    constexpr const_iterator cend() const noexcept { return end(); }
+
+    /* Capacity */
+    static constexpr bool empty() noexcept { return N == 0; }
+    static constexpr size_type size() noexcept { return N; }
+
+    /* Lookup */
+    constexpr const_iterator find(const K& key) const
+    {
+        const std::size_t i = slots_[slot_of(hash_(key, seed_))];
+        if (i != empty_slot && elements_[i].first == key) {
+            return elements_ + i;
+        }
+        return end();
+    }
+
+    constexpr bool contains(const K& key) const { return find(key) != end(); }
+
+    constexpr size_type count(const K& key) const
+    {
+        return contains(key) ? 1 : 0;
+    }
+
+    /// Index of key in the given order of the elements, or N if absent
+    constexpr size_type index_of(const K& key) const
+    {
+        return static_cast<size_type>(find(key) - begin());
+    }
+
+private:
+    constexpr std::size_t slot_of(std::uint64_t h) const noexcept
+    {
+        const std::int64_t d = displacements_[h & (M - 1)];
+        if (d < 0) {
+            return static_cast<std::size_t>(-d - 1);
+        }
+        return static_cast<std::size_t>(
+            detail::mix(h + static_cast<std::uint64_t>(d)) & (M - 1));
+    }
+
+    // Try seeds until every bucket has a displacement: the larger buckets are
+    // placed first, while most slots are free, and single keys fill the rest
+    constexpr void build()
+    {
+        std::uint64_t hashes[N > 0 ? N : 1]{};
+        for (std::uint64_t seed = 1;; ++seed) {
+            for (std::size_t i = 0; i < N; ++i) {
+                hashes[i] = hash_(elements_[i].first, seed);
+            }
+            if (place(hashes)) {
+                seed_ = seed;
+                return;
+            }
+        }
+    }
+
+    constexpr bool place(const std::uint64_t* hashes)
+    {
+        constexpr std::int64_t max_displacement = 1 << 16;
+
+        std::size_t bucket_sizes[M]{};
+        for (std::size_t i = 0; i < N; ++i) {
+            ++bucket_sizes[hashes[i] & (M - 1)];
+        }
+        for (std::size_t s = 0; s < M; ++s) {
+            slots_[s] = empty_slot;
+            displacements_[s] = 0;
+        }
+
+        for (std::size_t size = N; size > 1; --size) {
+            for (std::size_t b = 0; b < M; ++b) {
+                if (bucket_sizes[b] != size) {
+                    continue;
+                }
+                std::int64_t d = 0;
+                while (!try_displacement(hashes, b, d)) {
+                    if (++d == max_displacement) {
+                        return false;
+                    }
+                }
+                displacements_[b] = d;
+            }
+        }
+
+        std::size_t free = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            const std::size_t b = hashes[i] & (M - 1);
+            if (bucket_sizes[b] == 1) {
+                while (slots_[free] != empty_slot) {
+                    ++free;
+                }
+                slots_[free] = i;
+                displacements_[b] = -static_cast<std::int64_t>(free) - 1;
+            }
+        }
+        return true;
+    }
+
+    // Claim the slots of the keys of bucket b with displacement d, if free
+    constexpr bool try_displacement(const std::uint64_t* hashes, std::size_t b,
+                                    std::int64_t d)
+    {
+        std::size_t claimed[N > 0 ? N : 1]{};
+        std::size_t n = 0;
+        for (std::size_t i = 0; i < N; ++i) {
+            if ((hashes[i] & (M - 1)) != b) {
+                continue;
+            }
+            const std::size_t s = static_cast<std::size_t>(
+                detail::mix(hashes[i] + static_cast<std::uint64_t>(d)) &
+                (M - 1));
+            if (slots_[s] != empty_slot) {
+                for (std::size_t j = 0; j < n; ++j) {
+                    slots_[claimed[j]] = empty_slot;
+                }
+                return false;
+            }
+            slots_[s] = i;
+            claimed[n++] = s;
+        }
+        return true;
+    }
+
+    value_type elements_[N > 0 ? N : 1]{};
+    std::size_t slots_[M]{};
+    std::int64_t displacements_[M]{};
+    std::uint64_t seed_ = 0;
+    Hash hash_;
+};
+
+/* --- Function make_frozen_map --- */
+/**
+ * Frozen map of the given elements, with the number of elements deduced
+ * \code
+ * constexpr auto methods = containers::make_frozen_map<std::string_view, int>(
+ *     {{"GET", 1}, {"POST", 2}, {"PUT", 3}});
+ * \endcode
+ */
+template<class K, class V, class Hash = frozen_hash<K>, std::size_t N>
+constexpr frozen_map<K, V, N, Hash>
+make_frozen_map(const std::pair<K, V> (&elements)[N])
+{
+    return frozen_map<K, V, N, Hash>(elements);
+}
+
+} // namespace containers
+
+#endif //DETAIL_FROZEN_MAP_H
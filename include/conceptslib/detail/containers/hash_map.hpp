@@ -0,0 +1,493 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_HASH_MAP_H
+#define DETAIL_HASH_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+#include <conceptslib/detail/concepts/hashing.hpp>
+#include <conceptslib/detail/concepts/movable.hpp>
+#include <conceptslib/detail/containers/flat_map.hpp>
+
+namespace containers
+{
+/* --- Class template hash --- */
+/**
+ * Hash function of the keys of a hash_map: std::hash<K>, except for strings,
+ * which are hashed as string views
+ * @details Any object which converts to a string view, such as a string
+ * literal or a std::string_view, is then hashed without constructing a string,
+ * and has the hash value of the equal string.
+ */
+template<class K>
+struct hash: std::hash<K>
+{ };
+
+template<class Char, class Traits, class Allocator>
+struct hash<std::basic_string<Char, Traits, Allocator>>
+{
+    using is_transparent = void;
+
+    std::size_t
+    operator()(std::basic_string_view<Char, Traits> value) const noexcept
+    {
+        return std::hash<std::basic_string_view<Char, Traits>>{}(value);
+    }
+};
+
+namespace detail
+{
+template<class Hash>
+using is_transparent_t = typename Hash::is_transparent;
+
+/**
+ * Types Q of the keys with which a hash_map of keys K may be searched without
+ * converting them to K: Hash must declare is_transparent, so that it does not
+ * convert Q either
+ */
+template<class K, class Q, class Hash>
+inline constexpr bool heterogeneous_hash_lookup_v =
+    !std::is_same_v<std::remove_cv_t<std::remove_reference_t<Q>>, K> &&
+    traits::is_detected_v<is_transparent_t, Hash> &&
+    concepts::HashableWith<K, Q, Hash>;
+
+} // namespace detail
+
+/* --- Class hash_map --- */
+/**
+ * Unordered associative container of unique keys, which stores its keys and
+ * values in two dense vectors, indexed by an open addressing hash table.
+ * @details The table stores, for each element, its position in the vectors
+ * and 32 bits of its hash value, so probing compares keys only when those bits
+ * match. Iterating reads the vectors sequentially; erasing an element moves
+ * the last element to its position. The elements are accessed as pairs of
+ * references, std::pair<const K&, V&>. Lookups accept any key type Q which
+ * satisfies \c concepts::HashableWith<K, Q, Hash>, if Hash declares
+ * is_transparent, without converting it to K.
+ * @tparam K The key type. Must satisfy \c concepts::EqualityComparable,
+ * \c concepts::Movable and \c concepts::Hashable<K, Hash>.
+ * @tparam V The mapped type. Must satisfy \c concepts::Movable.
+ * @attention Inserting elements invalidates every iterator, erasing one
+ * invalidates the iterators to it and to the last element. A hash_map holds
+ * fewer than 2^32 elements.
+ */
+template<class K, class V, class Hash = containers::hash<K>>
+class hash_map
+{
+    static_assert(concepts::EqualityComparable<K>,
+                  "hash_map requires EqualityComparable keys");
+    static_assert(concepts::Hashable<K, Hash>,
+                  "hash_map requires keys which Hash can hash");
+    static_assert(concepts::Movable<K> && concepts::Movable<V>,
+                  "hash_map requires Movable keys and values");
+
+    template<class Q>
+    using if_lookup_t = std::enable_if_t<
+        detail::heterogeneous_hash_lookup_v<K, Q, Hash>, int>;
+
+    struct bucket
+    {
+        std::uint32_t index;
+        std::uint32_t tag;
+    };
+
+    static constexpr std::uint32_t empty_index =
+        std::numeric_limits<std::uint32_t>::max();
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using reference = detail::map_reference<K, V, false>;
+    using const_reference = detail::map_reference<K, V, true>;
+    using iterator = detail::flat_map_iterator<K, V, false>;
+    using const_iterator = detail::flat_map_iterator<K, V, true>;
+
+    hash_map() = default;
+
+    explicit hash_map(const Hash& hash): hash_(hash)
+    { }
+
+    template<class InputIt>
+    hash_map(InputIt first, InputIt last, const Hash& hash = Hash{})
+        : hash_(hash)
+    {
+        for (; first != last; ++first) {
+            insert(*first);
+        }
+    }
+
+    hash_map(std::initializer_list<value_type> elements)
+        : hash_map(elements.begin(), elements.end())
+    { }
+
+    /* Element access */
+    V& at(const K& key)
+    {
+        return const_cast<V&>(std::as_const(*this).at(key));
+    }
+
+    const V& at(const K& key) const
+    {
+        const auto it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("hash_map::at: key not found");
+        }
+        return it->second;
+    }
+
+    V& operator[](const K& key) { return try_emplace(key).first->second; }
+
+    V& operator[](K&& key)
+    {
+        return try_emplace(std::move(key)).first->second;
+    }
+
+    /// Keys, in the order of the elements
+    const detail::dense_vector_t<K>& keys() const noexcept { return keys_; }
+
+    /// Values, in the order of the elements
+    const detail::dense_vector_t<V>& values() const noexcept
+    { return values_; }
+
+    /* Iterators */
+    iterator begin() noexcept { return make_iterator(0); }
+    iterator end() noexcept { return make_iterator(size()); }
+    const_iterator begin() const noexcept { return make_iterator(0); }
+    const_iterator end() const noexcept { return make_iterator(size()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /* Capacity */
+    bool empty() const noexcept { return keys_.empty(); }
+    size_type size() const noexcept { return keys_.size(); }
+
+    /// Make room for n elements without rehashing
+    void reserve(size_type n)
+    {
+        keys_.reserve(n);
+        values_.reserve(n);
+        if (!fits(n, buckets_.size())) {
+            rehash(bucket_count_for(n));
+        }
+    }
+
+    /* Modifiers */
+    void clear() noexcept
+    {
+        keys_.clear();
+        values_.clear();
+        for (bucket& b: buckets_) {
+            b.index = empty_index;
+        }
+    }
+
+    std::pair<iterator, bool> insert(const value_type& element)
+    {
+        return try_emplace(element.first, element.second);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& element)
+    {
+        return try_emplace(std::move(element.first),
+                           std::move(element.second));
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return insert(value_type(std::forward<Args>(args)...));
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(const K& key, Args&&... args)
+    {
+        return try_emplace_key(key, std::forward<Args>(args)...);
+    }
+
+    template<class... Args>
+    std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+    {
+        return try_emplace_key(std::move(key), std::forward<Args>(args)...);
+    }
+
+    template<class M>
+    std::pair<iterator, bool> insert_or_assign(const K& key, M&& value)
+    {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    /// Erase the element at pos, which then holds the former last element
+    iterator erase(const_iterator pos)
+    {
+        const auto i = static_cast<size_type>(pos - cbegin());
+        erase_bucket(find_bucket(keys_[i], tag_of(keys_[i])));
+        return make_iterator(i);
+    }
+
+    size_type erase(const K& key) { return erase_key(key); }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    size_type erase(const Q& key) { return erase_key(key); }
+
+    void swap(hash_map& other) noexcept(std::is_nothrow_swappable_v<Hash>)
+    {
+        using std::swap;
+        keys_.swap(other.keys_);
+        values_.swap(other.values_);
+        buckets_.swap(other.buckets_);
+        swap(hash_, other.hash_);
+    }
+
+    friend void swap(hash_map& lhs, hash_map& rhs)
+        noexcept(noexcept(lhs.swap(rhs)))
+    {
+        lhs.swap(rhs);
+    }
+
+    /* Lookup */
+    iterator find(const K& key) { return make_iterator(index_of(key)); }
+
+    const_iterator find(const K& key) const
+    {
+        return make_iterator(index_of(key));
+    }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    iterator find(const Q& key) { return make_iterator(index_of(key)); }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    const_iterator find(const Q& key) const
+    {
+        return make_iterator(index_of(key));
+    }
+
+    bool contains(const K& key) const { return index_of(key) != size(); }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    bool contains(const Q& key) const { return index_of(key) != size(); }
+
+    size_type count(const K& key) const { return contains(key) ? 1 : 0; }
+
+    template<class Q, if_lookup_t<Q> = 0>
+    size_type count(const Q& key) const { return contains(key) ? 1 : 0; }
+
+    hasher hash_function() const { return hash_; }
+
+    /* Comparison: maps are equal if they have the same elements, in any
+     * order */
+    template<class U = V
+            ,class = std::enable_if_t<concepts::EqualityComparable<U>>>
+    friend bool operator==(const hash_map& lhs, const hash_map& rhs)
+    {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (size_type i = 0; i < lhs.size(); ++i) {
+            const size_type j = rhs.index_of(lhs.keys_[i]);
+            if (j == rhs.size() || !(lhs.values_[i] == rhs.values_[j])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<class U = V
+            ,class = std::enable_if_t<concepts::EqualityComparable<U>>>
+    friend bool operator!=(const hash_map& lhs, const hash_map& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    iterator make_iterator(size_type i) noexcept
+    {
+        return iterator(keys_.data() + i, values_.data() + i);
+    }
+
+    const_iterator make_iterator(size_type i) const noexcept
+    {
+        return const_iterator(keys_.data() + i, values_.data() + i);
+    }
+
+    /* Hash table */
+    // The table is at most 3/4 full
+    static bool fits(size_type n, size_type buckets) noexcept
+    {
+        return 4 * n <= 3 * buckets;
+    }
+
+    static size_type bucket_count_for(size_type n) noexcept
+    {
+        size_type buckets = 8;
+        while (!fits(n, buckets)) {
+            buckets *= 2;
+        }
+        return buckets;
+    }
+
+    template<class Q>
+    std::uint32_t tag_of(const Q& key) const
+    {
+        const auto h = static_cast<std::uint64_t>(hash_(key));
+        return static_cast<std::uint32_t>(h ^ (h >> 32));
+    }
+
+    // Bucket at which the probe for a tag starts: Fibonacci hashing mixes
+    // the bits of the tag, as std::hash is the identity for integers
+    size_type home_of(std::uint32_t tag) const noexcept
+    {
+        const std::uint64_t product = tag * 0x9e3779b97f4a7c15ull;
+        return static_cast<size_type>(product >> 32) & (buckets_.size() - 1);
+    }
+
+    // Bucket of the element with key, or the empty bucket ending its probe
+    template<class Q>
+    size_type find_bucket(const Q& key, std::uint32_t tag) const
+    {
+        const size_type mask = buckets_.size() - 1;
+        for (size_type i = home_of(tag);; i = (i + 1) & mask) {
+            const bucket& b = buckets_[i];
+            if (b.index == empty_index ||
+                (b.tag == tag && keys_[b.index] == key)) {
+                return i;
+            }
+        }
+    }
+
+    // Position of the element with key, or size() if there is none
+    template<class Q>
+    size_type index_of(const Q& key) const
+    {
+        if (buckets_.empty()) {
+            return size();
+        }
+        const std::uint32_t index = buckets_[find_bucket(key, tag_of(key))]
+                                        .index;
+        return index == empty_index ? size() : index;
+    }
+
+    void rehash(size_type bucket_count)
+    {
+        std::vector<bucket> old(bucket_count, bucket{empty_index, 0});
+        old.swap(buckets_);
+        const size_type mask = bucket_count - 1;
+        for (const bucket& b: old) {
+            if (b.index != empty_index) {
+                size_type i = home_of(b.tag);
+                while (buckets_[i].index != empty_index) {
+                    i = (i + 1) & mask;
+                }
+                buckets_[i] = b;
+            }
+        }
+    }
+
+    // The element is constructed before the table changes: if that throws,
+    // the map is unchanged
+    template<class Key, class... Args>
+    std::pair<iterator, bool> try_emplace_key(Key&& key, Args&&... args)
+    {
+        if (!fits(size() + 1, buckets_.size())) {
+            rehash(bucket_count_for(size() + 1));
+        }
+        const std::uint32_t tag = tag_of(key);
+        const size_type i = find_bucket(key, tag);
+        if (buckets_[i].index != empty_index) {
+            return {make_iterator(buckets_[i].index), false};
+        }
+        keys_.push_back(std::forward<Key>(key));
+        try {
+            values_.emplace_back(std::forward<Args>(args)...);
+        } catch (...) {
+            keys_.pop_back();
+            throw;
+        }
+        buckets_[i] = bucket{static_cast<std::uint32_t>(size() - 1), tag};
+        return {make_iterator(size() - 1), true};
+    }
+
+    template<class Q>
+    size_type erase_key(const Q& key)
+    {
+        if (buckets_.empty()) {
+            return 0;
+        }
+        const size_type i = find_bucket(key, tag_of(key));
+        if (buckets_[i].index == empty_index) {
+            return 0;
+        }
+        erase_bucket(i);
+        return 1;
+    }
+
+    /*
+     * Empty the bucket i, shifting back the next buckets of the probe whose
+     * home is not after the hole, then move the last element to the position
+     * of the erased one
+     */
+    void erase_bucket(size_type i)
+    {
+        const size_type index = buckets_[i].index;
+        const size_type mask = buckets_.size() - 1;
+        size_type hole = i;
+        for (size_type j = (i + 1) & mask; buckets_[j].index != empty_index;
+             j = (j + 1) & mask) {
+            const size_type home = home_of(buckets_[j].tag);
+            const bool stays = hole <= j ? hole < home && home <= j
+                                         : hole < home || home <= j;
+            if (!stays) {
+                buckets_[hole] = buckets_[j];
+                hole = j;
+            }
+        }
+        buckets_[hole].index = empty_index;
+
+        const size_type last = size() - 1;
+        if (index != last) {
+            const std::uint32_t tag = tag_of(keys_[last]);
+            size_type b = home_of(tag);
+            while (buckets_[b].index != last) {
+                b = (b + 1) & mask;
+            }
+            buckets_[b].index = static_cast<std::uint32_t>(index);
+            keys_[index] = std::move(keys_[last]);
+            values_[index] = std::move(values_[last]);
+        }
+        keys_.pop_back();
+        values_.pop_back();
+    }
+
+    detail::dense_vector_t<K> keys_;
+    detail::dense_vector_t<V> values_;
+    std::vector<bucket> buckets_;
+    Hash hash_;
+};
+
+} // namespace containers
+
+#endif //DETAIL_HASH_MAP_H
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_ORDERED_LOOKUP_H
+#define DETAIL_ORDERED_LOOKUP_H
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+
+namespace containers
+{
+namespace detail
+{
+/* --- Heterogeneous lookup --- */
+/**
+ * Types Q of the keys with which the ordered maps of keys K may be searched
+ * without converting them to K: types ordered together with K
+ */
+template<class K, class Q>
+inline constexpr bool heterogeneous_lookup_v =
+    !std::is_same_v<std::remove_cv_t<std::remove_reference_t<Q>>, K> &&
+    concepts::StrictTotallyOrderedWith<K, Q>;
+
+/* --- Binary search --- */
+/*
+ * Scalar keys are searched without branching on the comparisons, so their
+ * outcome is never mispredicted: the loop trip count only depends on n. Other
+ * keys, whose comparisons are calls that read memory, are searched with
+ * std::lower_bound and std::upper_bound, whose speculation prefetches them.
+ */
+template<class K>
+inline constexpr bool branchless_search_v = std::is_scalar_v<K>;
+
+/// Index of the first of the n sorted keys which is not less than key
+template<class K, class Q>
+inline std::size_t lower_bound_index(const K* keys, std::size_t n,
+                                     const Q& key)
+{
+    if constexpr (branchless_search_v<K>) {
+        if (n == 0) {
+            return 0;
+        }
+        const K* base = keys;
+        while (n > 1) {
+            const std::size_t half = n / 2;
+            base = base[half - 1] < key ? base + half : base;
+            n -= half;
+        }
+        return static_cast<std::size_t>(base - keys) + (*base < key);
+    } else {
+        const auto less = [](const K& k, const Q& q) { return k < q; };
+        return static_cast<std::size_t>(
+            std::lower_bound(keys, keys + n, key, less) - keys);
+    }
+}
+
+/// Index of the first of the n sorted keys which is greater than key
+template<class K, class Q>
+inline std::size_t upper_bound_index(const K* keys, std::size_t n,
+                                     const Q& key)
+{
+    if constexpr (branchless_search_v<K>) {
+        if (n == 0) {
+            return 0;
+        }
+        const K* base = keys;
+        while (n > 1) {
+            const std::size_t half = n / 2;
+            base = key < base[half - 1] ? base : base + half;
+            n -= half;
+        }
+        return static_cast<std::size_t>(base - keys) + !(key < *base);
+    } else {
+        const auto less = [](const Q& q, const K& k) { return q < k; };
+        return static_cast<std::size_t>(
+            std::upper_bound(keys, keys + n, key, less) - keys);
+    }
+}
+
+/* --- Element references --- */
+/// Reference to the element of a map which stores its keys and values apart
+template<class K, class V, bool Const>
+using map_reference =
+    std::pair<const K&, std::conditional_t<Const, const V&, V&>>;
+
+/// Result of operator-> of iterators whose reference is not a true reference
+template<class Reference>
+class arrow_proxy
+{
+public:
+    explicit arrow_proxy(Reference ref) noexcept: ref_(std::move(ref))
+    { }
+
+    const Reference* operator->() const noexcept { return &ref_; }
+
+private:
+    Reference ref_;
+};
+
+} // namespace detail
+} // namespace containers
+
+#endif //DETAIL_ORDERED_LOOKUP_H
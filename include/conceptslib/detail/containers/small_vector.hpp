@@ -0,0 +1,486 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_SMALL_VECTOR_H
+#define DETAIL_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/algorithm/uninitialized.hpp>
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/core.hpp>
+#include <conceptslib/detail/concepts/movable.hpp>
+
+namespace containers
+{
+namespace detail
+{
+/* --- Relocation --- */
+/**
+ * Types whose objects can be moved to a new address by copying their bytes.
+ * Relocating them neither runs constructors nor destructors.
+ */
+template<class T>
+inline constexpr bool trivially_relocatable_v = std::is_trivially_copyable_v<T>;
+
+/// Types whose relocation cannot throw, and so needs no rollback
+template<class T>
+inline constexpr bool nothrow_relocatable_v =
+    trivially_relocatable_v<T> || concepts::NothrowMoveConstructible<T>;
+
+/**
+ * Relocate n objects from src into the uninitialized storage at dst: after the
+ * call the objects live at dst and src is uninitialized storage.
+ * @details Trivially relocatable objects are copied byte by byte. Others are
+ * relocated by \c algorithm::uninitialized_relocate: moved if their move
+ * constructor does not throw, with no rollback, or copied otherwise, leaving
+ * the objects at src untouched if a copy throws.
+ */
+template<class T>
+void relocate(T* src, std::size_t n, T* dst)
+    noexcept(nothrow_relocatable_v<T>)
+{
+    if constexpr (trivially_relocatable_v<T>) {
+        if (n != 0) {
+            std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src),
+                        n * sizeof(T));
+        }
+    } else {
+        algorithm::uninitialized_relocate(src, src + n, dst);
+    }
+}
+
+} // namespace detail
+
+/* --- Class small_vector --- */
+/**
+ * Sequence container which stores up to N elements inline (inside the
+ * small_vector object itself) and switches to a heap allocated buffer when it
+ * grows beyond N elements.
+ * @details Growing the container relocates the elements: trivially copyable
+ * elements are copied with memcpy, any other element is moved (or copied, if
+ * its move constructor may throw). Inserting an element which satisfies
+ * \c concepts::NothrowMovable in the middle shifts the following elements
+ * once, and growing places them directly around it; other elements are
+ * appended and rotated into place.
+ * @tparam T The element type. Must satisfy \c concepts::Movable.
+ * @tparam N The number of elements stored inline.
+ * @attention Unlike std::vector, moving a small_vector whose elements are
+ * stored inline moves the elements themselves and invalidates iterators.
+ */
+template<class T, std::size_t N>
+class small_vector
+{
+    static_assert(concepts::Movable<T>,
+                  "small_vector requires a Movable element type");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// Number of elements which can be stored without allocating
+    static constexpr size_type inline_capacity = N;
+
+    small_vector() noexcept
+        : data_{inline_data()}, size_{0}, capacity_{N}
+    { }
+
+    explicit small_vector(size_type n): small_vector()
+    {
+        resize(n);
+    }
+
+    small_vector(size_type n, const T& value): small_vector()
+    {
+        resize(n, value);
+    }
+
+    small_vector(std::initializer_list<T> values): small_vector()
+    {
+        assign_copy(values.begin(), values.size());
+    }
+
+    small_vector(const small_vector& other): small_vector()
+    {
+        assign_copy(other.data_, other.size_);
+    }
+
+    small_vector(small_vector&& other)
+        noexcept(concepts::NothrowMoveConstructible<T>)
+        : small_vector()
+    {
+        steal(other);
+    }
+
+    small_vector& operator=(const small_vector& other)
+    {
+        if (this != &other) {
+            clear();
+            assign_copy(other.data_, other.size_);
+        }
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& other)
+        noexcept(concepts::NothrowMoveConstructible<T>)
+    {
+        if (this != &other) {
+            clear();
+            if (!other.is_inline()) {
+                release();
+                data_ = inline_data();
+                capacity_ = N;
+            }
+            steal(other);
+        }
+        return *this;
+    }
+
+    ~small_vector()
+    {
+        std::destroy(data_, data_ + size_);
+        release();
+    }
+
+    /* Element access */
+    reference operator[](size_type i) noexcept { return data_[i]; }
+    const_reference operator[](size_type i) const noexcept { return data_[i]; }
+
+    reference front() noexcept { return data_[0]; }
+    const_reference front() const noexcept { return data_[0]; }
+
+    reference back() noexcept { return data_[size_ - 1]; }
+    const_reference back() const noexcept { return data_[size_ - 1]; }
+
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+
+    /* Iterators */
+    iterator begin() noexcept { return data_; }
+    iterator end() noexcept { return data_ + size_; }
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept
+    { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept
+    { return const_reverse_iterator(begin()); }
+
+    /* Capacity */
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return capacity_; }
+
+    /// Check if the elements are stored inline
+    bool is_inline() const noexcept { return data_ == inline_data(); }
+
+    void reserve(size_type n)
+    {
+        if (n > capacity_) {
+            reallocate(n);
+        }
+    }
+
+    /* Modifiers */
+    void clear() noexcept
+    {
+        std::destroy(data_, data_ + size_);
+        size_ = 0;
+    }
+
+    template<class... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if (size_ == capacity_) {
+            return grow_and_emplace_back(std::forward<Args>(args)...);
+        }
+        ::new (static_cast<void*>(data_ + size_))
+            T(std::forward<Args>(args)...);
+        return data_[size_++];
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    void pop_back() noexcept
+    {
+        data_[--size_].~T();
+    }
+
+    template<class... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        const auto i = static_cast<size_type>(pos - begin());
+        if constexpr (concepts::NothrowMovable<T>) {
+            // Compared as pointers, like the bounds of the shift below, so
+            // that the optimizer knows that the shift moves an element
+            if (pos == end()) {
+                emplace_back(std::forward<Args>(args)...);
+            } else if (size_ == capacity_) {
+                grow_and_emplace(i, std::forward<Args>(args)...);
+            } else {
+                // args may refer to an element which is about to be shifted
+                T value(std::forward<Args>(args)...);
+                ::new (static_cast<void*>(data_ + size_))
+                    T(std::move(data_[size_ - 1]));
+                std::move_backward(begin() + i, end() - 1, end());
+                data_[i] = std::move(value);
+                ++size_;
+            }
+        } else {
+            emplace_back(std::forward<Args>(args)...);
+            std::rotate(begin() + i, end() - 1, end());
+        }
+        return begin() + i;
+    }
+
+    iterator insert(const_iterator pos, const T& value)
+    {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value)
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        const auto i = static_cast<size_type>(first - begin());
+        const auto count = static_cast<size_type>(last - first);
+        if (count != 0) {
+            std::move(begin() + i + count, end(), begin() + i);
+            std::destroy(end() - count, end());
+            size_ -= count;
+        }
+        return begin() + i;
+    }
+
+    void resize(size_type n)
+    {
+        resize_with(n, [](T* p) { ::new (static_cast<void*>(p)) T(); });
+    }
+
+    void resize(size_type n, const T& value)
+    {
+        resize_with(n, [&value](T* p) {
+            ::new (static_cast<void*>(p)) T(value);
+        });
+    }
+
+    void swap(small_vector& other)
+        noexcept(concepts::NothrowMoveConstructible<T>)
+    {
+        small_vector tmp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    friend void swap(small_vector& lhs, small_vector& rhs)
+        noexcept(concepts::NothrowMoveConstructible<T>)
+    {
+        lhs.swap(rhs);
+    }
+
+    /* Comparison */
+    friend bool operator==(const small_vector& lhs, const small_vector& rhs)
+    {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    friend bool operator!=(const small_vector& lhs, const small_vector& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const small_vector& lhs, const small_vector& rhs)
+    {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(),
+                                            rhs.begin(), rhs.end());
+    }
+
+    friend bool operator>(const small_vector& lhs, const small_vector& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const small_vector& lhs, const small_vector& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const small_vector& lhs, const small_vector& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+private:
+    T* inline_data() noexcept
+    {
+        return reinterpret_cast<T*>(storage_);
+    }
+
+    const T* inline_data() const noexcept
+    {
+        return reinterpret_cast<const T*>(storage_);
+    }
+
+    static T* allocate(size_type n)
+    {
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    // Free the heap buffer, if any. Elements must have been destroyed.
+    void release() noexcept
+    {
+        if (!is_inline()) {
+            std::allocator<T>{}.deallocate(data_, capacity_);
+        }
+    }
+
+    size_type next_capacity(size_type required) const noexcept
+    {
+        return std::max({required, 2 * capacity_, size_type{1}});
+    }
+
+    void reallocate(size_type new_capacity)
+    {
+        T* buffer = allocate(new_capacity);
+        try {
+            detail::relocate(data_, size_, buffer);
+        } catch (...) {
+            std::allocator<T>{}.deallocate(buffer, new_capacity);
+            throw;
+        }
+        release();
+        data_ = buffer;
+        capacity_ = new_capacity;
+    }
+
+    // The new element is constructed before relocating the existing ones, as
+    // args may refer to an element of this container
+    template<class... Args>
+    reference grow_and_emplace_back(Args&&... args)
+    {
+        const size_type new_capacity = next_capacity(size_ + 1);
+        T* buffer = allocate(new_capacity);
+        try {
+            ::new (static_cast<void*>(buffer + size_))
+                T(std::forward<Args>(args)...);
+        } catch (...) {
+            std::allocator<T>{}.deallocate(buffer, new_capacity);
+            throw;
+        }
+        try {
+            detail::relocate(data_, size_, buffer);
+        } catch (...) {
+            buffer[size_].~T();
+            std::allocator<T>{}.deallocate(buffer, new_capacity);
+            throw;
+        }
+        release();
+        data_ = buffer;
+        capacity_ = new_capacity;
+        return data_[size_++];
+    }
+
+    // Grow, with the new element at index i. The elements cannot throw when
+    // relocated: they are placed around it with no rollback.
+    template<class... Args>
+    void grow_and_emplace(size_type i, Args&&... args)
+    {
+        static_assert(detail::nothrow_relocatable_v<T>);
+        const size_type new_capacity = next_capacity(size_ + 1);
+        T* buffer = allocate(new_capacity);
+        try {
+            ::new (static_cast<void*>(buffer + i))
+                T(std::forward<Args>(args)...);
+        } catch (...) {
+            std::allocator<T>{}.deallocate(buffer, new_capacity);
+            throw;
+        }
+        detail::relocate(data_, i, buffer);
+        detail::relocate(data_ + i, size_ - i, buffer + i + 1);
+        release();
+        data_ = buffer;
+        capacity_ = new_capacity;
+        ++size_;
+    }
+
+    template<class Construct>
+    void resize_with(size_type n, Construct construct)
+    {
+        if (n < size_) {
+            std::destroy(data_ + n, data_ + size_);
+            size_ = n;
+            return;
+        }
+        reserve(n);
+        for (; size_ < n; ++size_) {
+            construct(data_ + size_);
+        }
+    }
+
+    // Requires an empty container with enough capacity for count elements
+    void assign_copy(const T* first, size_type count)
+    {
+        reserve(count);
+        std::uninitialized_copy(first, first + count, data_);
+        size_ = count;
+    }
+
+    // Take other's elements. Requires an empty container using inline storage
+    // if other uses inline storage, or an empty one with no heap buffer.
+    void steal(small_vector& other)
+    {
+        if (other.is_inline()) {
+            detail::relocate(other.data_, other.size_, data_);
+        } else {
+            data_ = other.data_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data();
+            other.capacity_ = N;
+        }
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+
+    T* data_;
+    size_type size_;
+    size_type capacity_;
+    alignas(T) unsigned char storage_[(N > 0 ? N : 1) * sizeof(T)];
+};
+
+} // namespace containers
+
+#endif //DETAIL_SMALL_VECTOR_H
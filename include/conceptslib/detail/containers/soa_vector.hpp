@@ -0,0 +1,800 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_SOA_VECTOR_H
+#define DETAIL_SOA_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+#include <conceptslib/detail/concepts/movable.hpp>
+#include <conceptslib/detail/containers/small_vector.hpp>
+#include <conceptslib/detail/type_traits/common_reference.hpp>
+#include <conceptslib/detail/utility/reflection.hpp>
+#include <conceptslib/detail/utility/tuple.hpp>
+
+namespace containers
+{
+namespace detail
+{
+/* --- Fields --- */
+template<class Fields>
+struct soa_fields;
+
+template<class... Fs>
+struct soa_fields<utility::tuple<Fs&...>>
+{
+    // Pointers to the arrays of the fields
+    using columns = utility::tuple<Fs*...>;
+
+    static constexpr bool nothrow_movable =
+        (std::is_nothrow_move_constructible_v<Fs> && ...);
+
+    static constexpr bool equality_comparable =
+        (concepts::EqualityComparable<Fs> && ...);
+};
+
+// Fields of the aggregate T: the columns of const T point to const fields
+template<class T>
+using soa_fields_t = soa_fields<utility::fields_t<T>>;
+
+template<class T>
+using soa_columns_t = typename soa_fields_t<T>::columns;
+
+template<std::size_t I, class T>
+using soa_field_t =
+    std::remove_reference_t<utility::tuple_element_t<I, utility::fields_t<T>>>;
+
+template<class Lhs, class Rhs, std::size_t... Is>
+bool soa_equal(const Lhs& lhs, const Rhs& rhs, std::index_sequence<Is...>)
+{
+    return ((utility::get<Is>(lhs) == utility::get<Is>(rhs)) && ...);
+}
+
+/* --- Class template soa_reference --- */
+/**
+ * Proxy reference to an element of a soa_vector: a tuple of references to
+ * the fields of the element, which live in different arrays.
+ * @details Assigning an aggregate or another reference assigns the fields
+ * through, as assigning to T& would. The element is copied by converting the
+ * reference to T. Its common reference with T is T, and the common reference
+ * of a reference and a const reference is the const reference.
+ */
+template<class T, bool Const>
+class soa_reference
+{
+    using element_t = std::conditional_t<Const, const T, T>;
+    using fields_type = utility::fields_t<element_t>;
+    using indices = std::make_index_sequence<utility::field_count_v<T>>;
+
+    template<class, bool>
+    friend class soa_reference;
+
+public:
+    soa_reference(const soa_columns_t<element_t>& columns,
+                  std::size_t i) noexcept
+        : soa_reference(columns, i, indices{})
+    { }
+
+    // References to elements convert to references to const elements
+    template<bool C = Const, class = std::enable_if_t<C>>
+    soa_reference(const soa_reference<T, false>& other) noexcept
+        : fields_(other.fields_)
+    { }
+
+    soa_reference(const soa_reference&) = default;
+    soa_reference& operator=(const soa_reference&) = default;
+
+    template<bool C = Const, class = std::enable_if_t<!C>>
+    const soa_reference& operator=(const T& value) const
+    {
+        assign(utility::tie_fields(value), indices{});
+        return *this;
+    }
+
+    template<bool C = Const, class = std::enable_if_t<!C>>
+    const soa_reference& operator=(T&& value) const
+    {
+        assign_move(utility::tie_fields(value), indices{});
+        return *this;
+    }
+
+    template<bool C = Const, class = std::enable_if_t<!C>>
+    const soa_reference& operator=(const soa_reference<T, true>& other) const
+    {
+        assign(other.fields_, indices{});
+        return *this;
+    }
+
+    /// Copy of the element
+    operator T() const
+    {
+        return to_value(indices{});
+    }
+
+    /// Reference to the field I of the element
+    template<std::size_t I>
+    auto& get() const noexcept
+    {
+        return utility::get<I>(fields_);
+    }
+
+    /// Tuple of references to the fields of the element
+    const fields_type& fields() const noexcept
+    {
+        return fields_;
+    }
+
+    template<bool C = Const, class = std::enable_if_t<!C>>
+    friend void swap(const soa_reference& lhs, const soa_reference& rhs)
+    {
+        lhs.swap_fields(rhs, indices{});
+    }
+
+private:
+    template<std::size_t... Is>
+    soa_reference(const soa_columns_t<element_t>& columns, std::size_t i,
+                  std::index_sequence<Is...>) noexcept
+        : fields_(utility::get<Is>(columns)[i]...)
+    { }
+
+    template<class Fields, std::size_t... Is>
+    void assign(const Fields& fields, std::index_sequence<Is...>) const
+    {
+        ((utility::get<Is>(fields_) = utility::get<Is>(fields)), ...);
+    }
+
+    template<class Fields, std::size_t... Is>
+    void assign_move(const Fields& fields, std::index_sequence<Is...>) const
+    {
+        ((utility::get<Is>(fields_) = std::move(utility::get<Is>(fields))),
+         ...);
+    }
+
+    template<std::size_t... Is>
+    T to_value(std::index_sequence<Is...>) const
+    {
+        return T{utility::get<Is>(fields_)...};
+    }
+
+    template<std::size_t... Is>
+    void swap_fields(const soa_reference& other,
+                     std::index_sequence<Is...>) const
+    {
+        using std::swap;
+        (swap(utility::get<Is>(fields_), utility::get<Is>(other.fields_)),
+         ...);
+    }
+
+    fields_type fields_;
+};
+
+/* --- Comparison --- */
+template<class T, bool C1, bool C2
+        ,class = std::enable_if_t<soa_fields_t<T>::equality_comparable>>
+bool operator==(const soa_reference<T, C1>& lhs,
+                const soa_reference<T, C2>& rhs)
+{
+    return soa_equal(lhs.fields(), rhs.fields(),
+                     std::make_index_sequence<utility::field_count_v<T>>{});
+}
+
+template<class T, bool C1, bool C2
+        ,class = std::enable_if_t<soa_fields_t<T>::equality_comparable>>
+bool operator!=(const soa_reference<T, C1>& lhs,
+                const soa_reference<T, C2>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template<class T, bool C
+        ,class = std::enable_if_t<soa_fields_t<T>::equality_comparable>>
+bool operator==(const soa_reference<T, C>& lhs, const T& rhs)
+{
+    return soa_equal(lhs.fields(), utility::tie_fields(rhs),
+                     std::make_index_sequence<utility::field_count_v<T>>{});
+}
+
+template<class T, bool C
+        ,class = std::enable_if_t<soa_fields_t<T>::equality_comparable>>
+bool operator==(const T& lhs, const soa_reference<T, C>& rhs)
+{
+    return rhs == lhs;
+}
+
+template<class T, bool C
+        ,class = std::enable_if_t<soa_fields_t<T>::equality_comparable>>
+bool operator!=(const soa_reference<T, C>& lhs, const T& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template<class T, bool C
+        ,class = std::enable_if_t<soa_fields_t<T>::equality_comparable>>
+bool operator!=(const T& lhs, const soa_reference<T, C>& rhs)
+{
+    return !(rhs == lhs);
+}
+
+/* --- Class template soa_iterator --- */
+/**
+ * Random access iterator over the elements of a soa_vector, which yields
+ * soa_reference proxies (as the iterators of std::vector<bool>).
+ */
+template<class T, bool Const>
+class soa_iterator
+{
+    using element_t = std::conditional_t<Const, const T, T>;
+    using columns_type = soa_columns_t<element_t>;
+
+    template<class, bool>
+    friend class soa_iterator;
+
+public:
+    using value_type = T;
+    using reference = soa_reference<T, Const>;
+    using pointer = void;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+    soa_iterator() noexcept: columns_{}, index_{0}
+    { }
+
+    soa_iterator(const columns_type& columns, difference_type i) noexcept
+        : columns_{columns}, index_{i}
+    { }
+
+    // Iterators convert to iterators to const elements
+    template<bool C = Const, class = std::enable_if_t<C>>
+    soa_iterator(const soa_iterator<T, false>& other) noexcept
+        : columns_{other.columns_}, index_{other.index_}
+    { }
+
+    reference operator*() const noexcept
+    {
+        return reference(columns_, static_cast<std::size_t>(index_));
+    }
+
+    reference operator[](difference_type n) const noexcept
+    {
+        return reference(columns_, static_cast<std::size_t>(index_ + n));
+    }
+
+    soa_iterator& operator++() noexcept { ++index_; return *this; }
+    soa_iterator& operator--() noexcept { --index_; return *this; }
+
+    soa_iterator operator++(int) noexcept
+    {
+        auto it = *this;
+        ++index_;
+        return it;
+    }
+
+    soa_iterator operator--(int) noexcept
+    {
+        auto it = *this;
+        --index_;
+        return it;
+    }
+
+    soa_iterator& operator+=(difference_type n) noexcept
+    {
+        index_ += n;
+        return *this;
+    }
+
+    soa_iterator& operator-=(difference_type n) noexcept
+    {
+        index_ -= n;
+        return *this;
+    }
+
+    friend soa_iterator operator+(soa_iterator it, difference_type n) noexcept
+    {
+        return it += n;
+    }
+
+    friend soa_iterator operator+(difference_type n, soa_iterator it) noexcept
+    {
+        return it += n;
+    }
+
+    friend soa_iterator operator-(soa_iterator it, difference_type n) noexcept
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const soa_iterator& lhs,
+                                     const soa_iterator& rhs) noexcept
+    {
+        return lhs.index_ - rhs.index_;
+    }
+
+    /* Comparison: iterators of the same container compare their indices */
+    friend bool operator==(const soa_iterator& lhs,
+                           const soa_iterator& rhs) noexcept
+    {
+        return lhs.index_ == rhs.index_;
+    }
+
+    friend bool operator!=(const soa_iterator& lhs,
+                           const soa_iterator& rhs) noexcept
+    {
+        return lhs.index_ != rhs.index_;
+    }
+
+    friend bool operator<(const soa_iterator& lhs,
+                          const soa_iterator& rhs) noexcept
+    {
+        return lhs.index_ < rhs.index_;
+    }
+
+    friend bool operator>(const soa_iterator& lhs,
+                          const soa_iterator& rhs) noexcept
+    {
+        return lhs.index_ > rhs.index_;
+    }
+
+    friend bool operator<=(const soa_iterator& lhs,
+                           const soa_iterator& rhs) noexcept
+    {
+        return lhs.index_ <= rhs.index_;
+    }
+
+    friend bool operator>=(const soa_iterator& lhs,
+                           const soa_iterator& rhs) noexcept
+    {
+        return lhs.index_ >= rhs.index_;
+    }
+
+private:
+    columns_type columns_;
+    difference_type index_;
+};
+
+} // namespace detail
+
+/* --- Class soa_vector --- */
+/**
+ * Sequence container of aggregates which stores each field in its own
+ * contiguous array (structure of arrays), so that loops which read a few
+ * fields of every element only load those fields.
+ * @details Elements are accessed through proxy references, which convert to
+ * T and assign through to the fields. The arrays of the fields are available
+ * with data<I>(). Growing the container relocates every array: if the move
+ * constructor of every field is noexcept the fields are moved, otherwise they
+ * are all copied, so that an exception leaves the container unchanged.
+ * @tparam T The element type. Must be an aggregate with at most
+ * utility::max_fields fields, without base classes, C arrays or references,
+ * and must satisfy \c concepts::Movable.
+ */
+template<class T>
+class soa_vector
+{
+    static_assert(utility::reflectable_v<T>,
+                  "soa_vector requires an aggregate with at most "
+                  "utility::max_fields fields");
+    static_assert(concepts::Movable<T>,
+                  "soa_vector requires a Movable element type");
+
+    using columns_type = detail::soa_columns_t<T>;
+    using indices = std::make_index_sequence<utility::field_count_v<T>>;
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = detail::soa_reference<T, false>;
+    using const_reference = detail::soa_reference<T, true>;
+    using iterator = detail::soa_iterator<T, false>;
+    using const_iterator = detail::soa_iterator<T, true>;
+
+    /// Type of the field I of the elements
+    template<std::size_t I>
+    using field_type = detail::soa_field_t<I, T>;
+
+    /// Number of fields of the elements, that is, of arrays
+    static constexpr size_type field_count = utility::field_count_v<T>;
+
+    soa_vector() noexcept
+        : columns_{}, size_{0}, capacity_{0}
+    { }
+
+    explicit soa_vector(size_type n): soa_vector()
+    {
+        resize(n);
+    }
+
+    soa_vector(size_type n, const T& value): soa_vector()
+    {
+        resize(n, value);
+    }
+
+    soa_vector(std::initializer_list<T> values): soa_vector()
+    {
+        reserve(values.size());
+        for (const T& value: values) {
+            push_back(value);
+        }
+    }
+
+    soa_vector(const soa_vector& other): soa_vector()
+    {
+        reserve(other.size_);
+        copy_columns(other.columns_, other.size_, columns_, indices{});
+        size_ = other.size_;
+    }
+
+    soa_vector(soa_vector&& other) noexcept
+        : columns_{other.columns_}, size_{other.size_}
+        , capacity_{other.capacity_}
+    {
+        other.columns_ = columns_type{};
+        other.size_ = 0;
+        other.capacity_ = 0;
+    }
+
+    soa_vector& operator=(const soa_vector& other)
+    {
+        if (this != &other) {
+            soa_vector copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    soa_vector& operator=(soa_vector&& other) noexcept
+    {
+        soa_vector tmp(std::move(other));
+        swap(tmp);
+        return *this;
+    }
+
+    ~soa_vector()
+    {
+        clear();
+        deallocate(columns_, capacity_, indices{});
+    }
+
+    /* Element access */
+    reference operator[](size_type i) noexcept
+    {
+        return reference(columns_, i);
+    }
+
+    const_reference operator[](size_type i) const noexcept
+    {
+        return const_reference(const_columns(), i);
+    }
+
+    reference front() noexcept { return (*this)[0]; }
+    const_reference front() const noexcept { return (*this)[0]; }
+
+    reference back() noexcept { return (*this)[size_ - 1]; }
+    const_reference back() const noexcept { return (*this)[size_ - 1]; }
+
+    /// Array of the field I of the elements
+    template<std::size_t I>
+    field_type<I>* data() noexcept { return utility::get<I>(columns_); }
+
+    template<std::size_t I>
+    const field_type<I>* data() const noexcept
+    {
+        return utility::get<I>(columns_);
+    }
+
+    /* Iterators */
+    iterator begin() noexcept { return iterator(columns_, 0); }
+    iterator end() noexcept { return iterator(columns_, ssize()); }
+    const_iterator begin() const noexcept
+    { return const_iterator(const_columns(), 0); }
+    const_iterator end() const noexcept
+    { return const_iterator(const_columns(), ssize()); }
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+    /* Capacity */
+    bool empty() const noexcept { return size_ == 0; }
+    size_type size() const noexcept { return size_; }
+    size_type capacity() const noexcept { return capacity_; }
+
+    void reserve(size_type n)
+    {
+        if (n > capacity_) {
+            reallocate(n);
+        }
+    }
+
+    /* Modifiers */
+    void clear() noexcept
+    {
+        destroy(columns_, 0, size_, indices{});
+        size_ = 0;
+    }
+
+    /// Append an element whose fields are constructed from args, in order
+    template<class... Args>
+    reference emplace_back(Args&&... args)
+    {
+        static_assert(sizeof...(Args) == field_count,
+                      "emplace_back takes one argument per field");
+        if (size_ == capacity_) {
+            grow_and_emplace_back(std::forward<Args>(args)...);
+        } else {
+            construct(columns_, size_, indices{}, std::forward<Args>(args)...);
+        }
+        return (*this)[size_++];
+    }
+
+    void push_back(const T& value)
+    {
+        utility::apply([this](const auto&... fields) {
+            emplace_back(fields...);
+        }, utility::tie_fields(value));
+    }
+
+    void push_back(T&& value)
+    {
+        utility::apply([this](auto&... fields) {
+            emplace_back(std::move(fields)...);
+        }, utility::tie_fields(value));
+    }
+
+    void pop_back() noexcept
+    {
+        --size_;
+        destroy(columns_, size_, size_ + 1, indices{});
+    }
+
+    void resize(size_type n)
+    {
+        // Value initialized aggregates keep their default member initializers
+        resize(n, T{});
+    }
+
+    void resize(size_type n, const T& value)
+    {
+        if (n < size_) {
+            destroy(columns_, n, size_, indices{});
+            size_ = n;
+            return;
+        }
+        reserve(n);
+        while (size_ < n) {
+            push_back(value);
+        }
+    }
+
+    void swap(soa_vector& other) noexcept
+    {
+        std::swap(columns_, other.columns_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+    }
+
+    friend void swap(soa_vector& lhs, soa_vector& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    /* Comparison */
+    template<class U = T
+            ,class = std::enable_if_t<
+                detail::soa_fields_t<U>::equality_comparable>>
+    friend bool operator==(const soa_vector& lhs, const soa_vector& rhs)
+    {
+        return lhs.size_ == rhs.size_ &&
+               equal_columns(lhs.columns_, rhs.columns_, lhs.size_,
+                             indices{});
+    }
+
+    template<class U = T
+            ,class = std::enable_if_t<
+                detail::soa_fields_t<U>::equality_comparable>>
+    friend bool operator!=(const soa_vector& lhs, const soa_vector& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    detail::soa_columns_t<const T> const_columns() const noexcept
+    {
+        return detail::soa_columns_t<const T>(columns_);
+    }
+
+    difference_type ssize() const noexcept
+    {
+        return static_cast<difference_type>(size_);
+    }
+
+    // Arrays of n fields; on failure, the arrays allocated are released
+    template<std::size_t... Is>
+    static columns_type allocate(size_type n, std::index_sequence<Is...>)
+    {
+        columns_type columns{};
+        try {
+            ((utility::get<Is>(columns) =
+                  std::allocator<field_type<Is>>{}.allocate(n)), ...);
+        } catch (...) {
+            deallocate(columns, n, indices{});
+            throw;
+        }
+        return columns;
+    }
+
+    template<std::size_t... Is>
+    static void deallocate(const columns_type& columns, size_type n,
+                           std::index_sequence<Is...>) noexcept
+    {
+        ((utility::get<Is>(columns) != nullptr
+              ? std::allocator<field_type<Is>>{}.deallocate(
+                    utility::get<Is>(columns), n)
+              : void()), ...);
+    }
+
+    template<std::size_t... Is>
+    static void destroy(const columns_type& columns, size_type first,
+                        size_type last, std::index_sequence<Is...>) noexcept
+    {
+        (std::destroy(utility::get<Is>(columns) + first,
+                      utility::get<Is>(columns) + last), ...);
+    }
+
+    // Construct the fields of element i in order. If a constructor throws,
+    // the fields already constructed are destroyed.
+    template<std::size_t... Is, class... Args>
+    static void construct(const columns_type& columns, size_type i,
+                          std::index_sequence<Is...>, Args&&... args)
+    {
+        size_type constructed = 0;
+        try {
+            ((::new (static_cast<void*>(utility::get<Is>(columns) + i))
+                  field_type<Is>(std::forward<Args>(args)),
+              ++constructed), ...);
+        } catch (...) {
+            ((Is < constructed ? std::destroy_at(utility::get<Is>(columns) + i)
+                               : void()), ...);
+            throw;
+        }
+    }
+
+    // Copy n elements into uninitialized arrays. If a constructor throws, the
+    // arrays copied are destroyed.
+    template<std::size_t... Is>
+    static void copy_columns(const columns_type& from, size_type n,
+                             const columns_type& to,
+                             std::index_sequence<Is...>)
+    {
+        size_type copied = 0;
+        try {
+            ((std::uninitialized_copy_n(utility::get<Is>(from), n,
+                                        utility::get<Is>(to)),
+              ++copied), ...);
+        } catch (...) {
+            ((Is < copied ? void(std::destroy_n(utility::get<Is>(to), n))
+                          : void()), ...);
+            throw;
+        }
+    }
+
+    // Move n elements to uninitialized arrays, or copy them if a field may
+    // throw when moved, so that the elements are untouched if one throws
+    template<std::size_t... Is>
+    static void transfer(const columns_type& from, size_type n,
+                         const columns_type& to, std::index_sequence<Is...>)
+    {
+        if constexpr (detail::soa_fields_t<T>::nothrow_movable) {
+            (detail::relocate(utility::get<Is>(from), n,
+                              utility::get<Is>(to)), ...);
+        } else {
+            copy_columns(from, n, to, indices{});
+            destroy(from, 0, n, indices{});
+        }
+    }
+
+    template<std::size_t... Is>
+    static bool equal_columns(const columns_type& lhs, const columns_type& rhs,
+                              size_type n, std::index_sequence<Is...>)
+    {
+        return (std::equal(utility::get<Is>(lhs), utility::get<Is>(lhs) + n,
+                           utility::get<Is>(rhs)) && ...);
+    }
+
+    size_type next_capacity(size_type required) const noexcept
+    {
+        return std::max({required, 2 * capacity_, size_type{1}});
+    }
+
+    void reallocate(size_type new_capacity)
+    {
+        const columns_type buffer = allocate(new_capacity, indices{});
+        try {
+            transfer(columns_, size_, buffer, indices{});
+        } catch (...) {
+            deallocate(buffer, new_capacity, indices{});
+            throw;
+        }
+        deallocate(columns_, capacity_, indices{});
+        columns_ = buffer;
+        capacity_ = new_capacity;
+    }
+
+    // The new element is constructed before relocating the existing ones, as
+    // args may refer to fields of this container
+    template<class... Args>
+    void grow_and_emplace_back(Args&&... args)
+    {
+        const size_type new_capacity = next_capacity(size_ + 1);
+        const columns_type buffer = allocate(new_capacity, indices{});
+        try {
+            construct(buffer, size_, indices{}, std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(buffer, new_capacity, indices{});
+            throw;
+        }
+        try {
+            transfer(columns_, size_, buffer, indices{});
+        } catch (...) {
+            destroy(buffer, size_, size_ + 1, indices{});
+            deallocate(buffer, new_capacity, indices{});
+            throw;
+        }
+        deallocate(columns_, capacity_, indices{});
+        columns_ = buffer;
+        capacity_ = new_capacity;
+    }
+
+    columns_type columns_;
+    size_type size_;
+    size_type capacity_;
+};
+
+} // namespace containers
+
+namespace traits
+{
+/**
+ * The common reference of a soa_vector reference and the aggregate T is T,
+ * as the common reference of a proxy and its value type.
+ */
+template<class T, bool Const
+        ,template<class> class TQual, template<class> class UQual>
+struct basic_common_reference<containers::detail::soa_reference<T, Const>, T
+                             ,TQual, UQual>
+{
+    using type = T;
+};
+
+template<class T, bool Const
+        ,template<class> class TQual, template<class> class UQual>
+struct basic_common_reference<T, containers::detail::soa_reference<T, Const>
+                             ,TQual, UQual>
+{
+    using type = T;
+};
+
+/// References to elements and to const elements have the const reference
+template<class T, bool C1, bool C2
+        ,template<class> class TQual, template<class> class UQual>
+struct basic_common_reference<containers::detail::soa_reference<T, C1>
+                             ,containers::detail::soa_reference<T, C2>
+                             ,TQual, UQual>
+{
+    using type = containers::detail::soa_reference<T, C1 || C2>;
+};
+
+} // namespace traits
+
+#endif //DETAIL_SOA_VECTOR_H
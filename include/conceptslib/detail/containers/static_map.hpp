@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_STATIC_MAP_H
+#define DETAIL_STATIC_MAP_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+#include <conceptslib/detail/concepts/object.hpp>
+#include <conceptslib/detail/containers/ordered_lookup.hpp>
+#include <conceptslib/detail/containers/static_vector.hpp>
+
+namespace containers
+{
+/// Element of a static_map. Unlike std::pair, its assignment is constexpr.
+template<class K, class V>
+struct static_map_entry
+{
+    K first;
+    V second;
+
+    friend constexpr bool operator==(const static_map_entry& lhs,
+                                     const static_map_entry& rhs)
+    {
+        return lhs.first == rhs.first && lhs.second == rhs.second;
+    }
+
+    friend constexpr bool operator!=(const static_map_entry& lhs,
+                                     const static_map_entry& rhs)
+    {
+        return !(lhs == rhs);
+    }
+};
+
+/* --- Class static_map --- */
+/**
+ * Ordered associative container of at most N unique keys, which is usable in
+ * constant expressions.
+ * @details The elements are kept sorted by key in a static_vector, and looked
+ * up by binary search. A static_map built by a constexpr function, or from a
+ * list of elements, is a constant: its lookups need no initialization at
+ * startup. Lookups accept any key type Q which satisfies
+ * \c concepts::StrictTotallyOrderedWith<K, Q>, without converting it to K.
+ * Exceeding the capacity throws std::length_error, which is a compile error
+ * during constant evaluation.
+ * @tparam K The key type. Must satisfy \c concepts::StrictTotallyOrdered and
+ * \c concepts::Semiregular.
+ * @tparam V The mapped type. Must satisfy \c concepts::Semiregular.
+ * @tparam N The capacity.
+ */
+template<class K, class V, std::size_t N>
+class static_map
+{
+    static_assert(concepts::StrictTotallyOrdered<K>,
+                  "static_map requires a StrictTotallyOrdered key type");
+    static_assert(concepts::Semiregular<K> && concepts::Semiregular<V>,
+                  "static_map requires Semiregular key and mapped types");
+
+    template<class Q>
+    using if_heterogeneous =
+        std::enable_if_t<detail::heterogeneous_lookup_v<K, Q>, int>;
+
+public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = static_map_entry<K, V>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = value_type*;
+    using const_iterator = const value_type*;
+
+    constexpr static_map() = default;
+
+    /// Insert the elements in order: of equal keys, the first one is kept
+    constexpr static_map(std::initializer_list<value_type> elements)
+    {
+        for (const value_type& element: elements) {
+            insert(element);
+        }
+    }
+
+    /* Element access */
+    constexpr const V& at(const K& key) const
+    {
+        const_iterator it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("static_map key not found");
+        }
+        return it->second;
+    }
+
+    template<class Q, if_heterogeneous<Q> = 0>
+    constexpr const V& at(const Q& key) const
+    {
+        const_iterator it = find(key);
+        if (it == end()) {
+            throw std::out_of_range("static_map key not found");
+        }
+        return it->second;
+    }
+
+    constexpr V& operator[](const K& key)
+    {
+        return try_emplace(key).first->second;
+    }
+
+    /* Iterators */
+    constexpr iterator begin() noexcept { return elements_.begin(); }
+    constexpr iterator end() noexcept { return elements_.end(); }
+    constexpr const_iterator begin() const noexcept
+    { return elements_.begin(); }
+    constexpr const_iterator end() const noexcept { return elements_.end(); }
+    constexpr const_iterator cbegin() const noexcept { return begin(); }
+    constexpr const_iterator cend() const noexcept { return end(); }
+
+    /* Capacity */
+    constexpr bool empty() const noexcept { return elements_.empty(); }
+    constexpr size_type size() const noexcept { return elements_.size(); }
+    static constexpr size_type capacity() noexcept { return N; }
+
+    /* Modifiers */
+    constexpr void clear() noexcept { elements_.clear(); }
+
+    constexpr std::pair<iterator, bool> insert(const value_type& element)
+    {
+        return try_emplace(element.first, element.second);
+    }
+
+    template<class... Args>
+    constexpr std::pair<iterator, bool> try_emplace(const K& key,
+                                                    Args&&... args)
+    {
+        const size_type i = lower_index(key);
+        if (i != size() && !(key < elements_[i].first)) {
+            return {begin() + i, false};
+        }
+        value_type element{key, V(std::forward<Args>(args)...)};
+        return {elements_.emplace(elements_.begin() + i, std::move(element)),
+                true};
+    }
+
+    template<class M>
+    constexpr std::pair<iterator, bool> insert_or_assign(const K& key,
+                                                         M&& value)
+    {
+        auto result = try_emplace(key, std::forward<M>(value));
+        if (!result.second) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    constexpr size_type erase(const K& key)
+    {
+        const_iterator it = find(key);
+        if (it == end()) {
+            return 0;
+        }
+        elements_.erase(it);
+        return 1;
+    }
+
+    /* Lookup */
+    constexpr iterator find(const K& key) { return find_key(*this, key); }
+    constexpr const_iterator find(const K& key) const
+    { return find_key(*this, key); }
+
+    template<class Q, if_heterogeneous<Q> = 0>
+    constexpr iterator find(const Q& key) { return find_key(*this, key); }
+
+    template<class Q, if_heterogeneous<Q> = 0>
+    constexpr const_iterator find(const Q& key) const
+    { return find_key(*this, key); }
+
+    constexpr bool contains(const K& key) const { return find(key) != end(); }
+
+    template<class Q, if_heterogeneous<Q> = 0>
+    constexpr bool contains(const Q& key) const { return find(key) != end(); }
+
+    constexpr size_type count(const K& key) const
+    { return contains(key) ? 1 : 0; }
+
+    template<class Q, if_heterogeneous<Q> = 0>
+    constexpr size_type count(const Q& key) const
+    { return contains(key) ? 1 : 0; }
+
+    /* Comparison */
+    friend constexpr bool operator==(const static_map& lhs,
+                                     const static_map& rhs)
+    {
+        return lhs.elements_ == rhs.elements_;
+    }
+
+    friend constexpr bool operator!=(const static_map& lhs,
+                                     const static_map& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    // Binary search: std::lower_bound is not constexpr in C++17
+    template<class Q>
+    constexpr size_type lower_index(const Q& key) const
+    {
+        size_type first = 0;
+        size_type n = size();
+        while (n > 0) {
+            const size_type half = n / 2;
+            if (elements_[first + half].first < key) {
+                first += half + 1;
+                n -= half + 1;
+            } else {
+                n = half;
+            }
+        }
+        return first;
+    }
+
+    template<class Self, class Q>
+    static constexpr auto find_key(Self& self, const Q& key)
+        -> decltype(self.begin())
+    {
+        const size_type i = self.lower_index(key);
+        if (i != self.size() && !(key < self.elements_[i].first)) {
+            return self.begin() + i;
+        }
+        return self.end();
+    }
+
+    static_vector<value_type, N> elements_;
+};
+
+} // namespace containers
+
+#endif //DETAIL_STATIC_MAP_H
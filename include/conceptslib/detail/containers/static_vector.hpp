@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_STATIC_VECTOR_H
+#define DETAIL_STATIC_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/object.hpp>
+
+namespace containers
+{
+/* --- Class static_vector --- */
+/**
+ * Sequence container of at most N elements, stored inline, which is usable in
+ * constant expressions.
+ * @details Unlike small_vector, all N elements are always constructed: the
+ * ones past the size hold default constructed values. This is what lets a
+ * static_vector be built and modified during constant evaluation in C++17,
+ * and be the value of a constexpr variable. Exceeding the capacity throws
+ * std::length_error, which is a compile error during constant evaluation.
+ * @tparam T The element type. Must satisfy \c concepts::Semiregular.
+ * @tparam N The capacity.
+ */
+template<class T, std::size_t N>
+class static_vector
+{
+    static_assert(concepts::Semiregular<T>,
+                  "static_vector requires a Semiregular element type");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    constexpr static_vector() = default;
+
+    constexpr static_vector(std::initializer_list<T> values)
+    {
+        for (const T& value: values) {
+            push_back(value);
+        }
+    }
+
+    constexpr static_vector(size_type n, const T& value)
+    {
+        resize(n, value);
+    }
+
+    /* Element access */
+    constexpr reference operator[](size_type i) noexcept { return data_[i]; }
+    constexpr const_reference operator[](size_type i) const noexcept
+    { return data_[i]; }
+
+    constexpr reference at(size_type i)
+    {
+        check_index(i);
+        return data_[i];
+    }
+
+    constexpr const_reference at(size_type i) const
+    {
+        check_index(i);
+        return data_[i];
+    }
+
+    constexpr reference front() noexcept { return data_[0]; }
+    constexpr const_reference front() const noexcept { return data_[0]; }
+
+    constexpr reference back() noexcept { return data_[size_ - 1]; }
+    constexpr const_reference back() const noexcept
+    { return data_[size_ - 1]; }
+
+    constexpr T* data() noexcept { return data_; }
+    constexpr const T* data() const noexcept { return data_; }
+
+    /* Iterators */
+    constexpr iterator begin() noexcept { return data_; }
+    constexpr iterator end() noexcept { return data_ + size_; }
+    constexpr const_iterator begin() const noexcept { return data_; }
+    constexpr const_iterator end() const noexcept { return data_ + size_; }
+    constexpr const_iterator cbegin() const noexcept { return begin(); }
+    constexpr const_iterator cend() const noexcept { return end(); }
+
+    reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+    reverse_iterator rend() noexcept { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const noexcept
+    { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const noexcept
+    { return const_reverse_iterator(begin()); }
+
+    /* Capacity */
+    constexpr bool empty() const noexcept { return size_ == 0; }
+    constexpr size_type size() const noexcept { return size_; }
+    static constexpr size_type capacity() noexcept { return N; }
+    static constexpr size_type max_size() noexcept { return N; }
+    constexpr bool full() const noexcept { return size_ == N; }
+
+    /* Modifiers */
+    constexpr void clear() noexcept
+    {
+        while (size_ != 0) {
+            data_[--size_] = T();
+        }
+    }
+
+    template<class... Args>
+    constexpr reference emplace_back(Args&&... args)
+    {
+        check_capacity(size_ + 1);
+        data_[size_] = T(std::forward<Args>(args)...);
+        return data_[size_++];
+    }
+
+    constexpr void push_back(const T& value) { emplace_back(value); }
+    constexpr void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    constexpr void pop_back() noexcept
+    {
+        data_[--size_] = T();
+    }
+
+    template<class... Args>
+    constexpr iterator emplace(const_iterator pos, Args&&... args)
+    {
+        const auto i = static_cast<size_type>(pos - begin());
+        check_capacity(size_ + 1);
+        // args may refer to an element which is about to be shifted
+        T value(std::forward<Args>(args)...);
+        for (size_type j = size_; j > i; --j) {
+            data_[j] = std::move(data_[j - 1]);
+        }
+        data_[i] = std::move(value);
+        ++size_;
+        return begin() + i;
+    }
+
+    constexpr iterator insert(const_iterator pos, const T& value)
+    {
+        return emplace(pos, value);
+    }
+
+    constexpr iterator insert(const_iterator pos, T&& value)
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    constexpr iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    constexpr iterator erase(const_iterator first, const_iterator last)
+    {
+        const auto i = static_cast<size_type>(first - begin());
+        const auto count = static_cast<size_type>(last - first);
+        for (size_type j = i; j + count < size_; ++j) {
+            data_[j] = std::move(data_[j + count]);
+        }
+        for (size_type j = 0; j < count; ++j) {
+            data_[--size_] = T();
+        }
+        return begin() + i;
+    }
+
+    constexpr void resize(size_type n)
+    {
+        resize(n, T());
+    }
+
+    constexpr void resize(size_type n, const T& value)
+    {
+        check_capacity(n);
+        // Indexed up from n: popping down from size_, which the optimizer
+        // does not know to be at most N, warns of out of bounds subscripts
+        if (n < size_) {
+            for (size_type j = n; j < size_; ++j) {
+                data_[j] = T();
+            }
+            size_ = n;
+        }
+        while (size_ < n) {
+            data_[size_++] = value;
+        }
+    }
+
+    /* Comparison */
+    friend constexpr bool operator==(const static_vector& lhs,
+                                     const static_vector& rhs)
+    {
+        if (lhs.size_ != rhs.size_) {
+            return false;
+        }
+        for (size_type i = 0; i < lhs.size_; ++i) {
+            if (!(lhs.data_[i] == rhs.data_[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    friend constexpr bool operator!=(const static_vector& lhs,
+                                     const static_vector& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    constexpr void check_capacity(size_type n) const
+    {
+        if (n > N) {
+            throw std::length_error("static_vector capacity exceeded");
+        }
+    }
+
+    constexpr void check_index(size_type i) const
+    {
+        if (i >= size_) {
+            throw std::out_of_range("static_vector index out of range");
+        }
+    }
+
+    T data_[N > 0 ? N : 1]{};
+    size_type size_ = 0;
+};
+
+} // namespace containers
+
+#endif //DETAIL_STATIC_VECTOR_H
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_ADAPTORS_H
+#define DETAIL_ADAPTORS_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/core.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+#include <conceptslib/detail/concepts/callable.hpp>
+#include <conceptslib/detail/functional/invoke.hpp>
+#include <conceptslib/detail/utility/tuple.hpp>
+
+namespace functional
+{
+namespace detail
+{
+/* --- Class template adaptor --- */
+/**
+ * Base of the callable adaptors: stores the callables and bound arguments
+ * Ts... and forwards calls to Derived::call(self, args...), where self has
+ * the cv and reference qualifiers of the adaptor. The call operators name
+ * Derived through the parameter D, which delays the lookup of call until
+ * Derived is complete.
+ * @details The state is a utility::tuple, so empty callables such as
+ * captureless lambdas and function objects take no space.
+ */
+template<class Derived, class... Ts>
+class adaptor
+{
+public:
+    template<class... Us>
+    constexpr explicit adaptor(std::in_place_t, Us&&... values)
+        : state_(std::forward<Us>(values)...)
+    { }
+
+    template<class... Args, class D = Derived>
+    constexpr auto operator()(Args&&... args) &
+        noexcept(noexcept(D::call(std::declval<D&>()
+                                 ,std::declval<Args>()...)))
+        -> decltype(D::call(std::declval<D&>()
+                           ,std::declval<Args>()...))
+    {
+        return D::call(static_cast<D&>(*this),
+                       std::forward<Args>(args)...);
+    }
+
+    template<class... Args, class D = Derived>
+    constexpr auto operator()(Args&&... args) const &
+        noexcept(noexcept(D::call(std::declval<const D&>()
+                                 ,std::declval<Args>()...)))
+        -> decltype(D::call(std::declval<const D&>()
+                           ,std::declval<Args>()...))
+    {
+        return D::call(static_cast<const D&>(*this),
+                       std::forward<Args>(args)...);
+    }
+
+    template<class... Args, class D = Derived>
+    constexpr auto operator()(Args&&... args) &&
+        noexcept(noexcept(D::call(std::declval<D>()
+                                 ,std::declval<Args>()...)))
+        -> decltype(D::call(std::declval<D>()
+                           ,std::declval<Args>()...))
+    {
+        return D::call(static_cast<D&&>(*this),
+                       std::forward<Args>(args)...);
+    }
+
+    template<class... Args, class D = Derived>
+    constexpr auto operator()(Args&&... args) const &&
+        noexcept(noexcept(D::call(std::declval<const D>()
+                                 ,std::declval<Args>()...)))
+        -> decltype(D::call(std::declval<const D>()
+                           ,std::declval<Args>()...))
+    {
+        return D::call(static_cast<const D&&>(*this),
+                       std::forward<Args>(args)...);
+    }
+
+protected:
+    // Element I of the state of self, with the qualifiers of self
+    template<std::size_t I, class Self>
+    static constexpr decltype(auto) element(Self&& self) noexcept
+    {
+        return utility::get<I>(std::forward<Self>(self).state_);
+    }
+
+    template<std::size_t I, class Self>
+    using element_t = decltype(element<I>(std::declval<Self>()));
+
+private:
+    utility::tuple<Ts...> state_;
+};
+
+/* --- Class template front_binder --- */
+template<class F, class... BoundArgs>
+class front_binder
+    : public adaptor<front_binder<F, BoundArgs...>, F, BoundArgs...>
+{
+    using base_t = adaptor<front_binder, F, BoundArgs...>;
+    friend base_t;
+
+    template<std::size_t I, class Self>
+    using element_t = typename base_t::template element_t<I, Self>;
+
+    template<class Self, std::size_t... Is, class... Args>
+    static constexpr auto call_imp(Self&& self, std::index_sequence<Is...>,
+                                   Args&&... args)
+        noexcept(noexcept(functional::invoke(
+            base_t::template element<0>(std::forward<Self>(self)),
+            base_t::template element<Is + 1>(std::forward<Self>(self))...,
+            std::forward<Args>(args)...)))
+        -> std::enable_if_t<
+            concepts::Invocable<element_t<0, Self>
+                               ,element_t<Is + 1, Self>..., Args...>
+           ,invoke_result_t<element_t<0, Self>
+                           ,element_t<Is + 1, Self>..., Args...>>
+    {
+        return functional::invoke(
+            base_t::template element<0>(std::forward<Self>(self)),
+            base_t::template element<Is + 1>(std::forward<Self>(self))...,
+            std::forward<Args>(args)...);
+    }
+
+    template<class Self, class... Args>
+    static constexpr auto call(Self&& self, Args&&... args)
+        noexcept(noexcept(call_imp(std::forward<Self>(self)
+                                  ,std::index_sequence_for<BoundArgs...>{}
+                                  ,std::forward<Args>(args)...)))
+        -> decltype(call_imp(std::forward<Self>(self)
+                            ,std::index_sequence_for<BoundArgs...>{}
+                            ,std::forward<Args>(args)...))
+    {
+        return call_imp(std::forward<Self>(self),
+                        std::index_sequence_for<BoundArgs...>{},
+                        std::forward<Args>(args)...);
+    }
+
+public:
+    using base_t::base_t;
+};
+
+/* --- Class template composition --- */
+template<class F, class G>
+class composition: public adaptor<composition<F, G>, F, G>
+{
+    using base_t = adaptor<composition, F, G>;
+    friend base_t;
+
+    template<std::size_t I, class Self>
+    using element_t = typename base_t::template element_t<I, Self>;
+
+    template<class Self, class... Args>
+    static constexpr auto call(Self&& self, Args&&... args)
+        noexcept(noexcept(functional::invoke(
+            base_t::template element<0>(std::forward<Self>(self)),
+            functional::invoke(
+                base_t::template element<1>(std::forward<Self>(self)),
+                std::forward<Args>(args)...))))
+        -> std::enable_if_t<
+            concepts::Invocable<element_t<1, Self>, Args...> &&
+            concepts::Invocable<element_t<0, Self>
+                               ,invoke_result_t<element_t<1, Self>, Args...>>
+           ,invoke_result_t<element_t<0, Self>
+                           ,invoke_result_t<element_t<1, Self>, Args...>>>
+    {
+        return functional::invoke(
+            base_t::template element<0>(std::forward<Self>(self)),
+            functional::invoke(
+                base_t::template element<1>(std::forward<Self>(self)),
+                std::forward<Args>(args)...));
+    }
+
+public:
+    using base_t::base_t;
+};
+
+/* --- Class template projection --- */
+template<class F, class P>
+class projection: public adaptor<projection<F, P>, F, P>
+{
+    using base_t = adaptor<projection, F, P>;
+    friend base_t;
+
+    template<std::size_t I, class Self>
+    using element_t = typename base_t::template element_t<I, Self>;
+
+    // The projection is invoked once per argument, so always as an lvalue
+    template<class Self, class... Args>
+    static constexpr auto call(Self&& self, Args&&... args)
+        noexcept(noexcept(functional::invoke(
+            base_t::template element<0>(std::forward<Self>(self)),
+            functional::invoke(base_t::template element<1>(self),
+                               std::forward<Args>(args))...)))
+        -> std::enable_if_t<
+            (concepts::Invocable<element_t<1, Self&>, Args> && ...) &&
+            concepts::Invocable<element_t<0, Self>
+                               ,invoke_result_t<element_t<1, Self&>, Args>...>
+           ,invoke_result_t<element_t<0, Self>
+                           ,invoke_result_t<element_t<1, Self&>, Args>...>>
+    {
+        return functional::invoke(
+            base_t::template element<0>(std::forward<Self>(self)),
+            functional::invoke(base_t::template element<1>(self),
+                               std::forward<Args>(args))...);
+    }
+
+public:
+    using base_t::base_t;
+};
+
+// Whether the decayed copy of T can be made from T and then moved
+template<class... Ts>
+inline constexpr bool decay_copyable_v =
+    ((concepts::Constructible<std::decay_t<Ts>, Ts> &&
+      concepts::MoveConstructible<std::decay_t<Ts>>) && ...);
+
+} // namespace detail
+
+/* --- Function bind_front --- */
+/**
+ * Bind the leading arguments of f
+ * @details bind_front(f, bound...)(args...) is equivalent to
+ * invoke(f, bound..., args...). The adaptor stores decayed copies of f and
+ * bound..., passes them with the value category and constness of the adaptor
+ * and propagates noexcept. Its call operator participates in overload
+ * resolution only if the invocation satisfies \c concepts::Invocable.
+ */
+template<class F, class... Args>
+constexpr auto bind_front(F&& f, Args&&... args)
+    -> std::enable_if_t<
+        detail::decay_copyable_v<F, Args...>
+       ,detail::front_binder<std::decay_t<F>, std::decay_t<Args>...>>
+{
+    return detail::front_binder<std::decay_t<F>, std::decay_t<Args>...>(
+        std::in_place, std::forward<F>(f), std::forward<Args>(args)...);
+}
+
+/* --- Function compose --- */
+/**
+ * Compose callables, applying the rightmost one first
+ * @details compose(f, g)(args...) is equivalent to
+ * invoke(f, invoke(g, args...)), and compose(f, g, h...) to
+ * compose(f, compose(g, h...)). Stores decayed copies of the callables, like
+ * \c bind_front.
+ */
+template<class F, class G>
+constexpr auto compose(F&& f, G&& g)
+    -> std::enable_if_t<
+        detail::decay_copyable_v<F, G>
+       ,detail::composition<std::decay_t<F>, std::decay_t<G>>>
+{
+    return detail::composition<std::decay_t<F>, std::decay_t<G>>(
+        std::in_place, std::forward<F>(f), std::forward<G>(g));
+}
+
+template<class F, class G, class H, class... Hs>
+constexpr auto compose(F&& f, G&& g, H&& h, Hs&&... hs)
+{
+    return functional::compose(
+        std::forward<F>(f),
+        functional::compose(std::forward<G>(g), std::forward<H>(h),
+                            std::forward<Hs>(hs)...));
+}
+
+/* --- Function projected --- */
+/**
+ * Apply a projection to every argument of f
+ * @details projected(f, p)(args...) is equivalent to
+ * invoke(f, invoke(p, args)...), as the projections taken by algorithms.
+ * Stores decayed copies of the callables, like \c bind_front; p is passed as
+ * an lvalue, since it is invoked once per argument.
+ */
+template<class F, class P>
+constexpr auto projected(F&& f, P&& p)
+    -> std::enable_if_t<
+        detail::decay_copyable_v<F, P>
+       ,detail::projection<std::decay_t<F>, std::decay_t<P>>>
+{
+    return detail::projection<std::decay_t<F>, std::decay_t<P>>(
+        std::in_place, std::forward<F>(f), std::forward<P>(p));
+}
+
+} // namespace functional
+
+#endif //DETAIL_ADAPTORS_H
@@ -24,10 +24,10 @@ inline namespace invoke_ {
 
 /* --- metafunction is_reference_wrapper --- */
 template<class>
-constexpr bool is_reference_wrapper_v = false;
+inline constexpr bool is_reference_wrapper_v = false;
 
 template<class T>
-constexpr bool is_reference_wrapper_v<std::reference_wrapper<T>> = true;
+inline constexpr bool is_reference_wrapper_v<std::reference_wrapper<T>> = true;
 
 struct fn {
 private:
@@ -68,7 +68,7 @@ private:
             std::is_function_v<T> &&
             !is_reference_wrapper_v<std::decay_t<Pointer>> &&
             !std::is_base_of_v<Base, std::decay_t<Pointer>>, decltype((
-                    (*std::forward<Pointer>(*ptr)).*pmf)
+                    (*std::forward<Pointer>(ptr)).*pmf)
                     (std::forward<Args>(args)...))>
     {
         return ((*std::forward<Pointer>(ptr)).*pmf)(
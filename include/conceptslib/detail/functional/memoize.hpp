@@ -0,0 +1,435 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_MEMOIZE_H
+#define DETAIL_MEMOIZE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/callable.hpp>
+#include <conceptslib/detail/concepts/hashing.hpp>
+#include <conceptslib/detail/concepts/object.hpp>
+#include <conceptslib/detail/containers/hash_map.hpp>
+#include <conceptslib/detail/functional/invoke.hpp>
+#include <conceptslib/detail/macros/platform_detection.hpp>
+#include <conceptslib/detail/type_traits/type_traits.hpp>
+#include <conceptslib/detail/utility/tuple.hpp>
+
+namespace functional
+{
+namespace detail
+{
+/// Hash of a list of arguments, with containers::hash for each of them
+/// @note std::hash of integers is the identity: the high bits of a product
+/// mix it, so that the shards and buckets taken from any bits are uniform
+template<class... Args>
+std::uint32_t arguments_tag(const Args&... args)
+{
+    std::uint64_t h = 0;
+    ((h ^= containers::hash<Args>{}(args) + 0x9e3779b97f4a7c15ull +
+           (h << 6) + (h >> 2)), ...);
+    return static_cast<std::uint32_t>((h * 0x9e3779b97f4a7c15ull) >> 32);
+}
+
+/* --- Class clock_cache --- */
+/**
+ * Bounded cache of the results R of calls with arguments Args..., which holds
+ * up to Capacity results and evicts them with the CLOCK algorithm.
+ * @details The arguments and results are stored in dense vectors, indexed by
+ * an open addressing table with linear probing, which stores for each entry
+ * its position and 32 bits of its hash, as containers::hash_map does. Each
+ * entry has a reference bit, set when it is found. To make room, the hand of
+ * the clock sweeps the entries, clearing the bits it finds set, and evicts
+ * the first entry whose bit is clear: an approximation of least recently
+ * used which costs a store on hits instead of updating a list.
+ */
+template<class R, std::size_t Capacity, class... Args>
+class clock_cache
+{
+    static_assert(Capacity > 0 && Capacity < (std::size_t{1} << 31),
+                  "clock_cache requires a capacity in [1, 2^31)");
+
+    using key_type = utility::tuple<Args...>;
+
+    static constexpr std::uint32_t empty_index = 0xFFFFFFFFu;
+
+    struct bucket
+    {
+        std::uint32_t index;
+        std::uint32_t tag;
+    };
+
+    // The table is at most half full
+    static constexpr std::size_t bucket_count()
+    {
+        std::size_t buckets = 8;
+        while (buckets < 2 * Capacity) {
+            buckets *= 2;
+        }
+        return buckets;
+    }
+
+public:
+    clock_cache(): buckets_(bucket_count(), bucket{empty_index, 0})
+    { }
+
+    std::size_t size() const noexcept { return keys_.size(); }
+
+    /// The cached result of the call with args, or nullptr
+    const R* find(std::uint32_t tag, const Args&... args)
+    {
+        const std::uint32_t index = buckets_[find_bucket(tag, args...)].index;
+        if (index == empty_index) {
+            return nullptr;
+        }
+        referenced_[index] = true;
+        return &values_[index];
+    }
+
+    /// Cache the result of the call with args, which must not be cached
+    /// @details The arguments are copied before the table changes: if a copy
+    /// throws, the cache is left as it was.
+    void insert(std::uint32_t tag, const Args&... args, R value)
+    {
+        key_type key(args...);
+        std::size_t index = keys_.size();
+        if (index < Capacity) {
+            try {
+                keys_.push_back(std::move(key));
+                values_.push_back(std::move(value));
+                tags_.push_back(tag);
+                referenced_.push_back(false);
+            } catch (...) {
+                truncate(index);
+                throw;
+            }
+        } else {
+            // If an assignment throws, the entry is left without a bucket:
+            // it cannot be found, and evict() takes it again
+            index = evict();
+            keys_[index] = std::move(key);
+            values_[index] = std::move(value);
+            tags_[index] = tag;
+            referenced_[index] = false;
+        }
+        buckets_[find_bucket(tag, args...)] =
+            bucket{static_cast<std::uint32_t>(index), tag};
+    }
+
+    void clear() noexcept
+    {
+        keys_.clear();
+        values_.clear();
+        tags_.clear();
+        referenced_.clear();
+        for (bucket& b: buckets_) {
+            b.index = empty_index;
+        }
+        hand_ = 0;
+    }
+
+private:
+    // Bucket at which the probe for a tag starts (Fibonacci hashing)
+    std::size_t home_of(std::uint32_t tag) const noexcept
+    {
+        const std::uint64_t product = tag * 0x9e3779b97f4a7c15ull;
+        return static_cast<std::size_t>(product >> 32) & (buckets_.size() - 1);
+    }
+
+    bool equal(std::uint32_t index, const Args&... args) const
+    {
+        return equal(keys_[index], std::index_sequence_for<Args...>{},
+                     args...);
+    }
+
+    template<std::size_t... Is>
+    static bool equal(const key_type& key, std::index_sequence<Is...>,
+                      const Args&... args)
+    {
+        return ((utility::get<Is>(key) == args) && ...);
+    }
+
+    // Bucket of the entry of args, or the empty bucket ending its probe
+    std::size_t find_bucket(std::uint32_t tag, const Args&... args) const
+    {
+        const std::size_t mask = buckets_.size() - 1;
+        for (std::size_t i = home_of(tag);; i = (i + 1) & mask) {
+            const bucket& b = buckets_[i];
+            if (b.index == empty_index ||
+                (b.tag == tag && equal(b.index, args...))) {
+                return i;
+            }
+        }
+    }
+
+    // Advance the hand to an entry which was not referenced since its last
+    // sweep, and remove it from the table
+    std::size_t evict()
+    {
+        while (referenced_[hand_]) {
+            referenced_[hand_] = false;
+            hand_ = hand_ + 1 == Capacity ? 0 : hand_ + 1;
+        }
+        const std::size_t victim = hand_;
+        hand_ = hand_ + 1 == Capacity ? 0 : hand_ + 1;
+
+        // The probe of the victim ends at an empty bucket if it has none
+        const std::size_t mask = buckets_.size() - 1;
+        std::size_t i = home_of(tags_[victim]);
+        while (buckets_[i].index != victim &&
+               buckets_[i].index != empty_index) {
+            i = (i + 1) & mask;
+        }
+        if (buckets_[i].index == victim) {
+            erase_bucket(i);
+        }
+        return victim;
+    }
+
+    // Drop the entries from index on, after a failed insertion
+    void truncate(std::size_t index) noexcept
+    {
+        while (keys_.size() > index) {
+            keys_.pop_back();
+        }
+        while (values_.size() > index) {
+            values_.pop_back();
+        }
+        while (tags_.size() > index) {
+            tags_.pop_back();
+        }
+        while (referenced_.size() > index) {
+            referenced_.pop_back();
+        }
+    }
+
+    // Empty the bucket i, shifting back the next buckets of the probe whose
+    // home is not after the hole
+    void erase_bucket(std::size_t i)
+    {
+        const std::size_t mask = buckets_.size() - 1;
+        std::size_t hole = i;
+        for (std::size_t j = (i + 1) & mask; buckets_[j].index != empty_index;
+             j = (j + 1) & mask) {
+            const std::size_t home = home_of(buckets_[j].tag);
+            const bool stays = hole <= j ? hole < home && home <= j
+                                         : hole < home || home <= j;
+            if (!stays) {
+                buckets_[hole] = buckets_[j];
+                hole = j;
+            }
+        }
+        buckets_[hole].index = empty_index;
+    }
+
+    std::vector<key_type> keys_;
+    std::vector<R> values_;
+    std::vector<std::uint32_t> tags_;
+    std::vector<bool> referenced_;
+    std::vector<bucket> buckets_;
+    std::size_t hand_ = 0;
+};
+
+template<class F, class... Args>
+using memo_result_t =
+    traits::remove_cvref_t<invoke_result_t<F, const Args&...>>;
+
+} // namespace detail
+
+/* --- Class memoize --- */
+/**
+ * Wrap the function f, caching the results of up to Capacity calls.
+ * @details A call with arguments already cached returns the cached result
+ * without calling f. This is only valid because f satisfies
+ * \c concepts::RegularInvocable: calls with equal arguments are equality
+ * preserving, so they have equal results. The arguments are hashed with
+ * \c containers::hash and stored in a bounded open addressing table, with
+ * CLOCK eviction (see \c detail::clock_cache). f is called before the cache
+ * changes: if it throws, nothing is cached. memoize is not thread safe: see
+ * \c sharded_memoize.
+ * @tparam F Must satisfy \c concepts::RegularInvocable<F&, const Args&...>,
+ * and return a Copyable type.
+ * @tparam Capacity The maximum number of cached results.
+ * @tparam Args The arguments of the calls. Must satisfy \c concepts::Regular
+ * and \c concepts::Hashable<Args, containers::hash<Args>>.
+ */
+template<class F, std::size_t Capacity, class... Args>
+class memoize
+{
+    static_assert(concepts::RegularInvocable<F&, const Args&...>,
+                  "memoize requires a RegularInvocable function");
+    static_assert((concepts::Regular<Args> && ...),
+                  "memoize requires Regular arguments");
+    static_assert((concepts::Hashable<Args, containers::hash<Args>> && ...),
+                  "memoize requires Hashable arguments");
+
+public:
+    using result_type = detail::memo_result_t<F&, Args...>;
+
+    static_assert(concepts::Copyable<result_type>,
+                  "memoize requires a Copyable result type");
+
+    explicit memoize(F f): f_(std::move(f))
+    { }
+
+    result_type operator()(const Args&... args)
+    {
+        const std::uint32_t tag = detail::arguments_tag(args...);
+        if (const result_type* cached = cache_.find(tag, args...)) {
+            ++hits_;
+            return *cached;
+        }
+        result_type result = functional::invoke(f_, args...);
+        ++misses_;
+        cache_.insert(tag, args..., result);
+        return result;
+    }
+
+    static constexpr std::size_t capacity() noexcept { return Capacity; }
+    std::size_t size() const noexcept { return cache_.size(); }
+    std::size_t hits() const noexcept { return hits_; }
+    std::size_t misses() const noexcept { return misses_; }
+
+    /// Forget every cached result, and reset the counters
+    void clear() noexcept
+    {
+        cache_.clear();
+        hits_ = 0;
+        misses_ = 0;
+    }
+
+private:
+    F f_;
+    detail::clock_cache<result_type, Capacity, Args...> cache_;
+    std::size_t hits_ = 0;
+    std::size_t misses_ = 0;
+};
+
+/* --- Class sharded_memoize --- */
+/**
+ * Thread safe memoize: the cache is split in Shards shards, each with its own
+ * mutex and a share of the capacity, chosen by the hash of the arguments.
+ * @details Threads calling with arguments of different shards do not contend.
+ * The lock of a shard is not held while f runs: threads which miss the same
+ * arguments at the same time may each call f, and the first result is kept.
+ * Each shard lives on its own cache lines.
+ * @tparam F Must satisfy \c concepts::RegularInvocable<const F&,
+ * const Args&...>: f is called concurrently.
+ */
+template<class F, std::size_t Capacity, std::size_t Shards, class... Args>
+class sharded_memoize
+{
+    static_assert(Shards > 0, "sharded_memoize requires at least one shard");
+    static_assert(concepts::RegularInvocable<const F&, const Args&...>,
+                  "sharded_memoize requires a RegularInvocable function");
+    static_assert((concepts::Regular<Args> && ...),
+                  "sharded_memoize requires Regular arguments");
+    static_assert((concepts::Hashable<Args, containers::hash<Args>> && ...),
+                  "sharded_memoize requires Hashable arguments");
+
+public:
+    using result_type = detail::memo_result_t<const F&, Args...>;
+
+    static_assert(concepts::Copyable<result_type>,
+                  "sharded_memoize requires a Copyable result type");
+
+    explicit sharded_memoize(F f): f_(std::move(f))
+    { }
+
+    result_type operator()(const Args&... args)
+    {
+        const std::uint32_t tag = detail::arguments_tag(args...);
+        shard& s = shards_[tag % Shards];
+        {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            if (const result_type* cached = s.cache.find(tag, args...)) {
+                ++s.hits;
+                return *cached;
+            }
+        }
+        result_type result = functional::invoke(f_, args...);
+        std::lock_guard<std::mutex> lock(s.mutex);
+        ++s.misses;
+        if (!s.cache.find(tag, args...)) {
+            s.cache.insert(tag, args..., result);
+        }
+        return result;
+    }
+
+    static constexpr std::size_t capacity() noexcept
+    {
+        return Shards * shard_capacity;
+    }
+
+    std::size_t size() const
+    {
+        return sum([](const shard& s) { return s.cache.size(); });
+    }
+
+    std::size_t hits() const
+    {
+        return sum([](const shard& s) { return s.hits; });
+    }
+
+    std::size_t misses() const
+    {
+        return sum([](const shard& s) { return s.misses; });
+    }
+
+private:
+    static constexpr std::size_t shard_capacity =
+        (Capacity + Shards - 1) / Shards;
+
+    struct alignas(CACHE_LINE_BYTES) shard
+    {
+        mutable std::mutex mutex;
+        detail::clock_cache<result_type, shard_capacity, Args...> cache;
+        std::size_t hits = 0;
+        std::size_t misses = 0;
+    };
+
+    template<class Get>
+    std::size_t sum(Get get) const
+    {
+        std::size_t total = 0;
+        for (const shard& s: shards_) {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            total += get(s);
+        }
+        return total;
+    }
+
+    const F f_;
+    std::array<shard, Shards> shards_;
+};
+
+/* --- Functions make_memoize and make_sharded_memoize --- */
+/// memoize f, called with arguments Args...
+template<std::size_t Capacity, class... Args, class F>
+memoize<F, Capacity, Args...> make_memoize(F f)
+{
+    return memoize<F, Capacity, Args...>(std::move(f));
+}
+
+/// sharded_memoize f, called with arguments Args... (returned by guaranteed
+/// copy elision: sharded_memoize is not movable)
+template<std::size_t Capacity, std::size_t Shards, class... Args, class F>
+sharded_memoize<F, Capacity, Shards, Args...> make_sharded_memoize(F f)
+{
+    return sharded_memoize<F, Capacity, Shards, Args...>(std::move(f));
+}
+
+} // namespace functional
+
+#endif //DETAIL_MEMOIZE_H
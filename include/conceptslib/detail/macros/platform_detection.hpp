@@ -30,6 +30,58 @@
     #include <conceptslib/detail/concepts/invocable_workaround.hpp>
 #endif
 
+// GCC and Clang vector extensions (__attribute__((vector_size(N))))
+#if defined(__GNUC__) || defined(__clang__)
+    #define SUPPORTS_VECTOR_EXTENSIONS true
+#else
+    #define SUPPORTS_VECTOR_EXTENSIONS false
+#endif
+
+// Hint that a point of the program is never reached
+#if defined(__GNUC__) || defined(__clang__)
+    #define UNREACHABLE() __builtin_unreachable()
+#elif defined(_MSC_VER)
+    #define UNREACHABLE() __assume(0)
+#else
+    #include <cstdlib>
+    #define UNREACHABLE() std::abort()
+#endif
 
+// Signature of the enclosing function, including its template arguments
+#if defined(__GNUC__) || defined(__clang__)
+    #define FUNCTION_SIGNATURE __PRETTY_FUNCTION__
+#elif defined(_MSC_VER)
+    #define FUNCTION_SIGNATURE __FUNCSIG__
+#endif
+
+// Whether __type_pack_element<I, Ts...> names the type I of the pack Ts
+#if defined(__has_builtin)
+    #if __has_builtin(__type_pack_element)
+        #define SUPPORTS_TYPE_PACK_ELEMENT true
+    #endif
+#endif
+#ifndef SUPPORTS_TYPE_PACK_ELEMENT
+    #define SUPPORTS_TYPE_PACK_ELEMENT false
+#endif
+
+// Whether __builtin_bit_cast(T, value), std::bit_cast before C++20, is
+// available: unlike memcpy, it can be evaluated in constant expressions
+#if defined(__has_builtin)
+    #if __has_builtin(__builtin_bit_cast)
+        #define SUPPORTS_BUILTIN_BIT_CAST true
+    #endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1927
+    #define SUPPORTS_BUILTIN_BIT_CAST true
+#endif
+#ifndef SUPPORTS_BUILTIN_BIT_CAST
+    #define SUPPORTS_BUILTIN_BIT_CAST false
+#endif
+
+// Size, in bytes, of a cache line of the target
+#if defined(__APPLE__) && defined(__aarch64__)
+    #define CACHE_LINE_BYTES 128
+#else
+    #define CACHE_LINE_BYTES 64
+#endif
 
 #endif //DETAIL_PLATFORM_DETECTION_H
@@ -0,0 +1,406 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_EXPRESSION_H
+#define DETAIL_EXPRESSION_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/arithmetic.hpp>
+#include <conceptslib/detail/type_traits/common_type.hpp>
+
+/**
+ * Expression templates for elementwise arithmetic over numeric::array. The
+ * arithmetic operators do not compute anything: they build a lightweight
+ * expression object, and assigning the expression to an array evaluates the
+ * whole tree in a single loop without temporary arrays. Operands with
+ * different element types are combined in their \c traits::common_type_t.
+ * @attention Expressions refer to the arrays they are built from: an
+ * expression stored in a variable must not outlive its operands.
+ */
+namespace numeric
+{
+/* --- Expression base --- */
+/**
+ * CRTP base of every array expression. Derived types provide \c value_type,
+ * \c size() and an element access operator[] which computes a single element.
+ */
+template<class E>
+struct expression
+{
+    constexpr const E& self() const { return static_cast<const E&>(*this); }
+};
+
+template<class T>
+class array;
+
+namespace detail
+{
+/* --- trait is_expression --- */
+template<class E>
+inline constexpr bool is_expression_v =
+    std::is_base_of_v<expression<traits::remove_cvref_t<E>>
+                     ,traits::remove_cvref_t<E>>;
+
+// Arrays are captured by reference, every other expression by value
+template<class E>
+struct operand
+{
+    using type = E;
+};
+
+template<class T>
+struct operand<array<T>>
+{
+    using type = const array<T>&;
+};
+
+template<class E>
+using operand_t = typename operand<E>::type;
+
+template<class E>
+using value_type_t = typename traits::remove_cvref_t<E>::value_type;
+
+// Element type of a binary expression: common type of the operands' elements
+template<class L, class R>
+using common_value_t = traits::common_type_t<value_type_t<L>, value_type_t<R>>;
+
+template<class L, class R>
+inline constexpr bool arithmetic_operands_v =
+    concepts::Arithmetic<traits::detected_t<common_value_t, L, R>>;
+
+template<class L, class R>
+inline constexpr bool field_operands_v =
+    concepts::Field<traits::detected_t<common_value_t, L, R>>;
+
+/* --- Scalar operand --- */
+// Broadcast a scalar to every element of an expression
+template<class T>
+class scalar: public expression<scalar<T>>
+{
+public:
+    using value_type = T;
+
+    constexpr explicit scalar(const T& value): value_{value}
+    { }
+
+    constexpr const T& operator[](std::size_t) const { return value_; }
+
+private:
+    T value_;
+};
+
+template<class E>
+inline constexpr bool is_scalar_v = false;
+
+template<class T>
+inline constexpr bool is_scalar_v<scalar<T>> = true;
+
+// Wrap an operand in its expression type
+template<class E>
+constexpr decltype(auto) as_expression(E&& e)
+{
+    if constexpr (is_expression_v<E>) {
+        return std::forward<E>(e).self();
+    } else {
+        return scalar<std::decay_t<E>>{e};
+    }
+}
+
+template<class E>
+using expression_t =
+    traits::remove_cvref_t<decltype(as_expression(std::declval<E>()))>;
+
+} // namespace detail
+
+/* --- Binary expression --- */
+/**
+ * Lazy elementwise application of the binary operation Op to the operands L
+ * and R. Element i is Op(L[i], R[i]) computed in the common element type.
+ * Operands which are not scalars must have the same size: building the
+ * expression throws std::length_error otherwise.
+ */
+template<class Op, class L, class R>
+class binary_expression: public expression<binary_expression<Op, L, R>>
+{
+public:
+    using value_type = detail::common_value_t<L, R>;
+
+    constexpr binary_expression(const L& lhs, const R& rhs)
+        : lhs_{lhs}, rhs_{rhs}
+    {
+        if constexpr (!detail::is_scalar_v<L> && !detail::is_scalar_v<R>) {
+            if (lhs_.size() != rhs_.size()) {
+                throw std::length_error("numeric expression operands of "
+                                        "different sizes");
+            }
+        }
+    }
+
+    constexpr std::size_t size() const
+    {
+        if constexpr (detail::is_scalar_v<L>) {
+            return rhs_.size();
+        } else {
+            return lhs_.size();
+        }
+    }
+
+    constexpr value_type operator[](std::size_t i) const
+    {
+        return static_cast<value_type>(Op{}(static_cast<value_type>(lhs_[i])
+                                           ,static_cast<value_type>(rhs_[i])));
+    }
+
+private:
+    detail::operand_t<L> lhs_;
+    detail::operand_t<R> rhs_;
+};
+
+/* --- Unary expression --- */
+/**
+ * Lazy elementwise application of the unary operation Op to the operand E
+ */
+template<class Op, class E>
+class unary_expression: public expression<unary_expression<Op, E>>
+{
+public:
+    using value_type = detail::value_type_t<E>;
+
+    constexpr explicit unary_expression(const E& operand): operand_{operand}
+    { }
+
+    constexpr std::size_t size() const { return operand_.size(); }
+
+    constexpr value_type operator[](std::size_t i) const
+    {
+        return static_cast<value_type>(Op{}(operand_[i]));
+    }
+
+private:
+    detail::operand_t<E> operand_;
+};
+
+/* --- Class array --- */
+/**
+ * Contiguous, dynamically sized array of Arithmetic elements whose
+ * assignment from an expression evaluates the expression in one fused loop.
+ */
+template<class T>
+class array: public expression<array<T>>
+{
+    static_assert(concepts::Arithmetic<T>,
+                  "numeric::array requires an Arithmetic element type");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = typename std::vector<T>::iterator;
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    array() = default;
+
+    explicit array(size_type n, const T& value = T{}): data_(n, value)
+    { }
+
+    array(std::initializer_list<T> values): data_(values)
+    { }
+
+    /// Evaluate the expression e into a new array
+    template<class E>
+    array(const expression<E>& e): data_(e.self().size())
+    {
+        assign(e.self());
+    }
+
+    /// Evaluate the expression e into this array, resizing it if necessary
+    template<class E>
+    array& operator=(const expression<E>& e)
+    {
+        const E& expr = e.self();
+        if (expr.size() != size()) {
+            // Evaluate first: expr may refer to this array
+            array result(expr);
+            data_.swap(result.data_);
+        } else {
+            assign(expr);
+        }
+        return *this;
+    }
+
+    template<class E>
+    array& operator+=(const expression<E>& e)
+    {
+        return compound(e.self(), std::plus<>{});
+    }
+
+    template<class E>
+    array& operator-=(const expression<E>& e)
+    {
+        return compound(e.self(), std::minus<>{});
+    }
+
+    template<class E>
+    array& operator*=(const expression<E>& e)
+    {
+        return compound(e.self(), std::multiplies<>{});
+    }
+
+    template<class E, class U = T>
+    auto operator/=(const expression<E>& e)
+        -> std::enable_if_t<concepts::Field<U>, array&>
+    {
+        return compound(e.self(), std::divides<>{});
+    }
+
+    size_type size() const noexcept { return data_.size(); }
+    bool empty() const noexcept { return data_.empty(); }
+
+    T* data() noexcept { return data_.data(); }
+    const T* data() const noexcept { return data_.data(); }
+
+    T& operator[](size_type i) { return data_[i]; }
+    const T& operator[](size_type i) const { return data_[i]; }
+
+    iterator begin() noexcept { return data_.begin(); }
+    iterator end() noexcept { return data_.end(); }
+    const_iterator begin() const noexcept { return data_.begin(); }
+    const_iterator end() const noexcept { return data_.end(); }
+
+    friend bool operator==(const array& lhs, const array& rhs)
+    {
+        return lhs.data_ == rhs.data_;
+    }
+
+    friend bool operator!=(const array& lhs, const array& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    // The fused loop: every element is computed independently, which lets the
+    // optimizer vectorize it once the expression's operator[] is inlined.
+    template<class E>
+    void assign(const E& expr)
+    {
+        T* out = data_.data();
+        const size_type n = data_.size();
+        for (size_type i = 0; i < n; ++i) {
+            out[i] = static_cast<T>(expr[i]);
+        }
+    }
+
+    template<class E, class Op>
+    array& compound(const E& expr, Op op)
+    {
+        if (expr.size() != size()) {
+            throw std::length_error("numeric array compound assignment of "
+                                    "an expression of a different size");
+        }
+        T* out = data_.data();
+        const size_type n = data_.size();
+        for (size_type i = 0; i < n; ++i) {
+            out[i] = static_cast<T>(op(out[i], static_cast<T>(expr[i])));
+        }
+        return *this;
+    }
+
+    std::vector<T> data_;
+};
+
+/// Evaluate the expression e into a new array of its element type
+template<class E>
+array<typename E::value_type> eval(const expression<E>& e)
+{
+    return array<typename E::value_type>(e);
+}
+
+/* --- Operators --- */
+namespace detail
+{
+// At least one operand is an expression and the other one is an expression
+// or an Arithmetic scalar
+template<class L, class R>
+inline constexpr bool expression_operands_v =
+    (is_expression_v<L> || is_expression_v<R>) &&
+    (is_expression_v<L> || concepts::Arithmetic<std::decay_t<L>>) &&
+    (is_expression_v<R> || concepts::Arithmetic<std::decay_t<R>>);
+
+template<class Op, class L, class R>
+using binary_expression_t = binary_expression<Op
+                                             ,expression_t<L>
+                                             ,expression_t<R>>;
+
+template<class Op, class L, class R>
+constexpr auto make_binary(L&& lhs, R&& rhs)
+{
+    return binary_expression_t<Op, L, R>(as_expression(std::forward<L>(lhs))
+                                        ,as_expression(std::forward<R>(rhs)));
+}
+
+template<class L, class R>
+inline constexpr bool arithmetic_expression_v =
+    expression_operands_v<L, R> &&
+    arithmetic_operands_v<traits::detected_t<expression_t, L>
+                         ,traits::detected_t<expression_t, R>>;
+
+template<class L, class R>
+inline constexpr bool field_expression_v =
+    expression_operands_v<L, R> &&
+    field_operands_v<traits::detected_t<expression_t, L>
+                    ,traits::detected_t<expression_t, R>>;
+
+} // namespace detail
+
+template<class L, class R
+        ,class = std::enable_if_t<detail::arithmetic_expression_v<L, R>>>
+constexpr auto operator+(L&& lhs, R&& rhs)
+{
+    return detail::make_binary<std::plus<>>(std::forward<L>(lhs)
+                                           ,std::forward<R>(rhs));
+}
+
+template<class L, class R
+        ,class = std::enable_if_t<detail::arithmetic_expression_v<L, R>>>
+constexpr auto operator-(L&& lhs, R&& rhs)
+{
+    return detail::make_binary<std::minus<>>(std::forward<L>(lhs)
+                                            ,std::forward<R>(rhs));
+}
+
+template<class L, class R
+        ,class = std::enable_if_t<detail::arithmetic_expression_v<L, R>>>
+constexpr auto operator*(L&& lhs, R&& rhs)
+{
+    return detail::make_binary<std::multiplies<>>(std::forward<L>(lhs)
+                                                 ,std::forward<R>(rhs));
+}
+
+template<class L, class R
+        ,class = std::enable_if_t<detail::field_expression_v<L, R>>>
+constexpr auto operator/(L&& lhs, R&& rhs)
+{
+    return detail::make_binary<std::divides<>>(std::forward<L>(lhs)
+                                              ,std::forward<R>(rhs));
+}
+
+template<class E>
+constexpr auto operator-(const expression<E>& e)
+{
+    return unary_expression<std::negate<>, E>(e.self());
+}
+
+} // namespace numeric
+
+#endif //DETAIL_EXPRESSION_H
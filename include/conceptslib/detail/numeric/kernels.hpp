@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_KERNELS_H
+#define DETAIL_KERNELS_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/core.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+#include <conceptslib/detail/concepts/callable.hpp>
+#include <conceptslib/detail/concepts/arithmetic.hpp>
+#include <conceptslib/detail/functional/invoke.hpp>
+#include <conceptslib/detail/numeric/simd.hpp>
+
+/**
+ * Numeric kernels over contiguous sequences of Arithmetic values. Built-in
+ * integral and floating point types are processed with explicit SIMD (see
+ * simd::is_vectorizable); any other type satisfying the concept is processed
+ * by a scalar loop.
+ * @note Vectorized reductions (sum, dot) reassociate the floating point
+ * operations, so results may differ from a sequential loop by rounding.
+ */
+namespace numeric
+{
+namespace detail
+{
+// Number of independent accumulators used by the vectorized reductions
+inline constexpr std::size_t accumulators = 4;
+
+template<class T>
+inline constexpr bool use_simd = simd::is_vectorizable_v<T>;
+
+} // namespace detail
+
+/* --- Kernel axpy --- */
+/**
+ * Compute y[i] = a * x[i] + y[i] for i in [0, n)
+ */
+template<class T>
+auto axpy(const T& a, const T* x, T* y, std::size_t n)
+    -> std::enable_if_t<concepts::Arithmetic<T>>
+{
+    std::size_t i = 0;
+#if SUPPORTS_VECTOR_EXTENSIONS
+    if constexpr (detail::use_simd<T>) {
+        constexpr std::size_t L = simd::lanes<T>;
+        const auto va = simd::broadcast(a);
+        for (; i + L <= n; i += L) {
+            simd::store(y + i, va * simd::load(x + i) + simd::load(y + i));
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        y[i] += a * x[i];
+    }
+}
+
+/* --- Kernel sum --- */
+/**
+ * Compute the sum of x[i] for i in [0, n)
+ * @return The sum of the elements or a value initialized T if n is zero
+ */
+template<class T>
+auto sum(const T* x, std::size_t n)
+    -> std::enable_if_t<concepts::Arithmetic<T>, T>
+{
+    T result{};
+    std::size_t i = 0;
+#if SUPPORTS_VECTOR_EXTENSIONS
+    if constexpr (detail::use_simd<T>) {
+        constexpr std::size_t L = simd::lanes<T>;
+        constexpr std::size_t K = detail::accumulators;
+        simd::pack_t<T> acc[K] = { };
+        for (; i + K * L <= n; i += K * L) {
+            for (std::size_t k = 0; k < K; ++k) {
+                acc[k] += simd::load(x + i + k * L);
+            }
+        }
+        for (; i + L <= n; i += L) {
+            acc[0] += simd::load(x + i);
+        }
+        for (std::size_t k = 1; k < K; ++k) {
+            acc[0] += acc[k];
+        }
+        result = simd::reduce<T>(acc[0], [](T l, T r) -> T { return l + r; });
+    }
+#endif
+    for (; i < n; ++i) {
+        result += x[i];
+    }
+    return result;
+}
+
+/* --- Kernel dot --- */
+/**
+ * Compute the inner product of x and y, i.e. the sum of x[i] * y[i] for i in
+ * [0, n)
+ * @return The inner product or a value initialized T if n is zero
+ */
+template<class T>
+auto dot(const T* x, const T* y, std::size_t n)
+    -> std::enable_if_t<concepts::Arithmetic<T>, T>
+{
+    T result{};
+    std::size_t i = 0;
+#if SUPPORTS_VECTOR_EXTENSIONS
+    if constexpr (detail::use_simd<T>) {
+        constexpr std::size_t L = simd::lanes<T>;
+        constexpr std::size_t K = detail::accumulators;
+        simd::pack_t<T> acc[K] = { };
+        for (; i + K * L <= n; i += K * L) {
+            for (std::size_t k = 0; k < K; ++k) {
+                acc[k] += simd::load(x + i + k * L) *
+                          simd::load(y + i + k * L);
+            }
+        }
+        for (; i + L <= n; i += L) {
+            acc[0] += simd::load(x + i) * simd::load(y + i);
+        }
+        for (std::size_t k = 1; k < K; ++k) {
+            acc[0] += acc[k];
+        }
+        result = simd::reduce<T>(acc[0], [](T l, T r) -> T { return l + r; });
+    }
+#endif
+    for (; i < n; ++i) {
+        result += x[i] * y[i];
+    }
+    return result;
+}
+
+/* --- Kernels min and max --- */
+/**
+ * Find the smallest of x[i] for i in [0, n)
+ * @attention The behavior is undefined if n is zero.
+ */
+template<class T>
+auto min(const T* x, std::size_t n)
+    -> std::enable_if_t<concepts::Arithmetic<T> &&
+                        concepts::StrictTotallyOrdered<T>, T>
+{
+    T result = x[0];
+    std::size_t i = 1;
+#if SUPPORTS_VECTOR_EXTENSIONS
+    if constexpr (detail::use_simd<T>) {
+        constexpr std::size_t L = simd::lanes<T>;
+        if (n >= L) {
+            auto acc = simd::load(x);
+            for (i = L; i + L <= n; i += L) {
+                acc = simd::min<T>(acc, simd::load(x + i));
+            }
+            result = simd::reduce<T>(acc, [](T l, T r) {
+                return r < l ? r : l;
+            });
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        if (x[i] < result) {
+            result = x[i];
+        }
+    }
+    return result;
+}
+
+/**
+ * Find the largest of x[i] for i in [0, n)
+ * @attention The behavior is undefined if n is zero.
+ */
+template<class T>
+auto max(const T* x, std::size_t n)
+    -> std::enable_if_t<concepts::Arithmetic<T> &&
+                        concepts::StrictTotallyOrdered<T>, T>
+{
+    T result = x[0];
+    std::size_t i = 1;
+#if SUPPORTS_VECTOR_EXTENSIONS
+    if constexpr (detail::use_simd<T>) {
+        constexpr std::size_t L = simd::lanes<T>;
+        if (n >= L) {
+            auto acc = simd::load(x);
+            for (i = L; i + L <= n; i += L) {
+                acc = simd::max<T>(acc, simd::load(x + i));
+            }
+            result = simd::reduce<T>(acc, [](T l, T r) {
+                return l < r ? r : l;
+            });
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        if (result < x[i]) {
+            result = x[i];
+        }
+    }
+    return result;
+}
+
+/* --- Kernel map --- */
+/**
+ * Wrapper marking a callable as lane-wise: invoking it with a simd::pack_t<T>
+ * applies the same operation to every lane. It is also invocable with
+ * individual values, which is used for the scalar remainder.
+ */
+template<class F>
+struct lanewise_fn
+{
+    F f;
+
+    template<class... Args>
+    constexpr auto operator()(Args&&... args) const
+        -> decltype(functional::invoke(f, std::forward<Args>(args)...))
+    {
+        return functional::invoke(f, std::forward<Args>(args)...);
+    }
+};
+
+/// Mark f as applicable to whole packs (e.g. [](auto v) { return v * v; })
+template<class F>
+constexpr lanewise_fn<std::decay_t<F>> lanewise(F&& f)
+{
+    return {std::forward<F>(f)};
+}
+
+/**
+ * Compute out[i] = f(x[i]) for i in [0, n)
+ */
+template<class T, class U, class F>
+auto map(const T* x, U* out, std::size_t n, F f)
+    -> std::enable_if_t<
+        concepts::Invocable<F&, const T&> &&
+        concepts::ConvertibleTo<functional::invoke_result_t<F&, const T&>, U>>
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = functional::invoke(f, x[i]);
+    }
+}
+
+/**
+ * Compute out[i] = f(x[i]) for i in [0, n) using explicit SIMD if T and U are
+ * vectorizable types of the same size.
+ * @note f must accept a simd::pack_t<T> and return a simd::pack_t<U>.
+ */
+template<class T, class U, class F>
+auto map(const T* x, U* out, std::size_t n, lanewise_fn<F> f)
+    -> std::enable_if_t<
+        concepts::Invocable<lanewise_fn<F>&, const T&> &&
+        concepts::ConvertibleTo<
+            functional::invoke_result_t<lanewise_fn<F>&, const T&>, U>>
+{
+    std::size_t i = 0;
+#if SUPPORTS_VECTOR_EXTENSIONS
+    if constexpr (detail::use_simd<T> && detail::use_simd<U> &&
+                  sizeof(T) == sizeof(U)) {
+        constexpr std::size_t L = simd::lanes<T>;
+        for (; i + L <= n; i += L) {
+            simd::store<U>(out + i, f(simd::load(x + i)));
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        out[i] = f(x[i]);
+    }
+}
+
+} // namespace numeric
+
+#endif //DETAIL_KERNELS_H
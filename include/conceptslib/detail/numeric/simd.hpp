@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_SIMD_H
+#define DETAIL_SIMD_H
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include <conceptslib/detail/macros/platform_detection.hpp>
+
+namespace numeric
+{
+namespace simd
+{
+/// Width, in bytes, of the widest vector register available on the target
+#if defined(__AVX512F__)
+inline constexpr std::size_t register_bytes = 64;
+#elif defined(__AVX__)
+inline constexpr std::size_t register_bytes = 32;
+#else
+inline constexpr std::size_t register_bytes = 16;
+#endif
+
+/* --- trait is_vectorizable --- */
+/**
+ * @trait Check if packs of T can be operated on with explicit SIMD
+ * @details Provides the member constant value which is equal to true if T is
+ * a built-in integral or floating point type (other than bool and long double)
+ * and the compiler supports vector extensions. Otherwise, value is equal to
+ * false.
+ */
+template<class T>
+struct is_vectorizable: std::bool_constant<
+    SUPPORTS_VECTOR_EXTENSIONS &&
+    std::is_arithmetic_v<T> &&
+    !std::is_same_v<std::remove_cv_t<T>, bool> &&
+    !std::is_same_v<std::remove_cv_t<T>, long double>>
+{ };
+
+/// Helper variable template to access \c is_vectorizable member \c value
+template<class T>
+inline constexpr bool is_vectorizable_v = is_vectorizable<T>::value;
+
+#if SUPPORTS_VECTOR_EXTENSIONS
+
+/* --- Metafunction pack --- */
+/**
+ * @metafunction Vector register holding as many T as fit in register_bytes
+ * @details Provides the member typedef \c type, a GCC/Clang vector extension
+ * type which supports the built-in arithmetic, comparison and subscript
+ * operators lane by lane.
+ */
+template<class T>
+struct pack
+{
+    typedef T type __attribute__((vector_size(register_bytes)));
+};
+
+/// Helper typedef to access \c pack member \c type
+template<class T>
+using pack_t = typename pack<T>::type;
+
+/// Number of T in a pack_t<T>
+template<class T>
+inline constexpr std::size_t lanes = register_bytes / sizeof(T);
+
+/// Load lanes<T> contiguous values starting at (possibly unaligned) p
+template<class T>
+inline pack_t<T> load(const T* p)
+{
+    pack_t<T> v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/// Store the lanes of v contiguously starting at (possibly unaligned) p
+template<class T>
+inline void store(T* p, const pack_t<T>& v)
+{
+    std::memcpy(p, &v, sizeof(v));
+}
+
+/// Pack whose lanes are all equal to value
+template<class T>
+inline pack_t<T> broadcast(const T& value)
+{
+    pack_t<T> v;
+    for (std::size_t i = 0; i < lanes<T>; ++i) {
+        v[i] = value;
+    }
+    return v;
+}
+
+/// Lane by lane minimum
+template<class T>
+inline pack_t<T> min(const pack_t<T>& a, const pack_t<T>& b)
+{
+    return b < a ? b : a;
+}
+
+/// Lane by lane maximum
+template<class T>
+inline pack_t<T> max(const pack_t<T>& a, const pack_t<T>& b)
+{
+    return a < b ? b : a;
+}
+
+/// Fold the lanes of v with the binary operation op (horizontal reduction)
+template<class T, class Op>
+inline T reduce(const pack_t<T>& v, Op op)
+{
+    T result = v[0];
+    for (std::size_t i = 1; i < lanes<T>; ++i) {
+        result = op(result, v[i]);
+    }
+    return result;
+}
+
+#endif // SUPPORTS_VECTOR_EXTENSIONS
+
+} // namespace simd
+} // namespace numeric
+
+#endif //DETAIL_SIMD_H
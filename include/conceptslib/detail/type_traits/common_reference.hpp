@@ -220,7 +220,7 @@ namespace detail
 {
 // common_reference: case T and U ref types and exists simple common reference
 template<class T, class U>
-constexpr bool has_simple_common_ref_v =
+inline constexpr bool has_simple_common_ref_v =
     is_detected_v<simple_common_reference_t, T, U>;
 
 template<class T, class U>
@@ -233,12 +233,12 @@ using basic_common_ref_t =
 
 // common_reference: case exists basic common reference
 template<class T, class U>
-constexpr bool has_basic_common_ref_v =
+inline constexpr bool has_basic_common_ref_v =
     is_detected_v<basic_common_ref_t, T, U>;
 
 // common_reference: case exists cond_res_t
 template<class T, class U>
-constexpr bool has_cond_res_v = is_detected_v<cond_res_t, T, U>;
+inline constexpr bool has_cond_res_v = is_detected_v<cond_res_t, T, U>;
 
 // common_reference: base case (there is a common type)
 template<class T, class U, class = void>
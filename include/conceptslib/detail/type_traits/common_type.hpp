@@ -32,7 +32,7 @@ using common_type_t = typename common_type<Ts...>::type;
 namespace detail
 {
 template<class T, class U>
-constexpr bool same_decayed_v =
+inline constexpr bool same_decayed_v =
     std::is_same_v<T, std::decay_t<T>> &&
     std::is_same_v<U, std::decay_t<U>>;
 
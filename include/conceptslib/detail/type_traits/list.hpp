@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_LIST_H
+#define DETAIL_LIST_H
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/macros/platform_detection.hpp>
+
+/*
+ * Type lists and their algorithms. None of them recurses over the list: the
+ * predicates and keys of its types are evaluated by pack expansions into
+ * constexpr arrays, constexpr loops over those arrays compute the indices of
+ * the result, and the types at those indices are looked up in constant
+ * template instantiation depth.
+ */
+namespace traits
+{
+/// List of types
+template<class... Ts>
+struct list
+{
+    static constexpr std::size_t size = sizeof...(Ts);
+};
+
+namespace detail
+{
+template<class T>
+struct list_identity
+{
+    using type = T;
+};
+
+/* --- Lookup by index --- */
+#if SUPPORTS_TYPE_PACK_ELEMENT
+template<std::size_t I, class... Ts>
+using pack_element_t = __type_pack_element<I, Ts...>;
+#else
+template<std::size_t I, class T>
+struct indexed { };
+
+template<class Is, class... Ts>
+struct indexer;
+
+template<std::size_t... Is, class... Ts>
+struct indexer<std::index_sequence<Is...>, Ts...>: indexed<Is, Ts>... { };
+
+// Select the base class of index I by overload resolution: T is deduced
+template<std::size_t I, class T>
+list_identity<T> element_at(indexed<I, T>);
+
+template<std::size_t I, class... Ts>
+using pack_element_t = typename decltype(element_at<I>(
+    indexer<std::index_sequence_for<Ts...>, Ts...>{}))::type;
+#endif
+
+/* --- Selection by indices --- */
+/// Indices of the true values of Keep
+template<bool... Keep>
+constexpr auto kept_indices()
+{
+    constexpr bool keep[] = {Keep..., false};
+    std::array<std::size_t, (std::size_t{0} + ... + std::size_t{Keep})>
+        indices{};
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < sizeof...(Keep); ++i) {
+        if (keep[i]) {
+            indices[k++] = i;
+        }
+    }
+    return indices;
+}
+
+template<bool... Keep>
+struct kept
+{
+    static constexpr auto value = kept_indices<Keep...>();
+};
+
+/// List of the types of Ts at the indices Indices::value
+template<class Indices, class Ks, class... Ts>
+struct pick;
+
+template<class Indices, std::size_t... Ks, class... Ts>
+struct pick<Indices, std::index_sequence<Ks...>, Ts...>
+{
+    using type = list<pack_element_t<Indices::value[Ks], Ts...>...>;
+};
+
+template<class Indices, class... Ts>
+using pick_t = typename pick<Indices,
+    std::make_index_sequence<Indices::value.size()>, Ts...>::type;
+
+/// List of the types T of Ts for which Pred<T>::value is Value
+template<template<class> class Pred, bool Value, class... Ts>
+using pick_if_t =
+    pick_t<kept<(static_cast<bool>(Pred<Ts>::value) == Value)...>, Ts...>;
+
+/* --- Identity of types --- */
+// Distinct types have distinct tags: comparing the addresses of their ids
+// compares N types in N instantiations, instead of N * N of std::is_same
+template<class T>
+struct type_tag
+{
+    static constexpr char id = 0;
+};
+
+/// Whether each type of the pack is the first one of its kind
+template<class... Ts>
+constexpr auto first_occurrences()
+{
+    constexpr const char* ids[] = {&type_tag<Ts>::id..., nullptr};
+    std::array<bool, sizeof...(Ts)> first{};
+    for (std::size_t i = 0; i < sizeof...(Ts); ++i) {
+        first[i] = true;
+        for (std::size_t j = 0; j < i && first[i]; ++j) {
+            first[i] = ids[j] != ids[i];
+        }
+    }
+    return first;
+}
+
+template<class... Ts>
+struct unique_indices
+{
+    static constexpr auto first = first_occurrences<Ts...>();
+
+    template<std::size_t... Is>
+    static constexpr auto indices(std::index_sequence<Is...>)
+    {
+        return kept_indices<first[Is]...>();
+    }
+
+    static constexpr auto value =
+        indices(std::index_sequence_for<Ts...>{});
+};
+
+/* --- Stable sort by key --- */
+/// Order of the indices of keys which sorts them stably, by a bottom-up merge
+template<class K, std::size_t N>
+constexpr std::array<std::size_t, N> sorted_order(const K (&keys)[N])
+{
+    std::array<std::size_t, N> order{};
+    std::array<std::size_t, N> merged{};
+    for (std::size_t i = 0; i < N; ++i) {
+        order[i] = i;
+    }
+    for (std::size_t width = 1; width < N; width *= 2) {
+        for (std::size_t first = 0; first < N; first += 2 * width) {
+            std::size_t middle = first + width < N ? first + width : N;
+            std::size_t last = middle + width < N ? middle + width : N;
+            std::size_t i = first;
+            std::size_t j = middle;
+            std::size_t k = first;
+            // Take from the left run unless the right key is smaller: stable
+            while (i < middle && j < last) {
+                merged[k++] = keys[order[j]] < keys[order[i]] ? order[j++]
+                                                              : order[i++];
+            }
+            while (i < middle) {
+                merged[k++] = order[i++];
+            }
+            while (j < last) {
+                merged[k++] = order[j++];
+            }
+        }
+        order = merged;
+    }
+    return order;
+}
+
+template<template<class> class Key, class... Ts>
+struct sorted_indices
+{
+    // Arithmetic keys: the type of their sum is their common type, without
+    // the recursion of std::common_type
+    using key_type = decltype((Key<Ts>::value + ...));
+    static constexpr key_type keys[] = {Key<Ts>::value...};
+    static constexpr auto value = sorted_order(keys);
+};
+
+/// Index of the first of Same which is true, or its size
+template<bool... Same>
+constexpr std::size_t first_true()
+{
+    constexpr bool same[] = {Same..., false};
+    std::size_t i = 0;
+    while (i < sizeof...(Same) && !same[i]) {
+        ++i;
+    }
+    return i;
+}
+
+} // namespace detail
+
+/* --- Metafunction at --- */
+/// @metafunction Type at index I of the list L
+template<class L, std::size_t I>
+struct at;
+
+template<class... Ts, std::size_t I>
+struct at<list<Ts...>, I>
+{
+    static_assert(I < sizeof...(Ts), "index out of the bounds of the list");
+    using type = detail::pack_element_t<I, Ts...>;
+};
+
+template<class L, std::size_t I>
+using at_t = typename at<L, I>::type;
+
+/* --- Metafunction index_of --- */
+/// @metafunction Index of the first T of the list L, or the size of L
+template<class L, class T>
+struct index_of;
+
+template<class... Ts, class T>
+struct index_of<list<Ts...>, T>
+    : std::integral_constant<std::size_t,
+          detail::first_true<std::is_same_v<T, Ts>...>()>
+{ };
+
+template<class L, class T>
+inline constexpr std::size_t index_of_v = index_of<L, T>::value;
+
+/* --- Metafunction contains --- */
+/// @metafunction Whether T is a type of the list L
+template<class L, class T>
+struct contains;
+
+template<class... Ts, class T>
+struct contains<list<Ts...>, T>
+    : std::bool_constant<(std::is_same_v<T, Ts> || ...)>
+{ };
+
+template<class L, class T>
+inline constexpr bool contains_v = contains<L, T>::value;
+
+/* --- Metafunction filter --- */
+/// @metafunction Types T of the list L for which Pred<T>::value is true
+template<class L, template<class> class Pred>
+struct filter;
+
+template<class... Ts, template<class> class Pred>
+struct filter<list<Ts...>, Pred>
+{
+    using type = detail::pick_if_t<Pred, true, Ts...>;
+};
+
+template<class L, template<class> class Pred>
+using filter_t = typename filter<L, Pred>::type;
+
+/* --- Metafunction partition --- */
+/**
+ * @metafunction Split the list L in the types T for which Pred<T>::value is
+ * true, \c selected, and the others, \c rejected, in their order in L
+ */
+template<class L, template<class> class Pred>
+struct partition;
+
+template<class... Ts, template<class> class Pred>
+struct partition<list<Ts...>, Pred>
+{
+    using selected = detail::pick_if_t<Pred, true, Ts...>;
+    using rejected = detail::pick_if_t<Pred, false, Ts...>;
+};
+
+/* --- Metafunction transform --- */
+/// @metafunction List of F<T> for each type T of the list L
+template<class L, template<class> class F>
+struct transform;
+
+template<class... Ts, template<class> class F>
+struct transform<list<Ts...>, F>
+{
+    using type = list<F<Ts>...>;
+};
+
+template<class L, template<class> class F>
+using transform_t = typename transform<L, F>::type;
+
+/* --- Metafunction unique --- */
+/// @metafunction The list L without the repetitions of its types
+template<class L>
+struct unique;
+
+template<class... Ts>
+struct unique<list<Ts...>>
+{
+    using type = detail::pick_t<detail::unique_indices<Ts...>, Ts...>;
+};
+
+template<class L>
+using unique_t = typename unique<L>::type;
+
+/* --- Metafunction sort_by --- */
+/**
+ * @metafunction The list L sorted by the arithmetic keys Key<T>::value of its
+ * types T, in increasing order. The sort is stable: types with equivalent keys keep
+ * their order in L.
+ */
+template<class L, template<class> class Key>
+struct sort_by;
+
+template<class... Ts, template<class> class Key>
+struct sort_by<list<Ts...>, Key>
+{
+    using type = detail::pick_t<detail::sorted_indices<Key, Ts...>, Ts...>;
+};
+
+template<template<class> class Key>
+struct sort_by<list<>, Key>
+{
+    using type = list<>;
+};
+
+template<class L, template<class> class Key>
+using sort_by_t = typename sort_by<L, Key>::type;
+
+} // namespace traits
+
+#endif //DETAIL_LIST_H
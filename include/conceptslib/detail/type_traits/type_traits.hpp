@@ -43,8 +43,11 @@ using detected_or = std::experimental::detected_or<Default, Op, Args...>;
 // Non instantiatable type to indicate detection failure
 using nonesuch = std::experimental::nonesuch;
 
+// The variable templates read the value of the class templates: those of
+// std::experimental are not inline, and would be emitted in every object file
 template<template<class...> class Op, class... Args>
-constexpr bool is_detected_v = std::experimental::is_detected_v<Op, Args...>;
+inline constexpr bool is_detected_v =
+    std::experimental::is_detected<Op, Args...>::value;
 
 template<class Default, template<class...> class Op, class... Args >
 using detected_or_t = std::experimental::detected_or_t<Default, Op, Args...>;
@@ -54,16 +57,16 @@ using is_detected_exact =
 std::experimental::is_detected_exact<Expected, Op, Args...>;
 
 template <class Expected, template<class...> class Op, class... Args>
-constexpr bool is_detected_exact_v =
-               std::experimental::is_detected_exact_v<Expected, Op, Args...>;
+inline constexpr bool is_detected_exact_v =
+    is_detected_exact<Expected, Op, Args...>::value;
 
 template <class To, template<class...> class Op, class... Args>
 using is_detected_convertible =
 std::experimental::is_detected_convertible<To, Op, Args...>;
 
 template <class To, template<class...> class Op, class... Args>
-constexpr bool is_detected_convertible_v =
-               std::experimental::is_detected_convertible_v<To, Op, Args...>;
+inline constexpr bool is_detected_convertible_v =
+    is_detected_convertible<To, Op, Args...>::value;
 
 /* --- Metafunction clref --- */
 /**
@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_COMPACT_OPTIONAL_H
+#define DETAIL_COMPACT_OPTIONAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/core.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+#include <conceptslib/detail/concepts/movable.hpp>
+#include <conceptslib/detail/macros/platform_detection.hpp>
+
+namespace utility
+{
+/* --- Empty state policies --- */
+/**
+ * Policy which represents the empty state by the value Sentinel: an optional
+ * holding a value equal to Sentinel is empty.
+ * @tparam T The value type. Must satisfy \c concepts::EqualityComparable.
+ * @tparam Sentinel A value of T never stored in an engaged optional.
+ */
+template<class T, T Sentinel>
+struct sentinel
+{
+    static_assert(concepts::EqualityComparable<T>,
+                  "sentinel policy requires an EqualityComparable type");
+
+    static constexpr T empty_value() noexcept { return Sentinel; }
+
+    static constexpr bool is_empty(const T& value) noexcept
+    {
+        return value == Sentinel;
+    }
+};
+
+namespace detail
+{
+// Object representation of N bytes
+template<std::size_t N>
+struct byte_array
+{
+    unsigned char bytes[N];
+};
+
+} // namespace detail
+
+/**
+ * Policy which represents the empty state by the object representation Bits,
+ * an unused bit pattern of T. Values are compared bitwise, so the policy works
+ * for types whose equality is not reflexive (e.g. a NaN payload of a floating
+ * point type).
+ * @details empty_value() and is_empty() are constexpr when the compiler
+ * provides __builtin_bit_cast (SUPPORTS_BUILTIN_BIT_CAST), as GCC 11, Clang 9
+ * and MSVC 19.27 do. Otherwise they copy and compare bytes with memcpy and
+ * memcmp, and a compact_optional with this policy cannot be created or tested
+ * in constant expressions.
+ * @tparam T The value type. Must be trivially copyable and at most 8 bytes.
+ * @tparam Bits The object representation of the empty state.
+ */
+template<class T, std::uint64_t Bits>
+struct bit_pattern
+{
+    static_assert(std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(Bits),
+                  "bit_pattern requires a small trivially copyable type");
+
+#if SUPPORTS_BUILTIN_BIT_CAST
+    static constexpr T empty_value() noexcept
+    {
+        if constexpr (sizeof(T) == sizeof(bits_t)) {
+            return __builtin_bit_cast(T, pattern());
+        } else {
+            return __builtin_bit_cast(T, pattern_bytes());
+        }
+    }
+
+    static constexpr bool is_empty(const T& value) noexcept
+    {
+        // A single comparison of integers, rather than a loop over bytes,
+        // whenever T has the size of one
+        if constexpr (sizeof(T) == sizeof(bits_t)) {
+            return __builtin_bit_cast(bits_t, value) == pattern();
+        } else {
+            const auto bytes = __builtin_bit_cast(bytes_t, value);
+            const auto empty = pattern_bytes();
+            for (std::size_t i = 0; i < sizeof(T); ++i) {
+                if (bytes.bytes[i] != empty.bytes[i]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+#else
+    static T empty_value() noexcept
+    {
+        T value;
+        const auto bits = pattern();
+        std::memcpy(&value, &bits, sizeof(T));
+        return value;
+    }
+
+    static bool is_empty(const T& value) noexcept
+    {
+        const auto bits = pattern();
+        return std::memcmp(&value, &bits, sizeof(T)) == 0;
+    }
+#endif
+
+private:
+    // Bits truncated to the size of T
+    using bits_t = std::conditional_t<sizeof(T) == 1, std::uint8_t,
+                   std::conditional_t<sizeof(T) == 2, std::uint16_t,
+                   std::conditional_t<sizeof(T) <= 4, std::uint32_t,
+                                                      std::uint64_t>>>;
+
+    using bytes_t = detail::byte_array<sizeof(T)>;
+
+    static constexpr bits_t pattern() noexcept
+    {
+        return static_cast<bits_t>(Bits);
+    }
+
+#if SUPPORTS_BUILTIN_BIT_CAST
+    // The first sizeof(T) bytes of pattern(), which memcpy would copy
+    static constexpr bytes_t pattern_bytes() noexcept
+    {
+        const auto all = __builtin_bit_cast(detail::byte_array<sizeof(bits_t)>,
+                                            pattern());
+        bytes_t bytes{};
+        for (std::size_t i = 0; i < sizeof(T); ++i) {
+            bytes.bytes[i] = all.bytes[i];
+        }
+        return bytes;
+    }
+#endif
+};
+
+namespace detail
+{
+using concepts::detail::valid_expr;
+using concepts::detail::valid_if;
+
+REQUIREMENT OptionalPolicyReq
+{
+    template<class Policy, class T>
+    auto REQUIRES(const T& value) -> decltype(valid_expr(
+        Policy::empty_value(),
+        valid_if<concepts::ConvertibleTo<decltype(Policy::empty_value()), T>>(),
+        Policy::is_empty(value),
+        valid_if<concepts::Boolean<decltype(Policy::is_empty(value))>>()
+    ));
+};
+
+// Quiet NaN with a payload arithmetic never produces
+template<class F>
+inline constexpr std::uint64_t nan_pattern =
+    sizeof(F) == sizeof(std::uint32_t) ? std::uint64_t{0x7FC0DEAD}
+                                       : std::uint64_t{0x7FF8DEADBEEFDEAD};
+
+template<class T, class = void>
+struct default_policy_imp
+{ };
+
+template<class T>
+struct default_policy_imp<T, std::enable_if_t<std::is_pointer_v<T>>>
+{
+    using type = sentinel<T, nullptr>;
+};
+
+template<class T>
+struct default_policy_imp<T, std::enable_if_t<std::is_integral_v<T> &&
+                                              !std::is_same_v<T, bool>>>
+{
+    using type = sentinel<T, std::is_signed_v<T>
+                                 ? std::numeric_limits<T>::min()
+                                 : std::numeric_limits<T>::max()>;
+};
+
+template<class T>
+struct default_policy_imp<T, std::enable_if_t<
+    std::is_floating_point_v<T> &&
+    std::numeric_limits<T>::is_iec559 &&
+    (sizeof(T) == sizeof(std::uint32_t) || sizeof(T) == sizeof(std::uint64_t))>>
+{
+    using type = bit_pattern<T, nan_pattern<T>>;
+};
+
+} // namespace detail
+
+/**
+ * Check if Policy is an empty state policy for T: it provides the static
+ * member functions \c empty_value(), returning a value convertible to T, and
+ * \c is_empty(const T&), returning a Boolean.
+ */
+template<class Policy, class T>
+CONCEPT OptionalPolicy =
+    concepts::requires_<detail::OptionalPolicyReq, Policy, T>;
+
+/* --- Metafunction default_policy --- */
+/**
+ * @metafunction Default empty state policy of compact_optional<T>
+ * @details Provides the member typedef \c type for pointers (nullptr
+ * sentinel), integral types (the smallest value for signed types and the
+ * largest value for unsigned types) and IEEE 754 float and double (a NaN with
+ * a payload arithmetic never produces). Otherwise, there is no member \c type
+ * and a policy must be provided.
+ */
+template<class T>
+struct default_policy: detail::default_policy_imp<T>
+{ };
+
+/// Helper typedef to access \c default_policy member \c type
+template<class T>
+using default_policy_t = typename default_policy<T>::type;
+
+/* --- Class compact_optional --- */
+/**
+ * Optional value which encodes the empty state in a value (or bit pattern) of
+ * T that is never used, as named by Policy, instead of a separate flag.
+ * Therefore sizeof(compact_optional<T>) == sizeof(T).
+ * @details The interface follows std::optional. The empty optional holds
+ * Policy::empty_value().
+ * @attention Storing the empty value itself yields an empty optional.
+ */
+template<class T, class Policy = default_policy_t<T>>
+class compact_optional
+{
+    static_assert(concepts::Movable<T>,
+                  "compact_optional requires a Movable value type");
+    static_assert(OptionalPolicy<Policy, T>,
+                  "Policy must provide empty_value() and is_empty(const T&)");
+
+public:
+    using value_type = T;
+    using policy_type = Policy;
+
+    constexpr compact_optional() noexcept(noexcept(Policy::empty_value()))
+        : value_(Policy::empty_value())
+    { }
+
+    constexpr compact_optional(std::nullopt_t)
+        noexcept(noexcept(Policy::empty_value()))
+        : compact_optional()
+    { }
+
+    template<class U = T
+            ,class = std::enable_if_t<
+                concepts::Constructible<T, U&&> &&
+                !std::is_same_v<traits::remove_cvref_t<U>, compact_optional> &&
+                !std::is_same_v<traits::remove_cvref_t<U>, std::nullopt_t>>>
+    constexpr compact_optional(U&& value): value_(std::forward<U>(value))
+    { }
+
+    constexpr compact_optional& operator=(std::nullopt_t)
+    {
+        reset();
+        return *this;
+    }
+
+    /* Observers */
+    constexpr bool has_value() const noexcept
+    {
+        return !Policy::is_empty(value_);
+    }
+
+    constexpr explicit operator bool() const noexcept { return has_value(); }
+
+    constexpr T& operator*() & noexcept { return value_; }
+    constexpr const T& operator*() const& noexcept { return value_; }
+    constexpr T&& operator*() && noexcept { return std::move(value_); }
+
+    constexpr T* operator->() noexcept { return &value_; }
+    constexpr const T* operator->() const noexcept { return &value_; }
+
+    constexpr T& value() &
+    {
+        check();
+        return value_;
+    }
+
+    constexpr const T& value() const&
+    {
+        check();
+        return value_;
+    }
+
+    constexpr T&& value() &&
+    {
+        check();
+        return std::move(value_);
+    }
+
+    template<class U>
+    constexpr T value_or(U&& default_value) const&
+    {
+        return has_value() ? value_
+                           : static_cast<T>(std::forward<U>(default_value));
+    }
+
+    /* Modifiers */
+    constexpr void reset()
+    {
+        value_ = Policy::empty_value();
+    }
+
+    template<class... Args>
+    T& emplace(Args&&... args)
+    {
+        value_ = T(std::forward<Args>(args)...);
+        return value_;
+    }
+
+    void swap(compact_optional& other)
+        noexcept(std::is_nothrow_swappable_v<T>)
+    {
+        using std::swap;
+        swap(value_, other.value_);
+    }
+
+    friend void swap(compact_optional& lhs, compact_optional& rhs)
+        noexcept(std::is_nothrow_swappable_v<T>)
+    {
+        lhs.swap(rhs);
+    }
+
+    /* Comparison: an empty optional compares less than any value */
+    friend constexpr bool operator==(const compact_optional& lhs,
+                                     const compact_optional& rhs)
+    {
+        return lhs.has_value() == rhs.has_value() &&
+               (!lhs.has_value() || lhs.value_ == rhs.value_);
+    }
+
+    friend constexpr bool operator!=(const compact_optional& lhs,
+                                     const compact_optional& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+    friend constexpr bool operator<(const compact_optional& lhs,
+                                    const compact_optional& rhs)
+    {
+        return rhs.has_value() && (!lhs.has_value() || lhs.value_ < rhs.value_);
+    }
+
+    friend constexpr bool operator>(const compact_optional& lhs,
+                                    const compact_optional& rhs)
+    {
+        return rhs < lhs;
+    }
+
+    friend constexpr bool operator<=(const compact_optional& lhs,
+                                     const compact_optional& rhs)
+    {
+        return !(rhs < lhs);
+    }
+
+    friend constexpr bool operator>=(const compact_optional& lhs,
+                                     const compact_optional& rhs)
+    {
+        return !(lhs < rhs);
+    }
+
+    friend constexpr bool operator==(const compact_optional& opt,
+                                     std::nullopt_t) noexcept
+    {
+        return !opt.has_value();
+    }
+
+    friend constexpr bool operator==(std::nullopt_t,
+                                     const compact_optional& opt) noexcept
+    {
+        return !opt.has_value();
+    }
+
+    friend constexpr bool operator!=(const compact_optional& opt,
+                                     std::nullopt_t) noexcept
+    {
+        return opt.has_value();
+    }
+
+    friend constexpr bool operator!=(std::nullopt_t,
+                                     const compact_optional& opt) noexcept
+    {
+        return opt.has_value();
+    }
+
+private:
+    constexpr void check() const
+    {
+        if (!has_value()) {
+            throw std::bad_optional_access{};
+        }
+    }
+
+    T value_;
+};
+
+} // namespace utility
+
+#endif //DETAIL_COMPACT_OPTIONAL_H
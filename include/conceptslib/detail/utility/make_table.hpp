@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_MAKE_TABLE_H
+#define DETAIL_MAKE_TABLE_H
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include <conceptslib/detail/concepts/callable.hpp>
+#include <conceptslib/detail/functional/invoke.hpp>
+#include <conceptslib/detail/type_traits/type_traits.hpp>
+
+namespace utility
+{
+/// Type of the entries of the table make_table<N>(f) builds
+template<class F>
+using table_entry_t = traits::remove_cvref_t<
+    functional::invoke_result_t<F&, std::size_t>>;
+
+/* --- Function make_table --- */
+/**
+ * Table of the N values f(0), ..., f(N - 1)
+ * @details f is invoked once per index, in order. make_table is constexpr: a
+ * constexpr variable initialized with it is computed by the compiler and
+ * stored in the binary, so the table costs nothing at startup, e.g.
+ * \code
+ * constexpr auto crc_table = utility::make_table<256>(crc_entry);
+ * \endcode
+ * @tparam F Must satisfy \c concepts::RegularInvocable<F&, std::size_t>, and
+ * return a DefaultConstructible type.
+ */
+template<std::size_t N, class F>
+constexpr auto make_table(F f)
+    -> std::enable_if_t<concepts::RegularInvocable<F&, std::size_t>
+                       ,std::array<table_entry_t<F>, N>>
+{
+    static_assert(std::is_default_constructible_v<table_entry_t<F>>,
+                  "make_table requires DefaultConstructible entries");
+
+    std::array<table_entry_t<F>, N> table{};
+    for (std::size_t i = 0; i < N; ++i) {
+        table[i] = functional::invoke(f, i);
+    }
+    return table;
+}
+
+} // namespace utility
+
+#endif //DETAIL_MAKE_TABLE_H
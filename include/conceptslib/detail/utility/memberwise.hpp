@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_MEMBERWISE_H
+#define DETAIL_MEMBERWISE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/type_traits/type_traits.hpp>
+#include <conceptslib/detail/utility/reflection.hpp>
+
+namespace utility
+{
+/**
+ * Memberwise operations on aggregates: equality, lexicographic order, hash
+ * and binary serialization, derived from the fields found by visit_fields.
+ * Fields are compared, hashed and serialized with their own operations when
+ * they have them, and memberwise otherwise, so nested aggregates need no code.
+ */
+template<class T>
+bool memberwise_equal(const T& lhs, const T& rhs);
+
+template<class T>
+bool memberwise_less(const T& lhs, const T& rhs);
+
+template<class T>
+std::size_t memberwise_hash(const T& value) noexcept;
+
+namespace detail
+{
+template<class T>
+using equal_t = decltype(std::declval<const T&>() == std::declval<const T&>());
+
+template<class T>
+using less_t = decltype(std::declval<const T&>() < std::declval<const T&>());
+
+template<class T>
+using std_hash_t = decltype(std::hash<T>{}(std::declval<const T&>()));
+
+/* --- Fields --- */
+template<class T>
+bool field_equal(const T& lhs, const T& rhs)
+{
+    if constexpr (traits::is_detected_v<equal_t, T>) {
+        return static_cast<bool>(lhs == rhs);
+    } else {
+        return memberwise_equal(lhs, rhs);
+    }
+}
+
+template<class T>
+bool field_less(const T& lhs, const T& rhs)
+{
+    if constexpr (traits::is_detected_v<less_t, T>) {
+        return static_cast<bool>(lhs < rhs);
+    } else {
+        return memberwise_less(lhs, rhs);
+    }
+}
+
+// A field compared with its own operator== must be hashed with std::hash:
+// hashing its fields could tell apart values it finds equal
+template<class T>
+std::size_t field_hash(const T& value) noexcept
+{
+    if constexpr (traits::is_detected_v<std_hash_t, T>) {
+        return std::hash<T>{}(value);
+    } else {
+        static_assert(!std::is_class_v<T> || !traits::is_detected_v<equal_t, T>,
+                      "Fields with their own operator== must specialize "
+                      "std::hash to be hashed memberwise");
+        return memberwise_hash(value);
+    }
+}
+
+/* --- Hashing --- */
+constexpr std::uint64_t mix(std::uint64_t x) noexcept
+{
+    x *= 0xbf58476d1ce4e5b9ull;
+    return x ^ (x >> 31);
+}
+
+// Hash of size bytes, read eight at a time
+inline std::size_t hash_bytes(const void* data, std::size_t size) noexcept
+{
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    std::uint64_t hash = 0x9e3779b97f4a7c15ull ^ size;
+    for (; size >= sizeof(std::uint64_t); size -= sizeof(std::uint64_t)) {
+        std::uint64_t word;
+        std::memcpy(&word, bytes, sizeof(word));
+        hash = mix(hash ^ word);
+        bytes += sizeof(word);
+    }
+    if (size != 0) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, bytes, size);
+        hash = mix(hash ^ word);
+    }
+    return static_cast<std::size_t>(mix(hash));
+}
+
+constexpr std::size_t hash_combine(std::size_t seed, std::size_t hash) noexcept
+{
+    return seed ^ (hash + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+}
+
+/* --- Bulk comparison --- */
+template<class T>
+constexpr bool bytewise_fields();
+
+// Whether field_equal on a field of type F compares its bytes: F is a scalar,
+// or an aggregate without operator== whose fields compare their bytes
+template<class F>
+constexpr bool bytewise_field()
+{
+    if constexpr (std::is_scalar_v<F>) {
+        return true;
+    } else if constexpr (std::is_class_v<F> &&
+                         !traits::is_detected_v<equal_t, F>) {
+        return bytewise_fields<F>();
+    } else {
+        return false;
+    }
+}
+
+template<class Fields>
+struct all_bytewise;
+
+template<class... Fs>
+struct all_bytewise<tuple<Fs&...>>
+{
+    static constexpr bool value =
+        (bytewise_field<std::remove_cv_t<Fs>>() && ...);
+};
+
+template<class T>
+constexpr bool bytewise_fields()
+{
+    if constexpr (reflectable_v<T>) {
+        return all_bytewise<fields_t<T>>::value;
+    } else {
+        return false;
+    }
+}
+
+// Whether memberwise_equal on T is a memcmp: T has unique object
+// representations, so equal values have equal bytes, and no field has an
+// operator== of its own, which could tell apart values with equal bytes or
+// equate values with different ones
+template<class T>
+constexpr bool bytewise_comparable()
+{
+    if constexpr (std::has_unique_object_representations_v<T>) {
+        return std::is_scalar_v<T> || bytewise_fields<T>();
+    } else {
+        return false;
+    }
+}
+
+} // namespace detail
+
+/* --- Function memberwise_equal --- */
+/**
+ * Whether every field of lhs equals the corresponding field of rhs
+ * @details If T has unique object representations (it has no padding and no
+ * floating point fields) and its fields are scalars or aggregates of scalars,
+ * equal values have equal bytes, and the comparison is a single memcmp. A
+ * field with its own operator== is always compared with it.
+ */
+template<class T>
+bool memberwise_equal(const T& lhs, const T& rhs)
+{
+    if constexpr (detail::bytewise_comparable<T>()) {
+        return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+    } else {
+        return visit_fields(lhs, [&rhs](const auto&... l) {
+            return visit_fields(rhs, [&l...](const auto&... r) {
+                return (detail::field_equal(l, r) && ...);
+            });
+        });
+    }
+}
+
+/* --- Function memberwise_less --- */
+/**
+ * Whether lhs precedes rhs in the lexicographic order of their fields
+ * @note Unlike equality, the order of the fields is not the order of the
+ * bytes on little endian platforms, so it is always computed memberwise.
+ */
+template<class T>
+bool memberwise_less(const T& lhs, const T& rhs)
+{
+    return visit_fields(lhs, [&rhs](const auto&... l) {
+        return visit_fields(rhs, [&l...](const auto&... r) {
+            // The first field that differs decides
+            int order = 0;
+            ((order = detail::field_less(l, r)   ? -1
+                      : detail::field_less(r, l) ? 1
+                                                 : 0,
+              order == 0) && ...);
+            return order < 0;
+        });
+    });
+}
+
+/* --- Function memberwise_hash --- */
+/**
+ * Hash of the fields of value, consistent with memberwise_equal
+ * @details If memberwise_equal compares the bytes of T, they are hashed in
+ * bulk, eight at a time. Otherwise the hashes of the fields are combined. A
+ * field is hashed with std::hash when it is specialized for it, which it must
+ * be for class fields with their own operator==.
+ */
+template<class T>
+std::size_t memberwise_hash(const T& value) noexcept
+{
+    if constexpr (detail::bytewise_comparable<T>()) {
+        return detail::hash_bytes(&value, sizeof(T));
+    } else {
+        std::size_t seed = field_count_v<T>;
+        for_each_field(value, [&seed](const auto& field) {
+            seed = detail::hash_combine(seed, detail::field_hash(field));
+        });
+        return seed;
+    }
+}
+
+/* --- Function objects --- */
+// Hash and key equality of unordered containers of aggregates
+struct memberwise_hasher
+{
+    template<class T>
+    std::size_t operator()(const T& value) const noexcept
+    {
+        return memberwise_hash(value);
+    }
+};
+
+struct memberwise_equal_to
+{
+    template<class T>
+    bool operator()(const T& lhs, const T& rhs) const
+    {
+        return memberwise_equal(lhs, rhs);
+    }
+};
+
+/* --- Binary serialization --- */
+namespace detail
+{
+enum class serial_kind { bulk, memberwise, unsupported };
+
+template<class T>
+constexpr serial_kind serial_kind_of();
+
+template<class Fields>
+struct fields_serialized_size;
+
+template<class T>
+constexpr std::size_t serialized_size()
+{
+    static_assert(serial_kind_of<T>() != serial_kind::unsupported,
+                  "Serialized types must be trivially copyable, or aggregates "
+                  "of serializable types");
+    if constexpr (serial_kind_of<T>() == serial_kind::bulk) {
+        return sizeof(T);
+    } else {
+        return fields_serialized_size<fields_t<T>>::value;
+    }
+}
+
+template<class... Fs>
+struct fields_serialized_size<tuple<Fs&...>>
+{
+    static constexpr std::size_t value = (std::size_t{0} + ... +
+                                          serialized_size<Fs>());
+};
+
+// Serialized size of the fields of T, or 0 if T is not an aggregate
+template<class T>
+constexpr std::size_t memberwise_size()
+{
+    if constexpr (reflectable_v<T>) {
+        return fields_serialized_size<fields_t<T>>::value;
+    } else {
+        return 0;
+    }
+}
+
+// Trivially copyable types without padding are copied in bulk, so that a
+// struct of fields without padding is a single memcpy
+template<class T>
+constexpr serial_kind serial_kind_of()
+{
+    if constexpr (std::is_trivially_copyable_v<T> &&
+                  (!reflectable_v<T> || memberwise_size<T>() == sizeof(T))) {
+        return serial_kind::bulk;
+    } else if constexpr (reflectable_v<T>) {
+        return serial_kind::memberwise;
+    } else {
+        return serial_kind::unsupported;
+    }
+}
+
+} // namespace detail
+
+/**
+ * Number of bytes written by serialize(value, out) for a value of type T
+ * @details The fields are written without the padding between them.
+ */
+template<class T>
+inline constexpr std::size_t serialized_size_v = detail::serialized_size<T>();
+
+/**
+ * Write the fields of value to out, in declaration order and in the native
+ * byte order
+ * @return Pointer past the last byte written
+ * @details Trivially copyable values without padding are written with a single
+ * memcpy. Other aggregates are written field by field, skipping padding.
+ */
+template<class T>
+unsigned char* serialize(const T& value, unsigned char* out) noexcept
+{
+    if constexpr (detail::serial_kind_of<T>() == detail::serial_kind::bulk) {
+        std::memcpy(out, &value, sizeof(T));
+        return out + sizeof(T);
+    } else {
+        static_cast<void>(serialized_size_v<T>); // Check every field
+        for_each_field(value, [&out](const auto& field) {
+            out = serialize(field, out);
+        });
+        return out;
+    }
+}
+
+/**
+ * Read the fields of value from in, as written by serialize
+ * @return Pointer past the last byte read
+ */
+template<class T>
+const unsigned char* deserialize(T& value, const unsigned char* in) noexcept
+{
+    if constexpr (detail::serial_kind_of<T>() == detail::serial_kind::bulk) {
+        std::memcpy(&value, in, sizeof(T));
+        return in + sizeof(T);
+    } else {
+        static_cast<void>(serialized_size_v<T>); // Check every field
+        for_each_field(value, [&in](auto& field) {
+            in = deserialize(field, in);
+        });
+        return in;
+    }
+}
+
+} // namespace utility
+
+#endif //DETAIL_MEMBERWISE_H
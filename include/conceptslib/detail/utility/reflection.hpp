@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_REFLECTION_H
+#define DETAIL_REFLECTION_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/type_traits/type_traits.hpp>
+#include <conceptslib/detail/utility/tuple.hpp>
+
+namespace utility
+{
+/// Largest number of fields of the aggregates that can be reflected
+constexpr std::size_t max_fields = 32;
+
+namespace detail
+{
+/* --- Aggregate arity --- */
+// Converts to the type of any field. Only used in unevaluated contexts.
+struct any_field
+{
+    template<class U>
+    operator U() const noexcept;
+};
+
+template<class T, std::size_t... Is>
+auto braced_init(std::index_sequence<Is...>)
+    -> decltype(T{(void(Is), any_field{})...});
+
+template<class T, class Is>
+using braced_init_t = decltype(braced_init<T>(std::declval<Is>()));
+
+// T{f1, ..., fN} is valid for fields fI of any type
+template<class T, std::size_t N>
+inline constexpr bool brace_constructible_v =
+    traits::is_detected_v<braced_init_t, T, std::make_index_sequence<N>>;
+
+// An aggregate with N fields can be initialized from up to N initializers
+template<class T, std::size_t N = 0>
+constexpr std::size_t count_fields()
+{
+    if constexpr (N <= max_fields && brace_constructible_v<T, N + 1>) {
+        return count_fields<T, N + 1>();
+    } else {
+        return N;
+    }
+}
+
+} // namespace detail
+
+/* --- Variable template field_count_v --- */
+/**
+ * Number of fields of the aggregate T
+ * @details Detected as the largest N for which T{f1, ..., fN} is valid, with
+ * initializers convertible to any type.
+ * @attention Only aggregates without base classes, C arrays or reference
+ * fields have the expected count: brace elision lets a C array field take one
+ * initializer per element.
+ */
+template<class T>
+inline constexpr std::size_t field_count_v = detail::count_fields<T>();
+
+/* --- Variable template reflectable_v --- */
+/// Whether the fields of T can be accessed by visit_fields
+template<class T>
+inline constexpr bool reflectable_v =
+    std::is_aggregate_v<T> && !std::is_array_v<T> &&
+    field_count_v<T> <= max_fields;
+
+/* --- Function visit_fields --- */
+// Names of the structured bindings of N fields
+#define DETAIL_FIELDS_1 f1
+#define DETAIL_FIELDS_2 DETAIL_FIELDS_1, f2
+#define DETAIL_FIELDS_3 DETAIL_FIELDS_2, f3
+#define DETAIL_FIELDS_4 DETAIL_FIELDS_3, f4
+#define DETAIL_FIELDS_5 DETAIL_FIELDS_4, f5
+#define DETAIL_FIELDS_6 DETAIL_FIELDS_5, f6
+#define DETAIL_FIELDS_7 DETAIL_FIELDS_6, f7
+#define DETAIL_FIELDS_8 DETAIL_FIELDS_7, f8
+#define DETAIL_FIELDS_9 DETAIL_FIELDS_8, f9
+#define DETAIL_FIELDS_10 DETAIL_FIELDS_9, f10
+#define DETAIL_FIELDS_11 DETAIL_FIELDS_10, f11
+#define DETAIL_FIELDS_12 DETAIL_FIELDS_11, f12
+#define DETAIL_FIELDS_13 DETAIL_FIELDS_12, f13
+#define DETAIL_FIELDS_14 DETAIL_FIELDS_13, f14
+#define DETAIL_FIELDS_15 DETAIL_FIELDS_14, f15
+#define DETAIL_FIELDS_16 DETAIL_FIELDS_15, f16
+#define DETAIL_FIELDS_17 DETAIL_FIELDS_16, f17
+#define DETAIL_FIELDS_18 DETAIL_FIELDS_17, f18
+#define DETAIL_FIELDS_19 DETAIL_FIELDS_18, f19
+#define DETAIL_FIELDS_20 DETAIL_FIELDS_19, f20
+#define DETAIL_FIELDS_21 DETAIL_FIELDS_20, f21
+#define DETAIL_FIELDS_22 DETAIL_FIELDS_21, f22
+#define DETAIL_FIELDS_23 DETAIL_FIELDS_22, f23
+#define DETAIL_FIELDS_24 DETAIL_FIELDS_23, f24
+#define DETAIL_FIELDS_25 DETAIL_FIELDS_24, f25
+#define DETAIL_FIELDS_26 DETAIL_FIELDS_25, f26
+#define DETAIL_FIELDS_27 DETAIL_FIELDS_26, f27
+#define DETAIL_FIELDS_28 DETAIL_FIELDS_27, f28
+#define DETAIL_FIELDS_29 DETAIL_FIELDS_28, f29
+#define DETAIL_FIELDS_30 DETAIL_FIELDS_29, f30
+#define DETAIL_FIELDS_31 DETAIL_FIELDS_30, f31
+#define DETAIL_FIELDS_32 DETAIL_FIELDS_31, f32
+
+/**
+ * Invoke f with lvalues referring to the fields of the aggregate value, in
+ * declaration order
+ * @details Fields are bound with a structured binding, so accessing them is
+ * as cheap as naming them.
+ */
+template<class T, class F>
+constexpr decltype(auto) visit_fields(T& value, F&& f)
+{
+    static_assert(reflectable_v<std::remove_const_t<T>>,
+                  "visit_fields requires an aggregate with at most "
+                  "max_fields fields");
+    constexpr std::size_t count = field_count_v<std::remove_const_t<T>>;
+
+    if constexpr (count == 0) {
+        return std::forward<F>(f)();
+    } else if constexpr (count == 1) {
+        auto& [DETAIL_FIELDS_1] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_1);
+    } else if constexpr (count == 2) {
+        auto& [DETAIL_FIELDS_2] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_2);
+    } else if constexpr (count == 3) {
+        auto& [DETAIL_FIELDS_3] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_3);
+    } else if constexpr (count == 4) {
+        auto& [DETAIL_FIELDS_4] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_4);
+    } else if constexpr (count == 5) {
+        auto& [DETAIL_FIELDS_5] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_5);
+    } else if constexpr (count == 6) {
+        auto& [DETAIL_FIELDS_6] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_6);
+    } else if constexpr (count == 7) {
+        auto& [DETAIL_FIELDS_7] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_7);
+    } else if constexpr (count == 8) {
+        auto& [DETAIL_FIELDS_8] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_8);
+    } else if constexpr (count == 9) {
+        auto& [DETAIL_FIELDS_9] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_9);
+    } else if constexpr (count == 10) {
+        auto& [DETAIL_FIELDS_10] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_10);
+    } else if constexpr (count == 11) {
+        auto& [DETAIL_FIELDS_11] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_11);
+    } else if constexpr (count == 12) {
+        auto& [DETAIL_FIELDS_12] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_12);
+    } else if constexpr (count == 13) {
+        auto& [DETAIL_FIELDS_13] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_13);
+    } else if constexpr (count == 14) {
+        auto& [DETAIL_FIELDS_14] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_14);
+    } else if constexpr (count == 15) {
+        auto& [DETAIL_FIELDS_15] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_15);
+    } else if constexpr (count == 16) {
+        auto& [DETAIL_FIELDS_16] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_16);
+    } else if constexpr (count == 17) {
+        auto& [DETAIL_FIELDS_17] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_17);
+    } else if constexpr (count == 18) {
+        auto& [DETAIL_FIELDS_18] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_18);
+    } else if constexpr (count == 19) {
+        auto& [DETAIL_FIELDS_19] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_19);
+    } else if constexpr (count == 20) {
+        auto& [DETAIL_FIELDS_20] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_20);
+    } else if constexpr (count == 21) {
+        auto& [DETAIL_FIELDS_21] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_21);
+    } else if constexpr (count == 22) {
+        auto& [DETAIL_FIELDS_22] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_22);
+    } else if constexpr (count == 23) {
+        auto& [DETAIL_FIELDS_23] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_23);
+    } else if constexpr (count == 24) {
+        auto& [DETAIL_FIELDS_24] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_24);
+    } else if constexpr (count == 25) {
+        auto& [DETAIL_FIELDS_25] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_25);
+    } else if constexpr (count == 26) {
+        auto& [DETAIL_FIELDS_26] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_26);
+    } else if constexpr (count == 27) {
+        auto& [DETAIL_FIELDS_27] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_27);
+    } else if constexpr (count == 28) {
+        auto& [DETAIL_FIELDS_28] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_28);
+    } else if constexpr (count == 29) {
+        auto& [DETAIL_FIELDS_29] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_29);
+    } else if constexpr (count == 30) {
+        auto& [DETAIL_FIELDS_30] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_30);
+    } else if constexpr (count == 31) {
+        auto& [DETAIL_FIELDS_31] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_31);
+    } else if constexpr (count == 32) {
+        auto& [DETAIL_FIELDS_32] = value;
+        return std::forward<F>(f)(DETAIL_FIELDS_32);
+    }
+}
+
+#undef DETAIL_FIELDS_1
+#undef DETAIL_FIELDS_2
+#undef DETAIL_FIELDS_3
+#undef DETAIL_FIELDS_4
+#undef DETAIL_FIELDS_5
+#undef DETAIL_FIELDS_6
+#undef DETAIL_FIELDS_7
+#undef DETAIL_FIELDS_8
+#undef DETAIL_FIELDS_9
+#undef DETAIL_FIELDS_10
+#undef DETAIL_FIELDS_11
+#undef DETAIL_FIELDS_12
+#undef DETAIL_FIELDS_13
+#undef DETAIL_FIELDS_14
+#undef DETAIL_FIELDS_15
+#undef DETAIL_FIELDS_16
+#undef DETAIL_FIELDS_17
+#undef DETAIL_FIELDS_18
+#undef DETAIL_FIELDS_19
+#undef DETAIL_FIELDS_20
+#undef DETAIL_FIELDS_21
+#undef DETAIL_FIELDS_22
+#undef DETAIL_FIELDS_23
+#undef DETAIL_FIELDS_24
+#undef DETAIL_FIELDS_25
+#undef DETAIL_FIELDS_26
+#undef DETAIL_FIELDS_27
+#undef DETAIL_FIELDS_28
+#undef DETAIL_FIELDS_29
+#undef DETAIL_FIELDS_30
+#undef DETAIL_FIELDS_31
+#undef DETAIL_FIELDS_32
+
+/* --- Function for_each_field --- */
+/// Invoke f with each field of the aggregate value, in declaration order
+template<class T, class F>
+constexpr void for_each_field(T& value, F&& f)
+{
+    visit_fields(value, [&f](auto&... fields) { (f(fields), ...); });
+}
+
+/* --- Function tie_fields --- */
+namespace detail
+{
+struct tie_fn
+{
+    template<class... Fs>
+    constexpr tuple<Fs&...> operator()(Fs&... fields) const noexcept
+    {
+        return tuple<Fs&...>(fields...);
+    }
+};
+
+} // namespace detail
+
+/// Tuple of lvalue references to the fields of the aggregate value
+template<class T>
+constexpr auto tie_fields(T& value) noexcept
+{
+    return visit_fields(value, detail::tie_fn{});
+}
+
+/// Tuple of lvalue references to the fields of T
+template<class T>
+using fields_t = decltype(tie_fields(std::declval<T&>()));
+
+} // namespace utility
+
+#endif //DETAIL_REFLECTION_H
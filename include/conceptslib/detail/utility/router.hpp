@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_ROUTER_H
+#define DETAIL_ROUTER_H
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/concepts/satisfying.hpp>
+#include <conceptslib/detail/functional/invoke.hpp>
+#include <conceptslib/detail/type_traits/list.hpp>
+#include <conceptslib/detail/utility/tuple.hpp>
+#include <conceptslib/detail/utility/visit.hpp>
+
+namespace utility
+{
+namespace detail
+{
+/// Index of the first handler of the list Handlers invocable with a Message
+template<class Handlers, class Message>
+inline constexpr std::size_t handler_index_v =
+    concepts::first_satisfying_v<concepts::invocable, Handlers, Message>;
+
+} // namespace detail
+
+/* --- Class router --- */
+/**
+ * Deliver each message to the first of the handlers Hs... which satisfies
+ * \c concepts::Invocable with it.
+ * @details The handler of every message type is chosen at compile time, by
+ * \c concepts::first_satisfying over all the handlers at once. A message held
+ * by a \c std::variant is delivered by \c utility::visit: a single switch on
+ * the index of the variant, whose cases call their handlers directly. The
+ * result is the \c traits::common_reference_t of the results of the handlers
+ * of the alternatives. A message without handler does not compile.
+ */
+template<class... Hs>
+class router
+{
+public:
+    using handlers = traits::list<Hs...>;
+
+    /// Index of the handler of a message of type Message, or sizeof...(Hs)
+    template<class Message>
+    static constexpr std::size_t handler_index =
+        detail::handler_index_v<traits::list<Hs&...>, Message>;
+
+    constexpr router() = default;
+
+    constexpr explicit router(Hs... hs)
+        : handlers_(std::move(hs)...)
+    { }
+
+    template<class Message>
+    constexpr decltype(auto) operator()(Message&& message)
+    {
+        return dispatch(*this, std::forward<Message>(message));
+    }
+
+    template<class Message>
+    constexpr decltype(auto) operator()(Message&& message) const
+    {
+        return dispatch(*this, std::forward<Message>(message));
+    }
+
+private:
+    template<class Self, class Message>
+    static constexpr decltype(auto) dispatch(Self& self, Message&& message)
+    {
+        if constexpr (detail::is_variant_v<traits::remove_cvref_t<Message>>) {
+            return utility::visit(
+                [&self](auto&& alternative) -> decltype(auto) {
+                    return deliver(
+                        self, std::forward<decltype(alternative)>(alternative));
+                },
+                std::forward<Message>(message));
+        } else {
+            return deliver(self, std::forward<Message>(message));
+        }
+    }
+
+    template<class Self, class Message>
+    static constexpr decltype(auto) deliver(Self& self, Message&& message)
+    {
+        using self_handlers = traits::list<
+            std::conditional_t<std::is_const_v<Self>, const Hs, Hs>&...>;
+        constexpr std::size_t i =
+            detail::handler_index_v<self_handlers, Message>;
+        static_assert(i < sizeof...(Hs), "no handler accepts the message");
+
+        return functional::invoke(get<i>(self.handlers_),
+                                  std::forward<Message>(message));
+    }
+
+    tuple<Hs...> handlers_;
+};
+
+template<class... Hs>
+router(Hs...) -> router<Hs...>;
+
+} // namespace utility
+
+#endif //DETAIL_ROUTER_H
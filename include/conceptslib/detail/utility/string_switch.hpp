@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_STRING_SWITCH_H
+#define DETAIL_STRING_SWITCH_H
+
+#include <cstddef>
+#include <string_view>
+#include <utility>
+
+#include <conceptslib/detail/containers/frozen_map.hpp>
+
+namespace utility
+{
+namespace detail
+{
+template<std::size_t N, std::size_t... Is>
+constexpr containers::frozen_map<std::string_view, std::size_t, N>
+make_case_map(const std::string_view (&cases)[N], std::index_sequence<Is...>)
+{
+    const std::pair<std::string_view, std::size_t> elements[N] = {
+        {cases[Is], Is}...};
+    return containers::frozen_map<std::string_view, std::size_t, N>(elements);
+}
+
+} // namespace detail
+
+/* --- Class string_switch --- */
+/**
+ * Switch on a string: maps each of N strings to its index, and any other
+ * string to N, with the perfect hash of a \c containers::frozen_map.
+ * @details The indices are constant expressions, so they can be the labels of
+ * the cases of a switch; a label which is not one of the strings does not
+ * compile:
+ * \code
+ * constexpr auto method = utility::make_string_switch({"GET", "POST"});
+ * switch (method(request)) {
+ * case method.case_("GET"): ...
+ * case method.case_("POST"): ...
+ * case method.none: ...
+ * }
+ * \endcode
+ */
+template<std::size_t N>
+class string_switch
+{
+public:
+    /// Index of the strings which are none of the cases
+    static constexpr std::size_t none = N;
+
+    constexpr explicit string_switch(const std::string_view (&cases)[N])
+        : map_{detail::make_case_map(cases, std::make_index_sequence<N>{})}
+    { }
+
+    /// Index of the case s, or none
+    constexpr std::size_t operator()(std::string_view s) const
+    {
+        return map_.index_of(s);
+    }
+
+    /// Index of the case s, which must be one of the cases
+    constexpr std::size_t case_(std::string_view s) const
+    {
+        return map_.at(s);
+    }
+
+private:
+    containers::frozen_map<std::string_view, std::size_t, N> map_;
+};
+
+template<std::size_t N>
+constexpr string_switch<N> make_string_switch(
+    const std::string_view (&cases)[N])
+{
+    return string_switch<N>(cases);
+}
+
+} // namespace utility
+
+#endif //DETAIL_STRING_SWITCH_H
@@ -0,0 +1,547 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_TUPLE_H
+#define DETAIL_TUPLE_H
+
+#include <cstddef>
+#include <functional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <conceptslib/detail/concepts/concepts.hpp>
+#include <conceptslib/detail/concepts/core.hpp>
+#include <conceptslib/detail/concepts/comparison.hpp>
+#include <conceptslib/detail/functional/invoke.hpp>
+#include <conceptslib/detail/type_traits/common_reference.hpp>
+
+namespace utility
+{
+template<class... Ts>
+class tuple;
+
+template<std::size_t I, class... Ts>
+constexpr auto& get(tuple<Ts...>& t) noexcept;
+
+template<std::size_t I, class... Ts>
+constexpr decltype(auto) get(const tuple<Ts...>& t) noexcept;
+
+template<std::size_t I, class... Ts>
+constexpr decltype(auto) get(tuple<Ts...>&& t) noexcept;
+
+template<std::size_t I, class... Ts>
+constexpr decltype(auto) get(const tuple<Ts...>&& t) noexcept;
+
+namespace detail
+{
+template<class T>
+inline constexpr bool is_tuple_v = false;
+
+template<class... Ts>
+inline constexpr bool is_tuple_v<tuple<Ts...>> = true;
+
+/* --- Tuple leaves --- */
+enum class leaf_kind { value, empty, reference };
+
+// Empty tuples are stored: inheriting their leaves would make the leaves of
+// the outer tuple ambiguous bases
+template<class T>
+inline constexpr leaf_kind leaf_kind_v =
+    std::is_reference_v<T> ? leaf_kind::reference
+    : std::is_empty_v<T> && !std::is_final_v<T> && !is_tuple_v<T>
+        ? leaf_kind::empty
+        : leaf_kind::value;
+
+/**
+ * Element I of a tuple. Every element is a direct base of the tuple, so
+ * accessing one is a derived to base conversion: the instantiation depth of
+ * get<I> does not depend on the number of elements.
+ * @details Empty, non final class types are inherited from instead of stored,
+ * so that they take no space (empty base optimization). References are
+ * assigned through, as std::tuple; leaves of other types keep the implicit
+ * copy and move operations, so a tuple of trivially copyable types is
+ * trivially copyable.
+ */
+template<std::size_t I, class T, leaf_kind = leaf_kind_v<T>>
+class tuple_leaf
+{
+public:
+    template<class U = T
+            ,class = std::enable_if_t<std::is_default_constructible_v<U>>>
+    constexpr tuple_leaf(): value_()
+    { }
+
+    template<class U>
+    constexpr explicit tuple_leaf(std::in_place_t, U&& value)
+        : value_(std::forward<U>(value))
+    { }
+
+    constexpr T& element() noexcept { return value_; }
+    constexpr const T& element() const noexcept { return value_; }
+
+private:
+    T value_;
+};
+
+template<std::size_t I, class T>
+class tuple_leaf<I, T, leaf_kind::empty>: private T
+{
+public:
+    constexpr tuple_leaf() = default;
+
+    template<class U>
+    constexpr explicit tuple_leaf(std::in_place_t, U&& value)
+        : T(std::forward<U>(value))
+    { }
+
+    constexpr T& element() noexcept { return *this; }
+    constexpr const T& element() const noexcept { return *this; }
+};
+
+template<std::size_t I, class T>
+class tuple_leaf<I, T, leaf_kind::reference>
+{
+public:
+    template<class U>
+    constexpr explicit tuple_leaf(std::in_place_t, U&& value)
+        : value_(std::forward<U>(value))
+    { }
+
+    // Deleted for rvalue references, which are only moved, as in std::tuple
+    constexpr tuple_leaf(const tuple_leaf&) = default;
+    constexpr tuple_leaf(tuple_leaf&&) = default;
+
+    constexpr tuple_leaf& operator=(const tuple_leaf& other)
+    {
+        value_ = other.value_;
+        return *this;
+    }
+
+    constexpr tuple_leaf& operator=(tuple_leaf&& other)
+    {
+        value_ = std::forward<T>(other.value_);
+        return *this;
+    }
+
+    constexpr T& element() const noexcept { return value_; }
+
+private:
+    T value_;
+};
+
+// Select leaf I by overload resolution: T is deduced from the base class
+template<std::size_t I, class T, leaf_kind Kind>
+constexpr tuple_leaf<I, T, Kind>& leaf(tuple_leaf<I, T, Kind>& l) noexcept
+{
+    return l;
+}
+
+template<std::size_t I, class T, leaf_kind Kind>
+constexpr const tuple_leaf<I, T, Kind>&
+leaf(const tuple_leaf<I, T, Kind>& l) noexcept
+{
+    return l;
+}
+
+template<class T>
+struct type_identity
+{
+    using type = T;
+};
+
+template<std::size_t I, class T, leaf_kind Kind>
+constexpr type_identity<T> element_type_of(const tuple_leaf<I, T, Kind>&);
+
+template<class Is, class... Ts>
+class tuple_base;
+
+template<std::size_t... Is, class... Ts>
+class tuple_base<std::index_sequence<Is...>, Ts...>
+    : public tuple_leaf<Is, Ts>...
+{
+public:
+    constexpr tuple_base() = default;
+
+    template<class... Us>
+    constexpr explicit tuple_base(std::in_place_t, Us&&... values)
+        : tuple_leaf<Is, Ts>(std::in_place, std::forward<Us>(values))...
+    { }
+};
+
+// Constructing tuple<Ts...> element by element from Us&&... The packs are
+// only expanded together if they have the same size.
+template<bool SameSize, class Tuple, class... Us>
+inline constexpr bool elementwise_constructible_imp = false;
+
+template<class... Ts, class... Us>
+inline constexpr bool elementwise_constructible_imp<true, tuple<Ts...>, Us...> =
+    (std::is_constructible_v<Ts, Us&&> && ...);
+
+template<class Tuple, class... Us>
+inline constexpr bool elementwise_constructible_v = false;
+
+template<class... Ts, class... Us>
+inline constexpr bool elementwise_constructible_v<tuple<Ts...>, Us...> =
+    elementwise_constructible_imp<sizeof...(Ts) == sizeof...(Us)
+                                 ,tuple<Ts...>, Us...>;
+
+// Assigning the elements of tuple<Ts...> from Us&&...
+template<bool SameSize, class Tuple, class... Us>
+inline constexpr bool elementwise_assignable_imp = false;
+
+template<class... Ts, class... Us>
+inline constexpr bool elementwise_assignable_imp<true, tuple<Ts...>, Us...> =
+    (std::is_assignable_v<Ts&, Us&&> && ...);
+
+template<class Tuple, class... Us>
+inline constexpr bool elementwise_assignable_v = false;
+
+template<class... Ts, class... Us>
+inline constexpr bool elementwise_assignable_v<tuple<Ts...>, Us...> =
+    elementwise_assignable_imp<sizeof...(Ts) == sizeof...(Us)
+                              ,tuple<Ts...>, Us...>;
+
+} // namespace detail
+
+/* --- Class tuple --- */
+/**
+ * Fixed size collection of heterogeneous values with the interface of
+ * std::tuple. Unlike libstdc++'s recursive std::tuple, every element is a
+ * direct base class, so the instantiation depth of the tuple and of get<I>
+ * is constant, and empty elements take no space.
+ * @details Comparisons are provided if every element satisfies
+ * \c concepts::EqualityComparable (== and !=) or
+ * \c concepts::StrictTotallyOrdered (<, >, <= and >=, lexicographically).
+ * \c traits::common_reference_t of two tuples of the same size is the tuple
+ * of the common references of their elements.
+ */
+template<class... Ts>
+class tuple: public detail::tuple_base<std::index_sequence_for<Ts...>, Ts...>
+{
+    using base_t = detail::tuple_base<std::index_sequence_for<Ts...>, Ts...>;
+
+    struct convert_tag { };
+
+public:
+    constexpr tuple() = default;
+
+    template<class... Us
+            ,class = std::enable_if_t<
+                sizeof...(Us) != 0 &&
+                detail::elementwise_constructible_v<tuple, Us...> &&
+                !(sizeof...(Us) == 1 &&
+                  (detail::is_tuple_v<traits::remove_cvref_t<Us>> && ...))>>
+    constexpr tuple(Us&&... values)
+        : base_t(std::in_place, std::forward<Us>(values)...)
+    { }
+
+    constexpr tuple(const tuple&) = default;
+    constexpr tuple(tuple&&) = default;
+
+    /// Convert each element of other
+    template<class... Us
+            ,class = std::enable_if_t<
+                !std::is_same_v<tuple<Us...>, tuple> &&
+                detail::elementwise_constructible_v<tuple, const Us&...>>>
+    constexpr tuple(const tuple<Us...>& other)
+        : tuple(convert_tag{}, other, std::index_sequence_for<Us...>{})
+    { }
+
+    template<class... Us
+            ,class = std::enable_if_t<
+                !std::is_same_v<tuple<Us...>, tuple> &&
+                detail::elementwise_constructible_v<tuple, Us...>>>
+    constexpr tuple(tuple<Us...>&& other)
+        : tuple(convert_tag{}, std::move(other)
+               ,std::index_sequence_for<Us...>{})
+    { }
+
+    constexpr tuple& operator=(const tuple&) = default;
+    constexpr tuple& operator=(tuple&&) = default;
+
+    template<class... Us>
+    constexpr auto operator=(const tuple<Us...>& other)
+        -> std::enable_if_t<!std::is_same_v<tuple<Us...>, tuple> &&
+                            detail::elementwise_assignable_v<tuple
+                                                            ,const Us&...>
+                           ,tuple&>
+    {
+        assign(other, std::index_sequence_for<Us...>{});
+        return *this;
+    }
+
+    template<class... Us>
+    constexpr auto operator=(tuple<Us...>&& other)
+        -> std::enable_if_t<!std::is_same_v<tuple<Us...>, tuple> &&
+                            detail::elementwise_assignable_v<tuple, Us...>
+                           ,tuple&>
+    {
+        assign(std::move(other), std::index_sequence_for<Us...>{});
+        return *this;
+    }
+
+    constexpr void swap(tuple& other)
+        noexcept((std::is_nothrow_swappable_v<Ts> && ...))
+    {
+        swap(other, std::index_sequence_for<Ts...>{});
+    }
+
+    friend constexpr void swap(tuple& lhs, tuple& rhs)
+        noexcept((std::is_nothrow_swappable_v<Ts> && ...))
+    {
+        lhs.swap(rhs);
+    }
+
+private:
+    template<class Other, std::size_t... Is>
+    constexpr tuple(convert_tag, Other&& other, std::index_sequence<Is...>)
+        : base_t(std::in_place,
+                 get<Is>(std::forward<Other>(other))...)
+    { }
+
+    template<class Other, std::size_t... Is>
+    constexpr void assign(Other&& other, std::index_sequence<Is...>)
+    {
+        ((detail::leaf<Is>(*this).element() =
+              get<Is>(std::forward<Other>(other))), ...);
+    }
+
+    template<std::size_t... Is>
+    constexpr void swap(tuple& other, std::index_sequence<Is...>)
+    {
+        using std::swap;
+        (swap(detail::leaf<Is>(*this).element(),
+              detail::leaf<Is>(other).element()), ...);
+    }
+};
+
+template<class... Ts>
+tuple(Ts...) -> tuple<Ts...>;
+
+/* --- Element access --- */
+/// Type of the element I of the tuple Tuple
+template<std::size_t I, class Tuple>
+using tuple_element_t = typename std::tuple_element<I, Tuple>::type;
+
+template<std::size_t I, class... Ts>
+constexpr auto& get(tuple<Ts...>& t) noexcept
+{
+    return detail::leaf<I>(t).element();
+}
+
+// Reference elements are not made const, as std::get
+template<std::size_t I, class... Ts>
+constexpr decltype(auto) get(const tuple<Ts...>& t) noexcept
+{
+    return detail::leaf<I>(t).element();
+}
+
+template<std::size_t I, class... Ts>
+constexpr decltype(auto) get(tuple<Ts...>&& t) noexcept
+{
+    using T = tuple_element_t<I, tuple<Ts...>>;
+    return std::forward<T>(get<I>(t));
+}
+
+template<std::size_t I, class... Ts>
+constexpr decltype(auto) get(const tuple<Ts...>&& t) noexcept
+{
+    using T = tuple_element_t<I, tuple<Ts...>>;
+    return static_cast<const T&&>(get<I>(t));
+}
+
+/* --- Creation --- */
+namespace detail
+{
+template<class T>
+struct unwrap_reference
+{
+    using type = T;
+};
+
+template<class T>
+struct unwrap_reference<std::reference_wrapper<T>>
+{
+    using type = T&;
+};
+
+template<class T>
+using unwrap_decay_t = typename unwrap_reference<std::decay_t<T>>::type;
+
+} // namespace detail
+
+/// Tuple of the decayed values (reference_wrapper<T> becomes T&)
+template<class... Ts>
+constexpr tuple<detail::unwrap_decay_t<Ts>...> make_tuple(Ts&&... values)
+{
+    return tuple<detail::unwrap_decay_t<Ts>...>(std::forward<Ts>(values)...);
+}
+
+/// Tuple of lvalue references to the arguments
+template<class... Ts>
+constexpr tuple<Ts&...> tie(Ts&... values) noexcept
+{
+    return tuple<Ts&...>(values...);
+}
+
+/// Tuple of references to the arguments, with their value categories
+template<class... Ts>
+constexpr tuple<Ts&&...> forward_as_tuple(Ts&&... values) noexcept
+{
+    return tuple<Ts&&...>(std::forward<Ts>(values)...);
+}
+
+namespace detail
+{
+template<class F, class Tuple, std::size_t... Is>
+constexpr decltype(auto) apply_imp(F&& f, Tuple&& t,
+                                   std::index_sequence<Is...>)
+{
+    return functional::invoke(std::forward<F>(f),
+                              get<Is>(std::forward<Tuple>(t))...);
+}
+
+} // namespace detail
+
+/// Invoke f with the elements of the tuple t as arguments
+template<class F, class Tuple>
+constexpr decltype(auto) apply(F&& f, Tuple&& t)
+{
+    return detail::apply_imp(
+        std::forward<F>(f), std::forward<Tuple>(t),
+        std::make_index_sequence<
+            std::tuple_size_v<traits::remove_cvref_t<Tuple>>>{});
+}
+
+/* --- Comparison --- */
+namespace detail
+{
+template<class... Ts, class... Us, std::size_t... Is>
+constexpr bool tuple_equal(const tuple<Ts...>& lhs, const tuple<Us...>& rhs,
+                           std::index_sequence<Is...>)
+{
+    return ((get<Is>(lhs) == get<Is>(rhs)) && ...);
+}
+
+// Lexicographical comparison: the fold stops at the first pair of elements
+// which are not equivalent
+template<class... Ts, class... Us, std::size_t... Is>
+constexpr bool tuple_less(const tuple<Ts...>& lhs, const tuple<Us...>& rhs,
+                          std::index_sequence<Is...>)
+{
+    bool less = false;
+    ((get<Is>(lhs) < get<Is>(rhs)
+          ? (less = true, false)
+          : !(get<Is>(rhs) < get<Is>(lhs))) && ...);
+    return less;
+}
+
+} // namespace detail
+
+template<class... Ts
+        ,class = std::enable_if_t<(concepts::EqualityComparable<Ts> && ...)>>
+constexpr bool operator==(const tuple<Ts...>& lhs, const tuple<Ts...>& rhs)
+{
+    return detail::tuple_equal(lhs, rhs, std::index_sequence_for<Ts...>{});
+}
+
+template<class... Ts
+        ,class = std::enable_if_t<(concepts::EqualityComparable<Ts> && ...)>>
+constexpr bool operator!=(const tuple<Ts...>& lhs, const tuple<Ts...>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+template<class... Ts
+        ,class = std::enable_if_t<(concepts::StrictTotallyOrdered<Ts> && ...)>>
+constexpr bool operator<(const tuple<Ts...>& lhs, const tuple<Ts...>& rhs)
+{
+    return detail::tuple_less(lhs, rhs, std::index_sequence_for<Ts...>{});
+}
+
+template<class... Ts
+        ,class = std::enable_if_t<(concepts::StrictTotallyOrdered<Ts> && ...)>>
+constexpr bool operator>(const tuple<Ts...>& lhs, const tuple<Ts...>& rhs)
+{
+    return rhs < lhs;
+}
+
+template<class... Ts
+        ,class = std::enable_if_t<(concepts::StrictTotallyOrdered<Ts> && ...)>>
+constexpr bool operator<=(const tuple<Ts...>& lhs, const tuple<Ts...>& rhs)
+{
+    return !(rhs < lhs);
+}
+
+template<class... Ts
+        ,class = std::enable_if_t<(concepts::StrictTotallyOrdered<Ts> && ...)>>
+constexpr bool operator>=(const tuple<Ts...>& lhs, const tuple<Ts...>& rhs)
+{
+    return !(lhs < rhs);
+}
+
+} // namespace utility
+
+/* --- Tuple protocol --- */
+// Structured bindings and std::tuple_size_v/std::tuple_element_t
+namespace std
+{
+template<class... Ts>
+struct tuple_size<utility::tuple<Ts...>>
+    : std::integral_constant<std::size_t, sizeof...(Ts)>
+{ };
+
+template<std::size_t I, class... Ts>
+struct tuple_element<I, utility::tuple<Ts...>>
+{
+    using type = typename decltype(utility::detail::element_type_of<I>(
+        std::declval<const utility::tuple<Ts...>&>()))::type;
+};
+
+} // namespace std
+
+/* --- Common reference --- */
+namespace traits
+{
+namespace detail
+{
+template<class Void, class T, class U
+        ,template<class> class TQual, template<class> class UQual>
+struct tuple_common_reference
+{ };
+
+template<class... Ts, class... Us
+        ,template<class> class TQual, template<class> class UQual>
+struct tuple_common_reference<
+    std::void_t<common_reference_t<TQual<Ts>, UQual<Us>>...>
+   ,utility::tuple<Ts...>, utility::tuple<Us...>, TQual, UQual>
+{
+    using type = utility::tuple<common_reference_t<TQual<Ts>, UQual<Us>>...>;
+};
+
+} // namespace detail
+
+/**
+ * The common reference of two tuples of the same size is the tuple of the
+ * common references of their elements, with the tuples' cv and reference
+ * qualifiers applied to the elements (as C++23 std::tuple). Tuples of
+ * different sizes, or with elements without a common reference, have none.
+ */
+template<class... Ts, class... Us
+        ,template<class> class TQual, template<class> class UQual>
+struct basic_common_reference<utility::tuple<Ts...>, utility::tuple<Us...>
+                             ,TQual, UQual>
+    : detail::tuple_common_reference<void
+                                    ,utility::tuple<Ts...>
+                                    ,utility::tuple<Us...>
+                                    ,TQual, UQual>
+{ };
+
+} // namespace traits
+
+#endif //DETAIL_TUPLE_H
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_TYPE_ID_H
+#define DETAIL_TYPE_ID_H
+
+#include <cstdint>
+#include <string_view>
+
+#include <conceptslib/detail/macros/platform_detection.hpp>
+
+namespace utility
+{
+/// Compile-time identifier of a type
+using type_id_t = std::uint64_t;
+
+namespace detail
+{
+// The signature names T, e.g. "... signature() [with T = int; ...]" on GCC
+template<class T>
+constexpr std::string_view signature() noexcept
+{
+    return FUNCTION_SIGNATURE;
+}
+
+// The text around the name of T in signature<T>() does not depend on T, so
+// its length is measured once with a known type
+constexpr std::size_t name_prefix = signature<int>().find("int");
+constexpr std::size_t name_suffix =
+    signature<int>().size() - name_prefix - std::string_view("int").size();
+
+// 64 bit FNV-1a hash
+constexpr type_id_t fnv1a(std::string_view s) noexcept
+{
+    type_id_t hash = 14695981039346656037ull;
+    for (char c: s) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+} // namespace detail
+
+/* --- Function type_name --- */
+/**
+ * Name of the type T, as spelled by the compiler, e.g. "int" or
+ * "std::basic_string_view<char>"
+ * @details Extracted at compile time from the signature of a function
+ * template, without RTTI. The spelling is specific to the compiler.
+ */
+template<class T>
+constexpr std::string_view type_name() noexcept
+{
+    constexpr std::string_view signature = detail::signature<T>();
+    return signature.substr(detail::name_prefix,
+                            signature.size() - detail::name_prefix -
+                            detail::name_suffix);
+}
+
+/* --- Variable template type_id_v --- */
+/**
+ * Identifier of the type T, a hash of its name
+ * @details A replacement for typeid(T) and std::type_index that needs no RTTI
+ * and is a constant expression, so it can key switch statements and constexpr
+ * tables. It is stable across translation units and builds by the same
+ * compiler, but not across compilers. Distinct types may in principle
+ * collide: \c type_registry rejects collisions at compile time.
+ */
+template<class T>
+inline constexpr type_id_t type_id_v = detail::fnv1a(type_name<T>());
+
+} // namespace utility
+
+#endif //DETAIL_TYPE_ID_H
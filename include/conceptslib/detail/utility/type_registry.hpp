@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_TYPE_REGISTRY_H
+#define DETAIL_TYPE_REGISTRY_H
+
+#include <array>
+#include <cstddef>
+
+#include <conceptslib/detail/utility/type_id.hpp>
+
+namespace utility
+{
+namespace detail
+{
+// Identifiers sorted in increasing order, with the position of each one in
+// the registered list
+template<std::size_t N>
+struct sorted_ids
+{
+    std::array<type_id_t, N> ids;
+    std::array<std::size_t, N> indices;
+};
+
+// Insertion sort, run at compile time
+template<std::size_t N>
+constexpr sorted_ids<N> sort_ids(const std::array<type_id_t, N>& ids)
+{
+    sorted_ids<N> sorted{};
+    for (std::size_t i = 0; i < N; ++i) {
+        std::size_t j = i;
+        for (; j > 0 && sorted.ids[j - 1] > ids[i]; --j) {
+            sorted.ids[j] = sorted.ids[j - 1];
+            sorted.indices[j] = sorted.indices[j - 1];
+        }
+        sorted.ids[j] = ids[i];
+        sorted.indices[j] = i;
+    }
+    return sorted;
+}
+
+template<std::size_t N>
+constexpr bool all_distinct(const std::array<type_id_t, N>& sorted)
+{
+    for (std::size_t i = 1; i < N; ++i) {
+        if (sorted[i - 1] == sorted[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace detail
+
+/* --- Class template type_registry --- */
+/**
+ * Compile-time set of the types Ts..., mapping a \c type_id_t to the position
+ * of its type in Ts...
+ * @details Replaces maps keyed by std::type_index: the identifiers are sorted
+ * at compile time and index_of is a branch-free binary search over a constexpr
+ * array, without hashing or RTTI. The position indexes a table of handlers
+ * for the registered types.
+ * @attention The types must be distinct, and their identifiers must not
+ * collide. Both are checked at compile time.
+ */
+template<class... Ts>
+class type_registry
+{
+    static constexpr std::size_t size_ = sizeof...(Ts);
+
+    static constexpr std::array<type_id_t, size_> ids_ = {{type_id_v<Ts>...}};
+
+    static constexpr detail::sorted_ids<size_> sorted_ =
+        detail::sort_ids(ids_);
+
+    static_assert(detail::all_distinct(sorted_.ids),
+                  "type_registry types must be distinct, with distinct ids");
+
+public:
+    /// Position returned for unregistered types
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    static constexpr std::size_t size() noexcept { return size_; }
+
+    /// Position of the type with identifier id in Ts..., or npos
+    static constexpr std::size_t index_of(type_id_t id) noexcept
+    {
+        if constexpr (size_ == 0) {
+            return npos;
+        } else {
+            // Last identifier not greater than id. The number of iterations
+            // is fixed, so the loop is unrolled and has no unpredictable
+            // branches.
+            std::size_t first = 0;
+            for (std::size_t n = size_; n > 1;) {
+                const std::size_t half = n / 2;
+                first = sorted_.ids[first + half] <= id ? first + half : first;
+                n -= half;
+            }
+            return sorted_.ids[first] == id ? sorted_.indices[first] : npos;
+        }
+    }
+
+    /// Position of T in Ts..., or npos
+    template<class T>
+    static constexpr std::size_t index_of() noexcept
+    {
+        return index_of(type_id_v<T>);
+    }
+
+    static constexpr bool contains(type_id_t id) noexcept
+    {
+        return index_of(id) != npos;
+    }
+
+    template<class T>
+    static constexpr bool contains() noexcept
+    {
+        return contains(type_id_v<T>);
+    }
+};
+
+} // namespace utility
+
+#endif //DETAIL_TYPE_REGISTRY_H
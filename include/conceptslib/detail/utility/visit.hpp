@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef DETAIL_VISIT_H
+#define DETAIL_VISIT_H
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include <conceptslib/detail/concepts/callable.hpp>
+#include <conceptslib/detail/functional/invoke.hpp>
+#include <conceptslib/detail/macros/platform_detection.hpp>
+#include <conceptslib/detail/type_traits/common_reference.hpp>
+
+namespace utility
+{
+namespace detail
+{
+template<class V>
+inline constexpr std::size_t variant_size_v =
+    std::variant_size_v<traits::remove_cvref_t<V>>;
+
+// Alternative I of the variant V, with the cv and reference qualifiers of V
+template<std::size_t I, class V>
+using alternative_t = decltype(std::get<I>(std::declval<V>()));
+
+[[noreturn]] inline void throw_bad_variant_access()
+{
+    throw std::bad_variant_access{};
+}
+
+// std::get<I>(v) when the dispatch already ensures that v holds alternative I.
+// Stating it lets the compiler drop the check std::get performs.
+template<std::size_t I, class V>
+constexpr decltype(auto) unchecked_get(V&& v)
+{
+    if (v.index() != I) {
+        UNREACHABLE();
+    }
+    return std::get<I>(std::forward<V>(v));
+}
+
+/* --- Flat slots --- */
+/**
+ * Every variant has one slot per alternative, plus slot 0 for the valueless
+ * state: slot i + 1 holds alternative i. The slots of several variants are
+ * numbered in row major order, so the flat slot of the variants' current
+ * state is computed without branches.
+ */
+template<class V>
+inline constexpr std::size_t slots_v = variant_size_v<V> + 1;
+
+template<class... Vs>
+inline constexpr std::size_t flat_slots_v =
+    (std::size_t{1} * ... * slots_v<Vs>);
+
+// Slot of variant J in the flat slot K
+template<std::size_t J, class... Vs>
+constexpr std::size_t slot(std::size_t k)
+{
+    constexpr std::size_t sizes[] = {slots_v<Vs>...};
+    std::size_t stride = 1;
+    for (std::size_t j = J + 1; j < sizeof...(Vs); ++j) {
+        stride *= sizes[j];
+    }
+    return k / stride % sizes[J];
+}
+
+// Flat slot of the variants' current alternatives. The index of a valueless
+// variant is variant_npos, which wraps around to slot 0.
+template<class... Vs>
+constexpr std::size_t flat_slot(const Vs&... vs)
+{
+    std::size_t k = 0;
+    ((k = k * slots_v<Vs> + (vs.index() + 1)), ...);
+    return k;
+}
+
+// Result of a valueless slot, which does not invoke the visitor
+struct no_result
+{ };
+
+/* --- Class template slot_visitor --- */
+// Invocation of the visitor F with the alternatives in the flat slot K
+template<std::size_t K, class Js, class F, class... Vs>
+struct slot_visitor_imp;
+
+template<std::size_t K, std::size_t... Js, class F, class... Vs>
+struct slot_visitor_imp<K, std::index_sequence<Js...>, F, Vs...>
+{
+    static constexpr bool valueless = ((slot<Js, Vs...>(K) == 0) || ...);
+
+    // Alternative of the variant J (or the valueless alternative 0)
+    template<std::size_t J>
+    static constexpr std::size_t alternative =
+        valueless ? 0 : slot<J, Vs...>(K) - 1;
+
+    static constexpr bool invocable =
+        valueless ||
+        concepts::Invocable<F, alternative_t<alternative<Js>, Vs>...>;
+
+    using result_t = std::conditional_t<
+        valueless,
+        no_result,
+        traits::detected_t<platform::invoke_result_t
+                          ,F, alternative_t<alternative<Js>, Vs>...>>;
+
+    template<class R>
+    static constexpr R dispatch(F&& f, Vs&&... vs)
+    {
+        if constexpr (valueless) {
+            throw_bad_variant_access();
+        } else {
+            return functional::invoke(
+                std::forward<F>(f),
+                unchecked_get<alternative<Js>>(std::forward<Vs>(vs))...);
+        }
+    }
+};
+
+template<std::size_t K, class F, class... Vs>
+using slot_visitor =
+    slot_visitor_imp<K, std::index_sequence_for<Vs...>, F, Vs...>;
+
+/* --- Distinct result types --- */
+template<class... Ts>
+struct type_set
+{ };
+
+template<class T>
+struct type_tag
+{ };
+
+// Add T to the set, unless it already contains it
+template<class... Ts, class T>
+auto operator+(type_set<Ts...>, type_tag<T>)
+    -> std::conditional_t<(std::is_same_v<Ts, T> || ...)
+                         ,type_set<Ts...>
+                         ,type_set<Ts..., T>>;
+
+// Valueless slots have no result
+template<class... Ts>
+auto operator+(type_set<Ts...>, type_tag<no_result>) -> type_set<Ts...>;
+
+template<class Set>
+struct common_reference_of;
+
+template<class... Ts>
+struct common_reference_of<type_set<Ts...>>
+{
+    using type = traits::detected_t<traits::common_reference_t, Ts...>;
+};
+
+/**
+ * Common reference of the types Ts..., computed over the distinct types only.
+ * Deduplicating first with a fold keeps the recursion depth of
+ * common_reference proportional to the number of distinct results, not to the
+ * number of combinations.
+ */
+template<class... Ts>
+using distinct_common_reference_t = typename common_reference_of<
+    decltype((type_set<>{} + ... + type_tag<Ts>{}))>::type;
+
+/* --- Visitation traits --- */
+template<class Ks, class F, class... Vs>
+struct visit_traits_imp;
+
+template<std::size_t... Ks, class F, class... Vs>
+struct visit_traits_imp<std::index_sequence<Ks...>, F, Vs...>
+{
+    static constexpr bool invocable =
+        (slot_visitor<Ks, F, Vs...>::invocable && ...);
+
+    // Every combination must be invocable for the result to be computed
+    using result_t = std::conditional_t<
+        invocable,
+        distinct_common_reference_t<
+            typename slot_visitor<Ks, F, Vs...>::result_t...>,
+        traits::nonesuch>;
+
+    template<class R>
+    using table_t = std::array<R (*)(F&&, Vs&&...), sizeof...(Ks)>;
+
+    template<class R>
+    static constexpr table_t<R> table = {{
+        &slot_visitor<Ks, F, Vs...>::template dispatch<R>...
+    }};
+};
+
+template<class F, class... Vs>
+using visit_traits = visit_traits_imp<
+    std::make_index_sequence<flat_slots_v<Vs...>>, F, Vs...>;
+
+template<class F, class... Vs>
+using visit_result_t = typename visit_traits<F, Vs...>::result_t;
+
+template<class V>
+inline constexpr bool is_variant_v = false;
+
+template<class... Ts>
+inline constexpr bool is_variant_v<std::variant<Ts...>> = true;
+
+template<class F, class... Vs>
+inline constexpr bool visitable_v =
+    sizeof...(Vs) > 0 &&
+    (is_variant_v<traits::remove_cvref_t<Vs>> && ...) &&
+    !std::is_same_v<traits::detected_t<visit_result_t, F, Vs...>
+                   ,traits::nonesuch>;
+
+/* --- Switch --- */
+// Number of cases of each switch
+constexpr std::size_t switch_cases = 8;
+
+template<std::size_t I, class R, class F, class V>
+constexpr R case_(F&& f, V&& v)
+{
+    if constexpr (I < variant_size_v<V>) {
+        return functional::invoke(std::forward<F>(f),
+                                  unchecked_get<I>(std::forward<V>(v)));
+    } else {
+        // The switch has more cases than alternatives: the index is never I.
+        // Saying so lets the compiler drop the case and emit a shorter switch.
+        UNREACHABLE();
+    }
+}
+
+/**
+ * Switch on the index of a single variant, whose cases the optimizer can
+ * inline, unlike calls through a table of function pointers. Each switch
+ * covers the alternatives [Offset, Offset + switch_cases); the default case
+ * continues with the next ones. A valueless variant, whose index is
+ * variant_npos, reaches the default case of the last switch.
+ */
+template<std::size_t Offset, class R, class F, class V>
+constexpr R switch_visit(F&& f, V&& v)
+{
+    switch (v.index() - Offset) {
+    case 0: return case_<Offset, R>(std::forward<F>(f), std::forward<V>(v));
+    case 1: return case_<Offset + 1, R>(std::forward<F>(f), std::forward<V>(v));
+    case 2: return case_<Offset + 2, R>(std::forward<F>(f), std::forward<V>(v));
+    case 3: return case_<Offset + 3, R>(std::forward<F>(f), std::forward<V>(v));
+    case 4: return case_<Offset + 4, R>(std::forward<F>(f), std::forward<V>(v));
+    case 5: return case_<Offset + 5, R>(std::forward<F>(f), std::forward<V>(v));
+    case 6: return case_<Offset + 6, R>(std::forward<F>(f), std::forward<V>(v));
+    case 7: return case_<Offset + 7, R>(std::forward<F>(f), std::forward<V>(v));
+    default:
+        if constexpr (Offset + switch_cases < variant_size_v<V>) {
+            return switch_visit<Offset + switch_cases, R>(std::forward<F>(f),
+                                                         std::forward<V>(v));
+        } else {
+            throw_bad_variant_access();
+        }
+    }
+}
+
+} // namespace detail
+
+/* --- Function visit --- */
+/**
+ * Apply the visitor f to the alternatives held by the variants vs...
+ * @details Equivalent to \c std::visit, but requires f to satisfy
+ * \c concepts::Invocable for every combination of alternatives and returns
+ * the \c traits::common_reference_t of the results of all combinations, so
+ * alternatives may return different types. A single variant is dispatched by
+ * a switch on its index. Several variants are dispatched by one indirect call
+ * through a flat constexpr table of function pointers, with an entry per
+ * combination of alternatives or valueless states.
+ * @throws std::bad_variant_access if any variant is valueless by exception.
+ */
+template<class F, class... Vs>
+constexpr auto visit(F&& f, Vs&&... vs)
+    -> std::enable_if_t<detail::visitable_v<F, Vs...>
+                       ,detail::visit_result_t<F, Vs...>>
+{
+    using R = detail::visit_result_t<F, Vs...>;
+
+    if constexpr (sizeof...(Vs) == 1) {
+        return detail::switch_visit<0, R>(std::forward<F>(f),
+                                          std::forward<Vs>(vs)...);
+    } else {
+        constexpr auto& table =
+            detail::visit_traits<F, Vs...>::template table<R>;
+        return table[detail::flat_slot(vs...)](std::forward<F>(f),
+                                               std::forward<Vs>(vs)...);
+    }
+}
+
+} // namespace utility
+
+#endif //DETAIL_VISIT_H
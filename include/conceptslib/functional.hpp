@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef FUNCTIONAL_H
+#define FUNCTIONAL_H
+
+#include <conceptslib/detail/functional/adaptors.hpp>
+#include <conceptslib/detail/functional/invoke.hpp>
+#include <conceptslib/detail/functional/memoize.hpp>
+
+#endif //FUNCTIONAL_H
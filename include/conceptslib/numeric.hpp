@@ -0,0 +1,15 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef NUMERIC_H
+#define NUMERIC_H
+
+#include <conceptslib/detail/numeric/simd.hpp>
+#include <conceptslib/detail/numeric/kernels.hpp>
+#include <conceptslib/detail/numeric/expression.hpp>
+
+#endif //NUMERIC_H
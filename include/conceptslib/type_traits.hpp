@@ -11,6 +11,7 @@
 
 #include <conceptslib/detail/type_traits/common_reference.hpp>
 #include <conceptslib/detail/type_traits/common_type.hpp>
+#include <conceptslib/detail/type_traits/list.hpp>
 #include <conceptslib/detail/type_traits/type_traits.hpp>
 
 #endif //TYPE_TRAITS_H
@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#ifndef UTILITY_H
+#define UTILITY_H
+
+#include <conceptslib/detail/utility/compact_optional.hpp>
+#include <conceptslib/detail/utility/make_table.hpp>
+#include <conceptslib/detail/utility/memberwise.hpp>
+#include <conceptslib/detail/utility/reflection.hpp>
+#include <conceptslib/detail/utility/router.hpp>
+#include <conceptslib/detail/utility/string_switch.hpp>
+#include <conceptslib/detail/utility/tuple.hpp>
+#include <conceptslib/detail/utility/type_id.hpp>
+#include <conceptslib/detail/utility/type_registry.hpp>
+#include <conceptslib/detail/utility/visit.hpp>
+
+#endif //UTILITY_H
@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <testing.hpp>
+
+#include <conceptslib/algorithm.hpp>
+
+namespace
+{
+template<class It, class Compare, class = void>
+constexpr bool can_parallel_sort = false;
+
+template<class It, class Compare>
+constexpr bool can_parallel_sort<It, Compare, std::void_t<decltype(
+    algorithm::parallel_sort(std::declval<It>(), std::declval<It>(),
+                             std::declval<Compare>()))>> = true;
+
+// Large enough to be sorted by sample sort
+constexpr std::size_t large = std::size_t{1} << 17;
+
+std::vector<int> random_values(std::size_t n, int max, unsigned seed = 42)
+{
+    std::mt19937 rng{seed};
+    std::uniform_int_distribution<int> dist{0, max};
+    std::vector<int> values(n);
+    for (int& value: values) {
+        value = dist(rng);
+    }
+    return values;
+}
+
+// Its moves may throw: sorted by std::sort
+struct ThrowingMove
+{
+    int value;
+
+    ThrowingMove(int v): value(v) { }
+    ThrowingMove(const ThrowingMove&) = default;
+    ThrowingMove(ThrowingMove&& other) noexcept(false): value(other.value) { }
+    ThrowingMove& operator=(const ThrowingMove&) = default;
+    ThrowingMove& operator=(ThrowingMove&& other) noexcept(false)
+    {
+        value = other.value;
+        return *this;
+    }
+
+    friend bool operator<(const ThrowingMove& lhs, const ThrowingMove& rhs)
+    {
+        return lhs.value < rhs.value;
+    }
+};
+
+} // namespace
+
+TEST(ThreadPool, RunsEveryIteration)
+{
+    algorithm::thread_pool pool(4);
+    EXPECT_EQ(pool.size(), 4u);
+
+    std::vector<std::atomic<int>> counts(1000);
+    for (int round = 0; round < 10; ++round) {
+        pool.parallel_for(counts.size(), [&counts](std::size_t i) {
+            ++counts[i];
+        });
+    }
+    for (const auto& count: counts) {
+        EXPECT_EQ(count.load(), 10);
+    }
+
+    pool.parallel_for(0, [](std::size_t) { throw std::logic_error("empty"); });
+    EXPECT_GE(algorithm::default_thread_pool().size(), 1u);
+}
+
+TEST(ThreadPool, RethrowsAfterEveryIteration)
+{
+    for (std::size_t threads: {1, 3}) {
+        algorithm::thread_pool pool(threads);
+        std::atomic<int> calls{0};
+        EXPECT_THROW(pool.parallel_for(100, [&calls](std::size_t i) {
+            ++calls;
+            if (i % 10 == 0) {
+                throw std::runtime_error("failed");
+            }
+        }), std::runtime_error);
+        EXPECT_EQ(calls.load(), 100);
+    }
+}
+
+TEST(ParallelSort, Constraints)
+{
+    using VectorIt = std::vector<int>::iterator;
+    using ListIt = std::list<int>::iterator;
+
+    EXPECT_TRUE(can_parallel_sort<VectorIt, std::less<>>);
+    EXPECT_TRUE((can_parallel_sort<std::unique_ptr<int>*,
+                                   std::less<std::unique_ptr<int>>>));
+    EXPECT_FALSE(can_parallel_sort<ListIt, std::less<>>);
+    EXPECT_FALSE((can_parallel_sort<VectorIt, std::negate<>>));
+}
+
+TEST(ParallelSort, SortsLikeStdSort)
+{
+    algorithm::thread_pool pool(4);
+    for (std::size_t n: {std::size_t{0}, std::size_t{1}, std::size_t{1000},
+                         large, 3 * large + 17}) {
+        std::vector<int> values = random_values(n, 1 << 30);
+        std::vector<int> expected = values;
+        std::sort(expected.begin(), expected.end());
+        algorithm::parallel_sort(pool, values.begin(), values.end());
+        EXPECT_TRUE(values == expected);
+    }
+}
+
+TEST(ParallelSort, ComparisonsAndDuplicates)
+{
+    algorithm::thread_pool pool(3);
+
+    // Few distinct values: most buckets are empty
+    std::vector<int> values = random_values(large, 3);
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end(), std::greater<>{});
+    algorithm::parallel_sort(pool, values.begin(), values.end(),
+                             std::greater<>{});
+    EXPECT_TRUE(values == expected);
+
+    // Already sorted, and reversed
+    std::vector<int> sorted(large);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::vector<int> reversed(sorted.rbegin(), sorted.rend());
+    algorithm::parallel_sort(pool, reversed.begin(), reversed.end());
+    EXPECT_TRUE(reversed == sorted);
+    algorithm::parallel_sort(pool, sorted.begin(), sorted.end());
+    EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+
+    // A generic lambda comparing part of the elements
+    std::vector<std::pair<int, int>> pairs(large);
+    for (std::size_t i = 0; i < large; ++i) {
+        pairs[i] = {static_cast<int>((i * 7919) % large), 0};
+    }
+    algorithm::parallel_sort(pool, pairs.begin(), pairs.end(),
+        [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    EXPECT_TRUE(std::is_sorted(pairs.begin(), pairs.end()));
+}
+
+TEST(ParallelSort, MoveOnlyAndStrings)
+{
+    algorithm::thread_pool pool(4);
+
+    std::vector<int> keys = random_values(large, 1 << 20);
+    std::vector<std::unique_ptr<int>> pointers;
+    for (int key: keys) {
+        pointers.push_back(std::make_unique<int>(key));
+    }
+    algorithm::parallel_sort(pool, pointers.begin(), pointers.end(),
+        [](const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) {
+            return *lhs < *rhs;
+        });
+    std::sort(keys.begin(), keys.end());
+    bool equal = true;
+    for (std::size_t i = 0; i < large; ++i) {
+        equal = equal && pointers[i] && *pointers[i] == keys[i];
+    }
+    EXPECT_TRUE(equal);
+
+    std::vector<std::string> strings;
+    for (int key: random_values(large, 1 << 20, 7)) {
+        strings.push_back("key" + std::to_string(key));
+    }
+    std::vector<std::string> expected = strings;
+    std::sort(expected.begin(), expected.end());
+    algorithm::parallel_sort(strings.begin(), strings.end());
+    EXPECT_TRUE(strings == expected);
+
+    std::vector<ThrowingMove> throwing(keys.rbegin(), keys.rend());
+    algorithm::parallel_sort(pool, throwing.begin(), throwing.end());
+    EXPECT_TRUE(std::is_sorted(throwing.begin(), throwing.end()));
+}
+
+TEST(ParallelSort, KeepsTheElementsWhenTheComparisonThrows)
+{
+    // The comparison throws while classifying, then while sorting the buckets
+    algorithm::thread_pool pool(4);
+    for (std::size_t limit: {large, 8 * large}) {
+        std::vector<int> values = random_values(large, 1 << 30);
+        std::vector<int> expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        std::atomic<std::size_t> calls{0};
+        EXPECT_THROW(algorithm::parallel_sort(pool, values.begin(),
+                                              values.end(),
+            [&calls, limit](int lhs, int rhs) {
+                if (++calls == limit) {
+                    throw std::runtime_error("comparison failed");
+                }
+                return lhs < rhs;
+            }), std::runtime_error);
+
+        std::sort(values.begin(), values.end());
+        EXPECT_TRUE(values == expected);
+    }
+}
+
+TEST(ParallelMerge, MergesLikeStdMerge)
+{
+    algorithm::thread_pool pool(4);
+    for (std::size_t n: {std::size_t{0}, std::size_t{100}, large}) {
+        std::vector<int> a = random_values(n, 1000, 1);
+        std::vector<int> b = random_values(n / 3 + 5, 1000, 2);
+        std::sort(a.begin(), a.end());
+        std::sort(b.begin(), b.end());
+
+        std::vector<int> expected;
+        std::merge(a.begin(), a.end(), b.begin(), b.end(),
+                   std::back_inserter(expected));
+        std::vector<int> merged(a.size() + b.size());
+        auto end = algorithm::parallel_merge(pool, a.begin(), a.end(),
+                                             b.begin(), b.end(),
+                                             merged.begin());
+        EXPECT_TRUE(end == merged.end());
+        EXPECT_TRUE(merged == expected);
+    }
+}
+
+TEST(ParallelMerge, IsStable)
+{
+    // Many equal keys: those of the first range must come first
+    algorithm::thread_pool pool(4);
+    std::vector<std::pair<int, int>> a(large);
+    std::vector<std::pair<int, int>> b(large);
+    for (std::size_t i = 0; i < large; ++i) {
+        a[i] = {static_cast<int>(i / 1000), 0};
+        b[i] = {static_cast<int>(i / 700), 1};
+    }
+    const auto by_key = [](const std::pair<int, int>& lhs,
+                           const std::pair<int, int>& rhs) {
+        return lhs.first < rhs.first;
+    };
+
+    std::vector<std::pair<int, int>> merged(2 * large);
+    algorithm::parallel_merge(pool, a.begin(), a.end(), b.begin(), b.end(),
+                              merged.begin(), by_key);
+    EXPECT_TRUE(std::is_sorted(merged.begin(), merged.end()));
+}
+
+TEST(ParallelMerge, MovesWithMoveIterators)
+{
+    std::vector<std::unique_ptr<int>> a;
+    std::vector<std::unique_ptr<int>> b;
+    for (int i = 0; i < 50000; ++i) {
+        a.push_back(std::make_unique<int>(2 * i));
+        b.push_back(std::make_unique<int>(2 * i + 1));
+    }
+    std::vector<std::unique_ptr<int>> merged(a.size() + b.size());
+    algorithm::thread_pool pool(2);
+    algorithm::parallel_merge(pool, std::make_move_iterator(a.begin()),
+        std::make_move_iterator(a.end()), std::make_move_iterator(b.begin()),
+        std::make_move_iterator(b.end()), merged.begin(),
+        [](const std::unique_ptr<int>& lhs, const std::unique_ptr<int>& rhs) {
+            return *lhs < *rhs;
+        });
+
+    bool consecutive = true;
+    for (std::size_t i = 0; i < merged.size(); ++i) {
+        consecutive = consecutive && *merged[i] == static_cast<int>(i);
+    }
+    EXPECT_TRUE(consecutive);
+}
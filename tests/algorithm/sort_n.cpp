@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <testing.hpp>
+
+#include <conceptslib/algorithm.hpp>
+
+namespace
+{
+template<class Compare, class T, class = void>
+constexpr bool can_sort = false;
+
+template<class Compare, class T>
+constexpr bool can_sort<Compare, T, std::void_t<decltype(
+    algorithm::sort_n(std::declval<T&>(), std::declval<Compare>()))>> = true;
+
+// A network sorts every input if it sorts every sequence of zeros and ones
+template<std::size_t N>
+bool sorts_zeros_and_ones()
+{
+    for (std::size_t bits = 0; bits < (std::size_t{1} << N); ++bits) {
+        std::array<int, N> values{};
+        for (std::size_t i = 0; i < N; ++i) {
+            values[i] = static_cast<int>((bits >> i) & 1);
+        }
+        algorithm::sort_n(values);
+        if (!std::is_sorted(values.begin(), values.end())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Random permutations of doubles, sorted in decreasing order
+template<std::size_t N>
+bool sorts_permutations(std::mt19937& rng)
+{
+    for (int round = 0; round < 100; ++round) {
+        std::array<double, N> values;
+        for (std::size_t i = 0; i < N; ++i) {
+            values[i] = static_cast<double>(i);
+        }
+        std::shuffle(values.begin(), values.end(), rng);
+        algorithm::sort_n(values, std::greater<>{});
+        if (!std::is_sorted(values.begin(), values.end(),
+                            std::greater<>{})) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<std::size_t... Ns>
+void expect_sorts_zeros_and_ones(std::index_sequence<Ns...>)
+{
+    const bool sorted[] = {sorts_zeros_and_ones<Ns>()...};
+    for (std::size_t n = 0; n < sizeof...(Ns); ++n) {
+        EXPECT_TRUE(sorted[n]) << "N = " << n;
+    }
+}
+
+template<std::size_t... Ns>
+void expect_sorts_permutations(std::index_sequence<Ns...>)
+{
+    std::mt19937 rng{7};
+    const bool sorted[] = {sorts_permutations<Ns + 17>(rng)...};
+    for (std::size_t n = 0; n < sizeof...(Ns); ++n) {
+        EXPECT_TRUE(sorted[n]) << "N = " << n + 17;
+    }
+}
+
+} // namespace
+
+TEST(AlgorithmSortN, Networks)
+{
+    using algorithm::detail::network_v;
+
+    // Size optimal networks up to 8 elements
+    CONCEPT_ASSERT(network_v<0>.size() == 0);
+    CONCEPT_ASSERT(network_v<1>.size() == 0);
+    CONCEPT_ASSERT(network_v<4>.size() == 5);
+    CONCEPT_ASSERT(network_v<8>.size() == 19);
+    CONCEPT_ASSERT(network_v<16>.size() == 63);
+
+    expect_sorts_zeros_and_ones(std::make_index_sequence<17>{});
+    expect_sorts_permutations(std::make_index_sequence<16>{});
+}
+
+TEST(AlgorithmSortN, Arrays)
+{
+    int c_array[5] = {5, 3, 1, 4, 2};
+    algorithm::sort_n(c_array);
+    EXPECT_TRUE(std::is_sorted(std::begin(c_array), std::end(c_array)));
+
+    std::array<unsigned char, 6> bytes = {6, 5, 4, 3, 2, 1};
+    algorithm::sort_n(bytes, std::less<unsigned char>{});
+    EXPECT_EQ(bytes, (std::array<unsigned char, 6>{1, 2, 3, 4, 5, 6}));
+
+    // First N elements of a longer range
+    std::array<int, 6> prefix = {3, 2, 1, 0, -1, -2};
+    algorithm::sort_n<3>(prefix.begin());
+    EXPECT_EQ(prefix, (std::array<int, 6>{1, 2, 3, 0, -1, -2}));
+}
+
+TEST(AlgorithmSortN, Comparisons)
+{
+    // Non trivially copyable elements are swapped
+    std::array<std::string, 4> words = {"pear", "fig", "apple", "kiwi"};
+    algorithm::sort_n(words);
+    EXPECT_EQ(words,
+              (std::array<std::string, 4>{"apple", "fig", "kiwi", "pear"}));
+
+    // Custom comparisons select without branches
+    std::array<std::pair<int, int>, 4> pairs = {{{2, 0}, {1, 1}, {3, 2},
+                                                 {0, 3}}};
+    algorithm::sort_n(pairs, [](const auto& l, const auto& r) {
+        return l.first < r.first;
+    });
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(pairs[i].first, i);
+    }
+
+    // Comparisons must be a StrictWeakOrder on the elements
+    CONCEPT_ASSERT(can_sort<std::less<>, std::array<int, 4>>);
+    CONCEPT_ASSERT(can_sort<std::less<>, int[4]>);
+    CONCEPT_ASSERT(!can_sort<std::less<>, std::array<std::less<>, 4>>);
+    CONCEPT_ASSERT(!can_sort<std::plus<>, std::array<std::string, 4>>);
+    CONCEPT_ASSERT(!can_sort<int, std::array<int, 4>>);
+}
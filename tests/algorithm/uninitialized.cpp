@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <testing.hpp>
+
+#include <conceptslib/algorithm.hpp>
+
+namespace
+{
+// Uninitialized storage for N objects of type T
+template<class T, std::size_t N>
+struct storage
+{
+    alignas(T) unsigned char bytes[N * sizeof(T)];
+
+    T* data() { return std::launder(reinterpret_cast<T*>(bytes)); }
+};
+
+// Its move constructor may throw, and its copy constructor throws on the
+// copy number limit
+struct Fragile
+{
+    static inline int copies = 0;
+    static inline int limit = -1;
+
+    std::string value;
+
+    explicit Fragile(std::string v): value{std::move(v)} { }
+
+    Fragile(const Fragile& other): value{other.value}
+    {
+        if (++copies == limit) {
+            throw std::runtime_error("copy failed");
+        }
+    }
+
+    Fragile(Fragile&& other) noexcept(false): value{std::move(other.value)}
+    { }
+};
+
+// Move-only, with a move constructor which throws on the move number limit
+struct MoveOnly
+{
+    static inline int moves = 0;
+    static inline int limit = -1;
+    static inline int live = 0;
+
+    std::string value;
+
+    explicit MoveOnly(std::string v): value{std::move(v)} { ++live; }
+
+    MoveOnly(const MoveOnly&) = delete;
+
+    MoveOnly(MoveOnly&& other) noexcept(false): value{std::move(other.value)}
+    {
+        if (++moves == limit) {
+            throw std::runtime_error("move failed");
+        }
+        ++live;
+    }
+
+    ~MoveOnly() { --live; }
+};
+
+// Its conversion to std::string throws on the conversion number limit
+struct Source
+{
+    static inline int conversions = 0;
+    static inline int limit = -1;
+
+    operator std::string() const
+    {
+        if (++conversions == limit) {
+            throw std::runtime_error("conversion failed");
+        }
+        return std::string(20, 's');
+    }
+};
+
+} // namespace
+
+TEST(Uninitialized, NothrowMovesWithoutRollback)
+{
+    using It = std::string*;
+    CONCEPT_ASSERT(noexcept(algorithm::uninitialized_relocate(
+        std::declval<It>(), std::declval<It>(), std::declval<It>())));
+    CONCEPT_ASSERT(!noexcept(algorithm::uninitialized_relocate(
+        std::declval<Fragile*>(), std::declval<Fragile*>(),
+        std::declval<Fragile*>())));
+
+    storage<std::string, 3> from;
+    storage<std::string, 3> to;
+    std::string* src = from.data();
+    for (int i = 0; i < 3; ++i) {
+        ::new (static_cast<void*>(src + i)) std::string(20, char('a' + i));
+    }
+    std::string* end = algorithm::uninitialized_relocate(src, src + 3,
+                                                         to.data());
+    EXPECT_EQ(end, to.data() + 3);
+    EXPECT_EQ(to.data()[2], std::string(20, 'c'));
+    std::destroy(to.data(), end);
+}
+
+TEST(Uninitialized, CopiesWithRollbackOtherwise)
+{
+    storage<Fragile, 4> from;
+    storage<Fragile, 4> to;
+    Fragile* src = from.data();
+    for (int i = 0; i < 4; ++i) {
+        ::new (static_cast<void*>(src + i)) Fragile(std::string(20, 'x'));
+    }
+
+    // The third copy throws: the sources are untouched
+    Fragile::copies = 0;
+    Fragile::limit = 3;
+    EXPECT_THROW(algorithm::uninitialized_relocate(src, src + 4, to.data()),
+                 std::runtime_error);
+    EXPECT_EQ(src[3].value, std::string(20, 'x'));
+
+    Fragile::copies = 0;
+    Fragile::limit = -1;
+    Fragile* end = algorithm::uninitialized_move_if_noexcept(src, src + 4,
+                                                             to.data());
+    EXPECT_EQ(Fragile::copies, 4);
+    EXPECT_EQ(src[0].value, std::string(20, 'x'));
+    std::destroy(to.data(), end);
+    std::destroy(src, src + 4);
+}
+
+TEST(Uninitialized, NoexceptFollowsTheConstruction)
+{
+    // A const source is copied, and a source of another type converted
+    CONCEPT_ASSERT(!noexcept(algorithm::uninitialized_move_if_noexcept(
+        std::declval<const std::string*>(), std::declval<const std::string*>(),
+        std::declval<std::string*>())));
+    CONCEPT_ASSERT(!noexcept(algorithm::uninitialized_move_if_noexcept(
+        std::declval<const char**>(), std::declval<const char**>(),
+        std::declval<std::string*>())));
+    CONCEPT_ASSERT(noexcept(algorithm::uninitialized_move_if_noexcept(
+        std::declval<std::string*>(), std::declval<std::string*>(),
+        std::declval<std::string*>())));
+
+    // A const source is copied
+    const std::string from[3] = {"a", "b", std::string(20, 'c')};
+    storage<std::string, 3> to;
+    std::string* end = algorithm::uninitialized_move_if_noexcept(
+        from, from + 3, to.data());
+    EXPECT_EQ(end[-1], std::string(20, 'c'));
+    EXPECT_EQ(from[2], std::string(20, 'c'));
+    std::destroy(to.data(), end);
+
+    // A conversion which throws is rolled back instead of terminating
+    Source sources[3];
+    Source::conversions = 0;
+    Source::limit = 2;
+    EXPECT_THROW(algorithm::uninitialized_move_if_noexcept(
+                     sources, sources + 3, to.data()),
+                 std::runtime_error);
+}
+
+TEST(Uninitialized, MoveOnlyElementsAreMoved)
+{
+    storage<MoveOnly, 3> from;
+    storage<MoveOnly, 3> to;
+    MoveOnly* src = from.data();
+    for (int i = 0; i < 3; ++i) {
+        ::new (static_cast<void*>(src + i)) MoveOnly(std::string(20, 'm'));
+    }
+
+    // The second move throws: the first element is moved from, and the
+    // constructed copy of it is destroyed
+    MoveOnly::moves = 0;
+    MoveOnly::limit = 2;
+    EXPECT_THROW(algorithm::uninitialized_move_if_noexcept(src, src + 3,
+                                                           to.data()),
+                 std::runtime_error);
+    EXPECT_EQ(MoveOnly::live, 3);
+    EXPECT_TRUE(src[0].value.empty());
+    EXPECT_EQ(src[2].value, std::string(20, 'm'));
+    std::destroy(src, src + 3);
+    EXPECT_EQ(MoveOnly::live, 0);
+}
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Codegen probe for the functional adaptors: calling an adaptor must compile
+ * to the same instructions as the equivalent direct call.
+ */
+#include <functional>
+
+#include <conceptslib/detail/functional/adaptors.hpp>
+
+struct Point
+{
+    int x;
+    int y;
+
+    int norm1() const;
+};
+
+struct Plus
+{
+    int operator()(int a, int b) const { return a + b; }
+};
+
+struct Negate
+{
+    int operator()(int a) const { return -a; }
+};
+
+int scale(int factor, int i);
+
+extern "C"
+{
+/* --- bind_front --- */
+int direct_bind_front(int a)
+{
+    return Plus{}(2, a);
+}
+
+int invoke_bind_front(int a)
+{
+    return functional::bind_front(Plus{}, 2)(a);
+}
+
+int direct_bind_front_function(int factor, int i)
+{
+    return scale(factor, i);
+}
+
+int invoke_bind_front_function(int factor, int i)
+{
+    return functional::bind_front(scale, factor)(i);
+}
+
+// The adaptor holds copies of the callable and the bound arguments. The copy
+// of p escapes to norm1, so the whole state is materialized on both sides.
+int direct_bind_front_member_function(const Point& p)
+{
+    struct
+    {
+        int (Point::*f)() const;
+        Point p;
+    } bound{&Point::norm1, p};
+    return (std::move(bound.p).*bound.f)();
+}
+
+int invoke_bind_front_member_function(const Point& p)
+{
+    return functional::bind_front(&Point::norm1, p)();
+}
+
+int direct_bind_front_reference(const Point& p)
+{
+    return p.norm1();
+}
+
+int invoke_bind_front_reference(const Point& p)
+{
+    return functional::bind_front(&Point::norm1, std::cref(p))();
+}
+
+/* --- compose --- */
+int direct_compose(int a, int b)
+{
+    return Negate{}(Plus{}(a, b));
+}
+
+int invoke_compose(int a, int b)
+{
+    return functional::compose(Negate{}, Plus{})(a, b);
+}
+
+int direct_compose_lambdas(int a)
+{
+    return (a + 1) * 3;
+}
+
+int invoke_compose_lambdas(int a)
+{
+    return functional::compose([](int x) { return x * 3; },
+                               [](int x) { return x + 1; })(a);
+}
+
+/* --- projected --- */
+int direct_projected(const Point& p, const Point& q)
+{
+    return Plus{}(p.x, q.x);
+}
+
+int invoke_projected(const Point& p, const Point& q)
+{
+    return functional::projected(Plus{}, &Point::x)(p, q);
+}
+
+/* --- Stored adaptors, called through a reference --- */
+int direct_stored(const Point& p, int a)
+{
+    return Negate{}(Plus{}(p.y, a));
+}
+
+int invoke_stored(const Point& p, int a)
+{
+    static constexpr auto f = functional::compose(
+        Negate{}, functional::bind_front(Plus{}, 0));
+    return f(functional::projected(Plus{}, &Point::y)(p, Point{0, a}));
+}
+
+} // extern "C"
@@ -0,0 +1,73 @@
+# Copyright (c) Nuno Alves de Sousa 2019
+#
+# Use, modification and distribution is subject to the Boost Software License,
+# Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+#
+# Codegen snapshot test: compiles SOURCE to assembly and checks that every
+# extern "C" function invoke_<path> has the same instructions as its twin
+# direct_<path>. Instructions are compared by mnemonic, plus the target of
+# calls and jumps, so register allocation noise such as swapped operands of a
+# commutative instruction is ignored, while a call through the library that
+# stops being inlined is not.
+#
+# Usage: cmake -DCOMPILER=<c++> -DFLAGS=<flags> -DSOURCE=<file>
+#              -DOUTPUT=<assembly> -P check_codegen.cmake
+cmake_minimum_required(VERSION 3.13)
+
+separate_arguments(FLAGS UNIX_COMMAND "${FLAGS}")
+execute_process(COMMAND ${COMPILER} ${FLAGS} -S ${SOURCE} -o ${OUTPUT}
+                RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Compiling ${SOURCE} failed")
+endif()
+
+# Collect the normalized instructions of every function in body_<name>
+file(STRINGS ${OUTPUT} lines)
+set(functions)
+set(current)
+foreach(line IN LISTS lines)
+    if(line MATCHES "^_?([A-Za-z_][A-Za-z0-9_]*):")
+        set(current ${CMAKE_MATCH_1})
+        list(APPEND functions ${current})
+        set(body_${current})
+    elseif(current AND line MATCHES "^[ \t]+\\.(cfi_endproc|size)")
+        set(current)
+    elseif(current AND NOT line MATCHES "^[ \t]*\\.")
+        string(REGEX REPLACE "\\.L[A-Za-z]*[0-9]+" ".L" line "${line}")
+        string(STRIP "${line}" line)
+        if(line MATCHES "^(call|jmp|b|bl)[a-z]*[ \t]")
+            string(REGEX REPLACE "[ \t]+" " " line "${line}")
+        else()
+            string(REGEX REPLACE "[ \t].*$" "" line "${line}")
+        endif()
+        list(APPEND body_${current} "${line}")
+    endif()
+endforeach()
+
+set(failures 0)
+set(checked 0)
+foreach(function IN LISTS functions)
+    if(NOT function MATCHES "^invoke_(.*)$")
+        continue()
+    endif()
+    set(direct direct_${CMAKE_MATCH_1})
+    if(NOT DEFINED body_${direct})
+        message(SEND_ERROR "${function}: missing twin ${direct}")
+        math(EXPR failures "${failures} + 1")
+    elseif(NOT body_${function} STREQUAL body_${direct})
+        string(REPLACE ";" "\n    " expected "${body_${direct}}")
+        string(REPLACE ";" "\n    " actual "${body_${function}}")
+        message(SEND_ERROR "${function} differs from ${direct}\n"
+                           "  expected:\n    ${expected}\n"
+                           "  actual:\n    ${actual}")
+        math(EXPR failures "${failures} + 1")
+    else()
+        message(STATUS "${function}: same code as ${direct}")
+    endif()
+    math(EXPR checked "${checked} + 1")
+endforeach()
+
+if(checked EQUAL 0)
+    message(FATAL_ERROR "No invoke_ functions found in ${OUTPUT}")
+endif()
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Codegen probe for functional::invoke. Every invoke_<path> function must
+ * compile to the same instructions as its direct_<path> twin, which performs
+ * the call without invoke: check_codegen.cmake compares them at -O2.
+ *
+ * The callees are only declared, so the twins of the function and member
+ * function paths are a single direct call: GCC resolves a constant pointer to
+ * member function only after inlining, too late to inline its target, through
+ * invoke and std::invoke alike.
+ */
+#include <functional>
+
+#include <conceptslib/detail/functional/invoke.hpp>
+
+struct Widget
+{
+    int value;
+
+    int get(int i) const;
+};
+
+struct Add
+{
+    int operator()(int a, int b) const { return a + b; }
+};
+
+int free_function(int i);
+
+extern "C"
+{
+/* --- Function pointer --- */
+int direct_function_pointer(int (*f)(int), int i)
+{
+    return f(i);
+}
+
+int invoke_function_pointer(int (*f)(int), int i)
+{
+    return functional::invoke(f, i);
+}
+
+/* --- Function --- */
+int direct_function(int i)
+{
+    return free_function(i);
+}
+
+int invoke_function(int i)
+{
+    return functional::invoke(free_function, i);
+}
+
+/* --- Lambda --- */
+int direct_lambda(int a, int b)
+{
+    auto f = [b](int x) { return x * b; };
+    return f(a);
+}
+
+int invoke_lambda(int a, int b)
+{
+    auto f = [b](int x) { return x * b; };
+    return functional::invoke(f, a);
+}
+
+/* --- Function object --- */
+int direct_function_object(int a, int b)
+{
+    return Add{}(a, b);
+}
+
+int invoke_function_object(int a, int b)
+{
+    return functional::invoke(Add{}, a, b);
+}
+
+/* --- Pointer to member function --- */
+int direct_member_function_object(const Widget& w, int i)
+{
+    return w.get(i);
+}
+
+int invoke_member_function_object(const Widget& w, int i)
+{
+    return functional::invoke(&Widget::get, w, i);
+}
+
+int direct_member_function_pointer(const Widget* w, int i)
+{
+    return w->get(i);
+}
+
+int invoke_member_function_pointer(const Widget* w, int i)
+{
+    return functional::invoke(&Widget::get, w, i);
+}
+
+int direct_member_function_reference_wrapper(const Widget& w, int i)
+{
+    return w.get(i);
+}
+
+int invoke_member_function_reference_wrapper(const Widget& w, int i)
+{
+    return functional::invoke(&Widget::get, std::cref(w), i);
+}
+
+int direct_member_function_runtime(int (Widget::*f)(int) const,
+                                   const Widget& w, int i)
+{
+    return (w.*f)(i);
+}
+
+int invoke_member_function_runtime(int (Widget::*f)(int) const,
+                                   const Widget& w, int i)
+{
+    return functional::invoke(f, w, i);
+}
+
+/* --- Pointer to data member --- */
+int direct_member_data_object(const Widget& w)
+{
+    return w.value;
+}
+
+int invoke_member_data_object(const Widget& w)
+{
+    return functional::invoke(&Widget::value, w);
+}
+
+int direct_member_data_pointer(const Widget* w)
+{
+    return w->value;
+}
+
+int invoke_member_data_pointer(const Widget* w)
+{
+    return functional::invoke(&Widget::value, w);
+}
+
+int direct_member_data_reference_wrapper(const Widget& w)
+{
+    return w.value;
+}
+
+int invoke_member_data_reference_wrapper(const Widget& w)
+{
+    return functional::invoke(&Widget::value, std::cref(w));
+}
+
+} // extern "C"
@@ -0,0 +1,19 @@
+# Copyright (c) Nuno Alves de Sousa 2019
+#
+# Use, modification and distribution is subject to the Boost Software License,
+# Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+#
+# Compile budgets of the probes, as printed by check_budget.cmake. GCC
+# instantiation costs are in kB, Clang ones are counts of the instantiations of
+# conceptslib entities. Measured with GCC 12 and Clang 14.
+
+set(budget_regular_gcc_instantiations 231424)
+set(budget_regular_gcc_frontend_ms 2460)
+set(budget_regular_clang_instantiations 2613)
+set(budget_regular_clang_frontend_ms 1776)
+
+set(budget_common_reference_gcc_instantiations 52224)
+set(budget_common_reference_gcc_frontend_ms 720)
+set(budget_common_reference_clang_instantiations 1400)
+set(budget_common_reference_clang_frontend_ms 428)
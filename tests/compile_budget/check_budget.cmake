@@ -0,0 +1,131 @@
+# Copyright (c) Nuno Alves de Sousa 2019
+#
+# Use, modification and distribution is subject to the Boost Software License,
+# Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+#
+# Compile budget test: compiles the probe SOURCE RUNS times and fails when its
+# template instantiation cost or its front-end time exceed the budget NAME of
+# BASELINE by more than INSTANTIATION_TOLERANCE and TIME_TOLERANCE percent.
+#
+# Clang is run with -ftime-trace: the instantiation cost is the number of
+# InstantiateClass and InstantiateFunction events of the trace whose entity
+# belongs to a namespace of conceptslib (NAMESPACES), so that the standard
+# library instantiations do not hide those of the library, and the front-end
+# time is the duration of its Total Frontend event. GCC has no
+# instantiation count, so it is run with -ftime-report: the instantiation cost
+# is the memory, in kB, allocated by template instantiation, which is as
+# deterministic, and the front-end time is the user time of the compilation.
+# Times are the fastest of the RUNS compilations. A compiler with no budget in
+# BASELINE fails the test: the script prints the lines to add.
+#
+# Usage: cmake -DCOMPILER=<c++> -DCOMPILER_ID=<GNU|Clang> -DFLAGS=<flags>
+#              -DSOURCE=<file> -DOUTPUT=<object> -DNAME=<budget>
+#              -DBASELINE=<file> [-DRUNS=<n>] [-DINSTANTIATION_TOLERANCE=<%>]
+#              [-DTIME_TOLERANCE=<%>] [-DNAMESPACES=<list>]
+#              -P check_budget.cmake
+cmake_minimum_required(VERSION 3.13)
+
+if(NOT DEFINED RUNS)
+    set(RUNS 3)
+endif()
+if(NOT DEFINED INSTANTIATION_TOLERANCE)
+    set(INSTANTIATION_TOLERANCE 10)
+endif()
+if(NOT DEFINED TIME_TOLERANCE)
+    set(TIME_TOLERANCE 100)
+endif()
+if(NOT DEFINED NAMESPACES)
+    set(NAMESPACES traits concepts containers utility functional algorithm
+                   numeric)
+endif()
+
+if(COMPILER_ID MATCHES "Clang")
+    set(key clang)
+    set(measure_flags -c -o ${OUTPUT} -ftime-trace
+                      -ftime-trace-granularity=0)
+elseif(COMPILER_ID STREQUAL "GNU")
+    set(key gcc)
+    set(measure_flags -fsyntax-only -ftime-report)
+else()
+    message(FATAL_ERROR "No compile budget for ${COMPILER_ID}")
+endif()
+
+# Convert a GCC -ftime-report memory column such as 512, 7337k or 37M to kB
+function(to_kilobytes amount out)
+    if(amount MATCHES "^([0-9]+)M$")
+        math(EXPR amount "${CMAKE_MATCH_1} * 1024")
+    elseif(amount MATCHES "^([0-9]+)k$")
+        set(amount ${CMAKE_MATCH_1})
+    else()
+        math(EXPR amount "${amount} / 1024")
+    endif()
+    set(${out} ${amount} PARENT_SCOPE)
+endfunction()
+
+separate_arguments(FLAGS UNIX_COMMAND "${FLAGS}")
+string(REPLACE ";" "|" namespaces "${NAMESPACES}")
+set(instantiations)
+set(frontend_ms)
+foreach(run RANGE 1 ${RUNS})
+    execute_process(COMMAND ${COMPILER} ${FLAGS} ${measure_flags} ${SOURCE}
+                    RESULT_VARIABLE result
+                    ERROR_VARIABLE report)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Compiling ${SOURCE} failed:\n${report}")
+    endif()
+
+    if(key STREQUAL "clang")
+        get_filename_component(directory ${OUTPUT} DIRECTORY)
+        get_filename_component(stem ${OUTPUT} NAME_WE)
+        file(READ ${directory}/${stem}.json report)
+        string(REGEX MATCHALL "\"name\":\"Instantiate(Class|Function)\",\
+\"args\":{\"detail\":\"(${namespaces})::" events "${report}")
+        list(LENGTH events count)
+        if(NOT report MATCHES
+               "\"dur\":([0-9]+),\"name\":\"Total Frontend\"")
+            message(FATAL_ERROR "No Total Frontend event in the time trace")
+        endif()
+        math(EXPR ms "${CMAKE_MATCH_1} / 1000")
+    else()
+        if(NOT report MATCHES
+               "template instantiation[ \t]*:[^\n]*[ \t]([0-9]+[kM]?) \\(")
+            message(FATAL_ERROR "No template instantiation in:\n${report}")
+        endif()
+        to_kilobytes(${CMAKE_MATCH_1} count)
+        if(NOT report MATCHES "TOTAL[ \t]*:[ \t]*([0-9]+)\\.([0-9]+)")
+            message(FATAL_ERROR "No TOTAL in:\n${report}")
+        endif()
+        math(EXPR ms "${CMAKE_MATCH_1} * 1000 + ${CMAKE_MATCH_2} * 10")
+    endif()
+
+    set(instantiations ${count})
+    if(NOT frontend_ms OR ms LESS frontend_ms)
+        set(frontend_ms ${ms})
+    endif()
+endforeach()
+
+set(budget ${NAME}_${key})
+message(STATUS "Measured, to update ${BASELINE}:\n"
+               "set(${budget}_instantiations ${instantiations})\n"
+               "set(${budget}_frontend_ms ${frontend_ms})")
+
+include(${BASELINE})
+if(NOT DEFINED ${budget}_instantiations OR NOT DEFINED ${budget}_frontend_ms)
+    message(FATAL_ERROR "No ${budget} budget in ${BASELINE}")
+endif()
+
+math(EXPR max_instantiations
+     "${${budget}_instantiations} * (100 + ${INSTANTIATION_TOLERANCE}) / 100")
+math(EXPR max_frontend_ms
+     "${${budget}_frontend_ms} * (100 + ${TIME_TOLERANCE}) / 100")
+if(instantiations GREATER max_instantiations)
+    message(SEND_ERROR "Instantiation cost ${instantiations} exceeds the "
+                       "budget ${${budget}_instantiations} by more than "
+                       "${INSTANTIATION_TOLERANCE}%")
+endif()
+if(frontend_ms GREATER max_frontend_ms)
+    message(SEND_ERROR "Front-end time ${frontend_ms} ms exceeds the budget "
+                       "${${budget}_frontend_ms} ms by more than "
+                       "${TIME_TOLERANCE}%")
+endif()
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Compile budget probe: 100 checks of concepts::CommonReference between
+ * proxy references and references to their values, whose common reference is
+ * given by basic_common_reference. check_budget.cmake compares the cost of
+ * compiling this file with baseline.cmake.
+ */
+#include <cstddef>
+#include <utility>
+
+#include <conceptslib/concepts.hpp>
+
+template<std::size_t N>
+struct Value
+{
+    int v;
+};
+
+template<std::size_t N>
+struct Proxy
+{
+    int* v;
+
+    operator Value<N>() const { return {*v}; }
+};
+
+namespace traits
+{
+template<std::size_t N
+        ,template<class> class TQual, template<class> class UQual>
+struct basic_common_reference<Proxy<N>, Value<N>, TQual, UQual>
+{
+    using type = Value<N>;
+};
+
+template<std::size_t N
+        ,template<class> class TQual, template<class> class UQual>
+struct basic_common_reference<Value<N>, Proxy<N>, TQual, UQual>
+{
+    using type = Value<N>;
+};
+
+} // namespace traits
+
+template<std::size_t... I>
+constexpr bool all_common_references(std::index_sequence<I...>)
+{
+    return (concepts::CommonReference<Proxy<I>, const Value<I>&> && ...);
+}
+
+static_assert(all_common_references(std::make_index_sequence<100>{}));
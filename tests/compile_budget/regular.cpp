@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Compile budget probe: 200 checks of concepts::Regular, over distinct types
+ * so that none of them is memoized by the compiler. check_budget.cmake
+ * compares the cost of compiling this file with baseline.cmake.
+ */
+#include <cstddef>
+#include <utility>
+
+#include <conceptslib/concepts.hpp>
+
+template<std::size_t N>
+struct Value
+{
+    int v;
+
+    friend bool operator==(const Value& a, const Value& b)
+    { return a.v == b.v; }
+    friend bool operator!=(const Value& a, const Value& b)
+    { return a.v != b.v; }
+};
+
+// Semiregular, but not equality comparable
+template<std::size_t N>
+struct Handle
+{
+    int v;
+};
+
+template<std::size_t... I>
+constexpr std::size_t count_regular(std::index_sequence<I...>)
+{
+    return ((concepts::Regular<Value<I>> ? 1 : 0) + ...) +
+           ((concepts::Regular<Handle<I>> ? 1 : 0) + ...);
+}
+
+static_assert(count_regular(std::make_index_sequence<100>{}) == 100);
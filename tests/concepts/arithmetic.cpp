@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <string>
+#include <complex>
+
+#include <testing.hpp>
+
+#include <conceptslib/concepts.hpp>
+
+class ArithmeticConcepts: public ::testing::Test
+{
+protected:
+    // Value based version of the Double wrapper in .old/non_std_numerics.hpp
+    struct Double
+    {
+        double value;
+
+        Double& operator+=(const Double& d) { value += d.value; return *this; }
+        Double& operator-=(const Double& d) { value -= d.value; return *this; }
+        Double& operator*=(const Double& d) { value *= d.value; return *this; }
+        Double& operator/=(const Double& d) { value /= d.value; return *this; }
+
+        friend Double operator+(Double l, const Double& r) { return l += r; }
+        friend Double operator-(Double l, const Double& r) { return l -= r; }
+        friend Double operator*(Double l, const Double& r) { return l *= r; }
+        friend Double operator/(Double l, const Double& r) { return l /= r; }
+    };
+
+    // Only the compound assignment operators
+    struct CompoundOnly
+    {
+        CompoundOnly& operator+=(const CompoundOnly&);
+        CompoundOnly& operator-=(const CompoundOnly&);
+        CompoundOnly& operator*=(const CompoundOnly&);
+    };
+
+    // Note: operator+=() does not yield an lvalue referring to the left operand
+    struct OddCompound
+    {
+        OddCompound operator+=(const OddCompound&);
+        OddCompound& operator-=(const OddCompound&);
+        OddCompound& operator*=(const OddCompound&);
+
+        friend OddCompound operator+(const OddCompound&, const OddCompound&);
+        friend OddCompound operator-(const OddCompound&, const OddCompound&);
+        friend OddCompound operator*(const OddCompound&, const OddCompound&);
+    };
+
+    struct NoDefault
+    {
+        NoDefault(int);
+        NoDefault& operator+=(const NoDefault&);
+        NoDefault& operator-=(const NoDefault&);
+        NoDefault& operator*=(const NoDefault&);
+
+        friend NoDefault operator+(const NoDefault&, const NoDefault&);
+        friend NoDefault operator-(const NoDefault&, const NoDefault&);
+        friend NoDefault operator*(const NoDefault&, const NoDefault&);
+    };
+};
+
+/* --- Concept Arithmetic --- */
+TEST_F(ArithmeticConcepts, ConceptArithmetic)
+{
+    using concepts::Arithmetic;
+
+    CONCEPT_ASSERT(Arithmetic<int>);
+    CONCEPT_ASSERT(Arithmetic<char>);
+    CONCEPT_ASSERT(Arithmetic<unsigned long>);
+    CONCEPT_ASSERT(Arithmetic<float>);
+    CONCEPT_ASSERT(Arithmetic<double>);
+    CONCEPT_ASSERT(Arithmetic<std::complex<double>>);
+
+    CONCEPT_ASSERT(!Arithmetic<void>);
+    CONCEPT_ASSERT(!Arithmetic<int&>);
+    CONCEPT_ASSERT(!Arithmetic<const int>);
+    CONCEPT_ASSERT(!Arithmetic<int*>);
+    CONCEPT_ASSERT(!Arithmetic<std::string>);
+
+    CONCEPT_ASSERT(Arithmetic<Double>);
+    CONCEPT_ASSERT(!Arithmetic<CompoundOnly>);
+    CONCEPT_ASSERT(!Arithmetic<OddCompound>);
+    CONCEPT_ASSERT(!Arithmetic<NoDefault>);
+}
+
+/* --- Concept Field --- */
+TEST_F(ArithmeticConcepts, ConceptField)
+{
+    using concepts::Field;
+
+    CONCEPT_ASSERT(Field<float>);
+    CONCEPT_ASSERT(Field<double>);
+    CONCEPT_ASSERT(Field<std::complex<double>>);
+    CONCEPT_ASSERT(Field<int>); // Syntactically
+
+    CONCEPT_ASSERT(!Field<void>);
+    CONCEPT_ASSERT(!Field<double&>);
+    CONCEPT_ASSERT(!Field<std::string>);
+
+    CONCEPT_ASSERT(Field<Double>);
+    CONCEPT_ASSERT(!Field<CompoundOnly>);
+    CONCEPT_ASSERT(!Field<OddCompound>);
+}
@@ -85,6 +85,41 @@ TEST(CallableConcepts, ConceptInvocable)
     CONCEPT_ASSERT(Invocable<decltype(genericLambdaByRef), int&>);
 }
 
+/* --- Concept NothrowInvocable --- */
+void nothrow_increment(int& i) noexcept { ++i; }
+
+TEST(CallableConcepts, ConceptNothrowInvocable)
+{
+    using concepts::NothrowInvocable;
+
+    struct X
+    {
+        int intMember;
+        void memberFunction(int&) noexcept;
+        void throwingMemberFunction(int&);
+    };
+
+    struct Overloaded
+    {
+        void operator()(int) noexcept;
+        void operator()(double);
+    };
+
+    CONCEPT_ASSERT(NothrowInvocable<decltype(nothrow_increment), int&>);
+    CONCEPT_ASSERT(!NothrowInvocable<decltype(nothrow_increment), int>);
+    CONCEPT_ASSERT(!NothrowInvocable<decltype(increment), int&>);
+
+    CONCEPT_ASSERT(NothrowInvocable<decltype(&X::intMember), X&>);
+    CONCEPT_ASSERT(NothrowInvocable<decltype(&X::memberFunction), X, int&>);
+    CONCEPT_ASSERT(!NothrowInvocable<decltype(&X::throwingMemberFunction)
+                                    ,X, int&>);
+
+    CONCEPT_ASSERT(NothrowInvocable<Overloaded, int>);
+    CONCEPT_ASSERT(!NothrowInvocable<Overloaded, double>);
+    CONCEPT_ASSERT(!NothrowInvocable<decltype(lambd2), int&>);
+    CONCEPT_ASSERT(!NothrowInvocable<void, void>);
+}
+
 /* --- Concept Predicate --- */
 bool pred(int, const std::string&);
 bool oddPred(int, std::string&);
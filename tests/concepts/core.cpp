@@ -467,6 +467,27 @@ TEST_F(CoreLanguageConcepts, ConceptSwappable)
     CONCEPT_ASSERT(!SwappableWith<int&, const int&>);
 }
 
+/* --- Concept NothrowSwappable --- */
+TEST_F(CoreLanguageConcepts, ConceptNothrowSwappable)
+{
+    using concepts::NothrowSwappable;
+
+    struct ThrowingMove
+    {
+        ThrowingMove(ThrowingMove&&) noexcept(false);
+        ThrowingMove& operator=(ThrowingMove&&) noexcept(false);
+    };
+
+    CONCEPT_ASSERT(NothrowSwappable<int>);
+    CONCEPT_ASSERT(NothrowSwappable<std::string>);
+    CONCEPT_ASSERT(NothrowSwappable<std::unique_ptr<int>>);
+    CONCEPT_ASSERT(NothrowSwappable<Base>);
+    CONCEPT_ASSERT(NothrowSwappable<int&>);
+
+    CONCEPT_ASSERT(!NothrowSwappable<void>);
+    CONCEPT_ASSERT(!NothrowSwappable<ThrowingMove>);
+}
+
 /* --- Concept Destructible --- */
 TEST_F(CoreLanguageConcepts, ConceptDestructible)
 {
@@ -542,6 +563,26 @@ TEST_F(CoreLanguageConcepts, ConceptMoveMoveConstructible)
     CONCEPT_ASSERT(!MoveConstructible<NoMoveNoCopy>);
 }
 
+/* --- Concept NothrowMoveConstructible --- */
+TEST_F(CoreLanguageConcepts, ConceptNothrowMoveConstructible)
+{
+    using concepts::NothrowMoveConstructible;
+
+    struct ThrowingMove { ThrowingMove(ThrowingMove&&) noexcept(false); };
+    struct CopyOnly { CopyOnly(const CopyOnly&); };
+
+    CONCEPT_ASSERT(NothrowMoveConstructible<int>);
+    CONCEPT_ASSERT(NothrowMoveConstructible<Base>);
+    CONCEPT_ASSERT(NothrowMoveConstructible<std::string>);
+    CONCEPT_ASSERT(NothrowMoveConstructible<std::unique_ptr<int>>);
+    CONCEPT_ASSERT(NothrowMoveConstructible<int&>);
+
+    CONCEPT_ASSERT(!NothrowMoveConstructible<ThrowingMove>);
+    CONCEPT_ASSERT(!NothrowMoveConstructible<CopyOnly>);
+    CONCEPT_ASSERT(!NothrowMoveConstructible<NoMove>);
+    CONCEPT_ASSERT(!NothrowMoveConstructible<void>);
+}
+
 /* --- Concept CopyConstructible --- */
 TEST_F(CoreLanguageConcepts, ConceptCopyConstructible)
 {
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <testing.hpp>
+
+#include <conceptslib/concepts.hpp>
+#include <conceptslib/containers.hpp>
+
+class HashingConcepts: public ::testing::Test
+{
+protected:
+    struct NotHashable { };
+
+    // Hashes ints, and the types which convert to int
+    struct IntHash
+    {
+        std::size_t operator()(int) const;
+    };
+
+    struct MutableHash
+    {
+        std::size_t operator()(int);
+    };
+
+    struct ReturnsPointer
+    {
+        const void* operator()(int) const;
+    };
+};
+
+/* --- Concept Hashable --- */
+TEST_F(HashingConcepts, ConceptHashable)
+{
+    using concepts::Hashable;
+
+    CONCEPT_ASSERT(Hashable<int>);
+    CONCEPT_ASSERT(Hashable<std::string>);
+    CONCEPT_ASSERT(Hashable<int*>);
+    CONCEPT_ASSERT(Hashable<int, IntHash>);
+    CONCEPT_ASSERT(Hashable<long, IntHash>);
+
+    CONCEPT_ASSERT(!Hashable<NotHashable>);
+    CONCEPT_ASSERT(!Hashable<std::vector<int>>);
+    CONCEPT_ASSERT(!Hashable<std::string, IntHash>);
+    CONCEPT_ASSERT(!Hashable<int, MutableHash>);
+    CONCEPT_ASSERT(!Hashable<int, ReturnsPointer>);
+}
+
+/* --- Concept HashableWith --- */
+TEST_F(HashingConcepts, ConceptHashableWith)
+{
+    using concepts::HashableWith;
+    using string_hash = containers::hash<std::string>;
+
+    CONCEPT_ASSERT(HashableWith<std::string, std::string_view, string_hash>);
+    CONCEPT_ASSERT(HashableWith<std::string, const char*, string_hash>);
+    CONCEPT_ASSERT(HashableWith<int, long, IntHash>);
+    CONCEPT_ASSERT(HashableWith<std::string, std::string_view
+                               ,std::hash<std::string_view>>);
+
+    // Mixed comparisons are required
+    CONCEPT_ASSERT(!HashableWith<std::string, int, string_hash>);
+    CONCEPT_ASSERT(!HashableWith<int, NotHashable, IntHash>);
+    // std::hash<std::string> does not hash string views
+    CONCEPT_ASSERT(!HashableWith<std::string, std::string_view
+                                ,std::hash<std::string>>);
+
+    // Equal strings and string views have equal hash values
+    const std::string word = "concepts";
+    EXPECT_EQ(string_hash{}(word), string_hash{}(std::string_view(word)));
+    EXPECT_EQ(string_hash{}(word), std::hash<std::string>{}(word));
+}
@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Minimal in-tree test harness: the subset of the Google Test interface used by
+ * the tests, so that they build without downloading anything. Tests register
+ * themselves with TEST, TEST_F and TYPED_TEST, and RUN_ALL_TESTS runs those
+ * which match --gtest_filter, printing their failures as Google Test does.
+ */
+#ifndef TESTING_HARNESS_H
+#define TESTING_HARNESS_H
+
+#include <cstddef>
+#include <cstdio>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace testing
+{
+/// Base class of the tests and of their fixtures
+class Test
+{
+public:
+    virtual ~Test() = default;
+
+    virtual void SetUp() { }
+    virtual void TearDown() { }
+    virtual void TestBody() = 0;
+};
+
+/// List of the types of a typed test suite
+template<class... Ts>
+struct Types { };
+
+namespace detail
+{
+/* --- Registry --- */
+struct test_info
+{
+    std::string name;
+    std::function<std::unique_ptr<Test>()> make;
+};
+
+inline std::vector<test_info>& registry()
+{
+    static std::vector<test_info> tests;
+    return tests;
+}
+
+inline bool register_test(std::string name,
+                          std::function<std::unique_ptr<Test>()> make)
+{
+    registry().push_back({std::move(name), std::move(make)});
+    return true;
+}
+
+template<template<class> class TestT, class... Ts>
+bool register_typed_test(const char* suite, const char* name, Types<Ts...>)
+{
+    std::size_t index = 0;
+    (register_test(std::string(suite) + "/" + std::to_string(index++) + "." +
+                       name,
+                   [] { return std::unique_ptr<Test>(new TestT<Ts>()); }),
+     ...);
+    return true;
+}
+
+/// Whether the current test has failed
+inline bool& current_failed()
+{
+    static bool failed = false;
+    return failed;
+}
+
+inline std::string& filter()
+{
+    static std::string pattern = "*";
+    return pattern;
+}
+
+/* --- Failure reports --- */
+/// Result of an assertion, and the explanation of its failure
+struct assertion_result
+{
+    bool success;
+    std::string message;
+
+    explicit operator bool() const noexcept { return success; }
+};
+
+/// Message streamed after a failed assertion
+class message
+{
+public:
+    template<class T>
+    message& operator<<(const T& value)
+    {
+        out_ << value;
+        return *this;
+    }
+
+    std::string str() const { return out_.str(); }
+
+private:
+    std::ostringstream out_;
+};
+
+/// Reports a failure when it is assigned the message streamed after it
+class failure
+{
+public:
+    failure(const char* file, int line, std::string explanation)
+        : file_(file), line_(line), explanation_(std::move(explanation))
+    { }
+
+    void operator=(const message& user) const
+    {
+        current_failed() = true;
+        std::printf("%s:%d: Failure\n%s\n", file_, line_,
+                    explanation_.c_str());
+        if (!user.str().empty()) {
+            std::printf("%s\n", user.str().c_str());
+        }
+    }
+
+private:
+    const char* file_;
+    int line_;
+    std::string explanation_;
+};
+
+/* --- Comparisons --- */
+template<class T, class = void>
+constexpr bool printable = false;
+
+template<class T>
+constexpr bool printable<T, std::void_t<decltype(
+    std::declval<std::ostream&>() << std::declval<const T&>())>> = true;
+
+template<class T>
+std::string print(const T& value)
+{
+    if constexpr (std::is_same_v<T, std::nullptr_t>) {
+        return "nullptr";
+    } else if constexpr (std::is_same_v<T, bool>) {
+        return value ? "true" : "false";
+    } else if constexpr (printable<T>) {
+        std::ostringstream out;
+        out << value;
+        return out.str();
+    } else {
+        return std::to_string(sizeof(T)) + "-byte object";
+    }
+}
+
+template<class T, class U, class Compare>
+assertion_result compare(const T& a, const U& b, Compare op,
+                         const char* a_text, const char* b_text,
+                         const char* op_text)
+{
+    if (op(a, b)) {
+        return {true, {}};
+    }
+    return {false, std::string("Expected: (") + a_text + ") " + op_text +
+                       " (" + b_text + "), actual: " + print(a) + " vs " +
+                       print(b)};
+}
+
+inline assertion_result check(bool condition, const char* text,
+                              const char* expected)
+{
+    if (condition == (expected[0] == 't')) {
+        return {true, {}};
+    }
+    return {false, std::string("Value of: ") + text + "\n  Actual: " +
+                       (condition ? "true" : "false") +
+                       "\nExpected: " + expected};
+}
+
+/* --- Runner --- */
+/// Whether name matches the glob pattern, in which * and ? are wildcards
+inline bool matches(const char* pattern, const char* name)
+{
+    if (*pattern == '\0') {
+        return *name == '\0';
+    }
+    if (*pattern == '*') {
+        return matches(pattern + 1, name) ||
+               (*name != '\0' && matches(pattern, name + 1));
+    }
+    return *name != '\0' && (*pattern == '?' || *pattern == *name) &&
+           matches(pattern + 1, name + 1);
+}
+
+/// Whether name matches a pattern of a Google Test filter: positive patterns
+/// separated by ':', then optionally '-' and the negative patterns
+inline bool selected(const std::string& name)
+{
+    const std::string& filter = detail::filter();
+    const std::size_t dash = filter.find('-');
+    const auto any = [&name](std::string patterns) {
+        std::istringstream in(patterns);
+        for (std::string pattern; std::getline(in, pattern, ':');) {
+            if (matches(pattern.c_str(), name.c_str())) {
+                return true;
+            }
+        }
+        return false;
+    };
+    const std::string positive = filter.substr(0, dash);
+    return (positive.empty() || any(positive)) &&
+           (dash == std::string::npos || !any(filter.substr(dash + 1)));
+}
+
+inline int run_all()
+{
+    std::vector<std::string> failed;
+    std::size_t ran = 0;
+    for (const test_info& info: registry()) {
+        if (!selected(info.name)) {
+            continue;
+        }
+        ++ran;
+        std::printf("[ RUN      ] %s\n", info.name.c_str());
+        current_failed() = false;
+        try {
+            const std::unique_ptr<Test> test = info.make();
+            test->SetUp();
+            if (!current_failed()) {
+                test->TestBody();
+            }
+            test->TearDown();
+        } catch (const std::exception& e) {
+            failure(info.name.c_str(), 0,
+                    std::string("Uncaught exception: ") + e.what()) = message();
+        } catch (...) {
+            failure(info.name.c_str(), 0, "Uncaught exception") = message();
+        }
+        std::printf("%s %s\n",
+                    current_failed() ? "[  FAILED  ]" : "[       OK ]",
+                    info.name.c_str());
+        if (current_failed()) {
+            failed.push_back(info.name);
+        }
+    }
+
+    std::printf("[==========] %zu tests ran.\n", ran);
+    std::printf("[  PASSED  ] %zu tests.\n", ran - failed.size());
+    for (const std::string& name: failed) {
+        std::printf("[  FAILED  ] %s\n", name.c_str());
+    }
+    std::fflush(stdout);
+    return failed.empty() ? 0 : 1;
+}
+
+} // namespace detail
+
+/// Read the --gtest_filter=<patterns> option
+inline void InitGoogleTest(int* argc, char** argv)
+{
+    const std::string option = "--gtest_filter=";
+    for (int i = 1; i < *argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg.compare(0, option.size(), option) == 0) {
+            detail::filter() = arg.substr(option.size());
+        }
+    }
+}
+
+} // namespace testing
+
+#define RUN_ALL_TESTS() ::testing::detail::run_all()
+
+/* --- Test definitions --- */
+#define TESTING_CLASS_(suite, name) suite##_##name##_Test
+
+#define TESTING_TEST_(suite, name, base)                                      \
+    class TESTING_CLASS_(suite, name): public base                            \
+    {                                                                         \
+    public:                                                                   \
+        void TestBody() override;                                             \
+    private:                                                                  \
+        static const bool registered_;                                        \
+    };                                                                        \
+    const bool TESTING_CLASS_(suite, name)::registered_ =                     \
+        ::testing::detail::register_test(#suite "." #name, [] {              \
+            return std::unique_ptr<::testing::Test>(                          \
+                new TESTING_CLASS_(suite, name)());                           \
+        });                                                                   \
+    void TESTING_CLASS_(suite, name)::TestBody()
+
+#define TEST(suite, name) TESTING_TEST_(suite, name, ::testing::Test)
+#define TEST_F(fixture, name) TESTING_TEST_(fixture, name, fixture)
+
+#define TYPED_TEST_SUITE(fixture, types) using fixture##_Types_ = types
+
+#define TYPED_TEST(fixture, name)                                             \
+    template<class TestingTypeParam_>                                         \
+    class TESTING_CLASS_(fixture, name): public fixture<TestingTypeParam_>    \
+    {                                                                         \
+    public:                                                                   \
+        using TypeParam = TestingTypeParam_;                                  \
+        void TestBody() override;                                             \
+    };                                                                        \
+    static const bool fixture##_##name##_registered_ =                        \
+        ::testing::detail::register_typed_test<TESTING_CLASS_(fixture, name)>( \
+            #fixture, #name, fixture##_Types_{});                             \
+    template<class TestingTypeParam_>                                         \
+    void TESTING_CLASS_(fixture, name)<TestingTypeParam_>::TestBody()
+
+/* --- Assertions --- */
+// The switch makes an else which follows the macro bind to the user's if, and
+// the message streamed after the macro is the right operand of the failure
+#define TESTING_ASSERT_(result, on_failure)                                   \
+    switch (0) case 0: default:                                               \
+    if (const ::testing::detail::assertion_result testing_result_ = result)   \
+        ;                                                                     \
+    else                                                                      \
+        on_failure ::testing::detail::failure(__FILE__, __LINE__,             \
+                                              testing_result_.message) =      \
+            ::testing::detail::message()
+
+#define TESTING_COMPARE_(a, b, op, op_text, fatal)                            \
+    TESTING_ASSERT_(::testing::detail::compare(a, b, op{}, #a, #b, op_text),  \
+                    fatal)
+
+#define EXPECT_EQ(a, b) \
+    TESTING_COMPARE_(a, b, std::equal_to<>, "==", )
+#define EXPECT_NE(a, b) \
+    TESTING_COMPARE_(a, b, std::not_equal_to<>, "!=", )
+#define EXPECT_LT(a, b) \
+    TESTING_COMPARE_(a, b, std::less<>, "<", )
+#define EXPECT_LE(a, b) \
+    TESTING_COMPARE_(a, b, std::less_equal<>, "<=", )
+#define EXPECT_GT(a, b) \
+    TESTING_COMPARE_(a, b, std::greater<>, ">", )
+#define EXPECT_GE(a, b) \
+    TESTING_COMPARE_(a, b, std::greater_equal<>, ">=", )
+#define ASSERT_EQ(a, b) \
+    TESTING_COMPARE_(a, b, std::equal_to<>, "==", return)
+#define ASSERT_NE(a, b) \
+    TESTING_COMPARE_(a, b, std::not_equal_to<>, "!=", return)
+#define ASSERT_LT(a, b) \
+    TESTING_COMPARE_(a, b, std::less<>, "<", return)
+#define ASSERT_LE(a, b) \
+    TESTING_COMPARE_(a, b, std::less_equal<>, "<=", return)
+#define ASSERT_GT(a, b) \
+    TESTING_COMPARE_(a, b, std::greater<>, ">", return)
+#define ASSERT_GE(a, b) \
+    TESTING_COMPARE_(a, b, std::greater_equal<>, ">=", return)
+
+#define EXPECT_TRUE(...) TESTING_ASSERT_(::testing::detail::check(           \
+    static_cast<bool>(__VA_ARGS__), #__VA_ARGS__, "true"), )
+#define EXPECT_FALSE(...) TESTING_ASSERT_(::testing::detail::check(          \
+    static_cast<bool>(__VA_ARGS__), #__VA_ARGS__, "false"), )
+#define ASSERT_TRUE(...) TESTING_ASSERT_(::testing::detail::check(           \
+    static_cast<bool>(__VA_ARGS__), #__VA_ARGS__, "true"), return)
+#define ASSERT_FALSE(...) TESTING_ASSERT_(::testing::detail::check(          \
+    static_cast<bool>(__VA_ARGS__), #__VA_ARGS__, "false"), return)
+
+#define EXPECT_THROW(statement, exception)                                    \
+    TESTING_ASSERT_(([&]() -> ::testing::detail::assertion_result {           \
+        try {                                                                 \
+            statement;                                                        \
+        } catch (const exception&) {                                          \
+            return {true, {}};                                                \
+        } catch (...) {                                                       \
+            return {false, "Expected: " #statement " throws an exception "    \
+                           "of type " #exception ".\n  Actual: it throws "    \
+                           "a different type."};                              \
+        }                                                                     \
+        return {false, "Expected: " #statement " throws an exception of "     \
+                       "type " #exception ".\n  Actual: it throws nothing."}; \
+    }()), )
+
+#define FAIL() TESTING_ASSERT_(                                               \
+    (::testing::detail::assertion_result{false, "Failed"}), return)
+#define SUCCEED() ::testing::detail::message()
+
+#endif //TESTING_HARNESS_H
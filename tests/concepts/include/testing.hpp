@@ -8,7 +8,7 @@
 #ifndef TESTING_H
 #define TESTING_H
 
-#include <gtest/gtest.h>
+#include <harness.hpp>
 
 #define CONCEPT_ASSERT(...) static_assert(__VA_ARGS__, \
     "concept assertion failed due to " #__VA_ARGS__)
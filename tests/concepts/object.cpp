@@ -52,6 +52,22 @@ protected:
         explicit ExplicitCopy(const ExplicitCopy&) = default;
     };
 
+    struct ThrowingCopy
+    {
+        ThrowingCopy() = default;
+        ThrowingCopy(const ThrowingCopy&) noexcept(false);
+        ThrowingCopy(ThrowingCopy&&) = default;
+        ThrowingCopy& operator=(const ThrowingCopy&) noexcept(false);
+        ThrowingCopy& operator=(ThrowingCopy&&) = default;
+    };
+
+    struct ThrowingMoveAssignment
+    {
+        ThrowingMoveAssignment(ThrowingMoveAssignment&&) = default;
+        ThrowingMoveAssignment& operator=(ThrowingMoveAssignment&&)
+            noexcept(false);
+    };
+
     struct SemiregularType { };
 
     struct RegularType
@@ -82,6 +98,21 @@ TEST_F(ObjectConcepts, ConceptMovable)
     CONCEPT_ASSERT(!Movable<ExplicitCopy>);
 }
 
+/* --- Concept NothrowMovable --- */
+TEST_F(ObjectConcepts, ConceptNothrowMovable)
+{
+    using concepts::NothrowMovable;
+
+    CONCEPT_ASSERT(NothrowMovable<int>);
+    CONCEPT_ASSERT(NothrowMovable<std::string>);
+    CONCEPT_ASSERT(NothrowMovable<MoveOnly>);
+    CONCEPT_ASSERT(NothrowMovable<ThrowingCopy>);
+
+    CONCEPT_ASSERT(!NothrowMovable<void>);
+    CONCEPT_ASSERT(!NothrowMovable<NonMovable>);
+    CONCEPT_ASSERT(!NothrowMovable<ThrowingMoveAssignment>);
+}
+
 /* --- Concept Copyable --- */
 TEST_F(ObjectConcepts, ConceptCopyable)
 {
@@ -103,6 +134,21 @@ TEST_F(ObjectConcepts, ConceptCopyable)
     CONCEPT_ASSERT(!Copyable<ExplicitCopy>);
 }
 
+/* --- Concept NothrowCopyable --- */
+TEST_F(ObjectConcepts, ConceptNothrowCopyable)
+{
+    using concepts::NothrowCopyable;
+
+    CONCEPT_ASSERT(NothrowCopyable<int>);
+    CONCEPT_ASSERT(NothrowCopyable<int*>);
+    CONCEPT_ASSERT(NothrowCopyable<CopyableType>);
+
+    CONCEPT_ASSERT(!NothrowCopyable<std::string>);
+    CONCEPT_ASSERT(!NothrowCopyable<MoveOnly>);
+    CONCEPT_ASSERT(!NothrowCopyable<ThrowingCopy>);
+    CONCEPT_ASSERT(!NothrowCopyable<const int>);
+}
+
 /* --- Concept Semiregular --- */
 TEST_F(ObjectConcepts, ConceptSemiregular)
 {
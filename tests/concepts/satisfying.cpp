@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <testing.hpp>
+
+#include <conceptslib/concepts.hpp>
+
+namespace
+{
+struct OnInt
+{
+    void operator()(int) const;
+};
+
+struct OnString
+{
+    void operator()(const std::string&) const;
+};
+
+struct OnAnything
+{
+    template<class T>
+    void operator()(const T&) const;
+};
+
+CONCEPT_PREDICATE(integral, concepts::Integral);
+
+} // namespace
+
+TEST(ConceptSatisfying, Satisfying)
+{
+    using traits::list;
+    using concepts::satisfying;
+    using concepts::satisfying_t;
+    using L = list<int, double, long, std::string, char>;
+
+    CONCEPT_ASSERT(std::is_same_v<satisfying_t<integral, L>,
+                                  list<int, long, char>>);
+    CONCEPT_ASSERT(std::is_same_v<satisfying<integral, L>::indices,
+                                  std::index_sequence<0, 2, 4>>);
+    CONCEPT_ASSERT(std::is_same_v<satisfying_t<integral, list<>>, list<>>);
+    CONCEPT_ASSERT(std::is_same_v<satisfying<integral, list<float>>::indices,
+                                  std::index_sequence<>>);
+
+    // Further arguments of the concept follow the type of the list
+    using handlers = list<OnInt, OnString, OnAnything>;
+    CONCEPT_ASSERT(std::is_same_v<
+        satisfying_t<concepts::invocable, handlers, std::string>,
+        list<OnString, OnAnything>>);
+    CONCEPT_ASSERT(std::is_same_v<
+        satisfying<concepts::invocable, handlers, int>::indices,
+        std::index_sequence<0, 2>>);
+}
+
+TEST(ConceptSatisfying, FirstSatisfying)
+{
+    using traits::list;
+    using concepts::first_satisfying_v;
+    using handlers = list<OnInt, OnString, OnAnything>;
+
+    CONCEPT_ASSERT(first_satisfying_v<concepts::invocable, handlers, int> == 0);
+    CONCEPT_ASSERT(first_satisfying_v<concepts::invocable, handlers,
+                                      const char*> == 1);
+    CONCEPT_ASSERT(first_satisfying_v<concepts::invocable, handlers,
+                                      double*> == 2);
+    CONCEPT_ASSERT(first_satisfying_v<concepts::invocable,
+                                      list<OnInt, OnString>, double*> == 2);
+    CONCEPT_ASSERT(first_satisfying_v<integral, list<>> == 0);
+    CONCEPT_ASSERT(first_satisfying_v<std::is_pointer, list<int, int*>> == 1);
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <testing.hpp>
+
+#include <conceptslib/containers.hpp>
+
+namespace
+{
+template<class Map, class Q, class = void>
+constexpr bool can_find = false;
+
+template<class Map, class Q>
+constexpr bool can_find<Map, Q, std::void_t<decltype(
+    std::declval<const Map&>().find(std::declval<const Q&>()))>> = true;
+
+template<class Map>
+void expect_same_elements(const Map& map, const std::map<int, int>& reference)
+{
+    ASSERT_EQ(map.size(), reference.size());
+    auto expected = reference.begin();
+    for (const auto& element: map) {
+        ASSERT_EQ(element.first, expected->first);
+        ASSERT_EQ(element.second, expected->second);
+        ++expected;
+    }
+    // Backwards, through the links between leaves
+    auto it = map.end();
+    for (auto r = reference.rbegin(); r != reference.rend(); ++r) {
+        --it;
+        ASSERT_EQ(it->first, r->first);
+    }
+    EXPECT_TRUE(it == map.begin());
+}
+
+// Random insertions, erasures and lookups, checked against std::map
+template<class Map>
+void compare_with_std_map(unsigned seed)
+{
+    std::mt19937 rng{seed};
+    std::uniform_int_distribution<int> key{0, 2000};
+    Map map;
+    std::map<int, int> reference;
+    for (int i = 0; i < 20000; ++i) {
+        const int k = key(rng);
+        switch (rng() % 4) {
+        case 0:
+        case 1: {
+            const bool inserted = map.try_emplace(k, i).second;
+            ASSERT_EQ(inserted, reference.try_emplace(k, i).second);
+            break;
+        }
+        case 2:
+            ASSERT_EQ(map.erase(k), reference.erase(k));
+            break;
+        default: {
+            const auto it = map.lower_bound(k);
+            const auto expected = reference.lower_bound(k);
+            ASSERT_EQ(it == map.end(), expected == reference.end());
+            if (expected != reference.end()) {
+                ASSERT_EQ(it->first, expected->first);
+            }
+            const auto upper = map.upper_bound(k);
+            ASSERT_EQ(upper == map.end(),
+                      reference.upper_bound(k) == reference.end());
+        }
+        }
+        if (i % 1000 == 0) {
+            expect_same_elements(map, reference);
+        }
+    }
+    expect_same_elements(map, reference);
+
+    // Erase everything through iterators
+    auto it = map.begin();
+    while (it != map.end()) {
+        const int k = it->first;
+        it = map.erase(it);
+        const auto next = reference.erase(reference.find(k));
+        if (next != reference.end()) {
+            ASSERT_EQ(it->first, next->first);
+        }
+    }
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.begin() == map.end());
+}
+
+} // namespace
+
+TEST(BtreeMap, Modifiers)
+{
+    containers::btree_map<int, std::string> map = {{3, "c"}, {1, "a"}};
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_TRUE(map.insert({2, "b"}).second);
+    EXPECT_FALSE(map.insert({2, "x"}).second);
+    EXPECT_FALSE(map.try_emplace(1, "x").second);
+    EXPECT_EQ(map.at(2), "b");
+    EXPECT_THROW(map.at(4), std::out_of_range);
+
+    map[4] = "d";
+    map.insert_or_assign(1, "A");
+    std::string joined;
+    for (const auto& [key, value]: map) {
+        joined += std::to_string(key) + value;
+    }
+    EXPECT_EQ(joined, "1A2b3c4d");
+
+    auto it = map.find(3);
+    it->second = "C";
+    EXPECT_EQ(map.at(3), "C");
+    EXPECT_EQ(map.erase(3), 1u);
+    EXPECT_EQ(map.erase(3), 0u);
+    EXPECT_FALSE(map.contains(3));
+    EXPECT_EQ(map.count(4), 1u);
+
+    // Move only values
+    containers::btree_map<int, std::unique_ptr<int>> owners;
+    for (int i = 0; i < 100; ++i) {
+        owners.try_emplace(i, std::make_unique<int>(i));
+    }
+    EXPECT_EQ(*owners.at(42), 42);
+    auto moved = std::move(owners);
+    EXPECT_EQ(moved.size(), 100u);
+    EXPECT_TRUE(owners.empty());
+}
+
+TEST(BtreeMap, CopyAndCompare)
+{
+    containers::btree_map<int, int> map;
+    for (int i = 0; i < 1000; ++i) {
+        map[i * 7 % 1000] = i;
+    }
+    auto copy = map;
+    EXPECT_TRUE(copy == map);
+    copy[5] = -1;
+    EXPECT_TRUE(copy != map);
+    copy = map;
+    EXPECT_TRUE(copy == map);
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_EQ(copy.size(), 1000u);
+}
+
+TEST(BtreeMap, AgainstStdMap)
+{
+    // Nodes of 4 slots split and merge often
+    using small_nodes = containers::btree_map<int, int, 1>;
+    CONCEPT_ASSERT(small_nodes::leaf_slots == 4);
+    CONCEPT_ASSERT(small_nodes::inner_slots == 4);
+    CONCEPT_ASSERT(containers::btree_map<int, int>::leaf_slots ==
+                   containers::detail::btree_node_bytes / 8);
+
+    compare_with_std_map<small_nodes>(1);
+    compare_with_std_map<containers::btree_map<int, int, 40>>(2);
+    compare_with_std_map<containers::btree_map<int, int>>(3);
+}
+
+TEST(BtreeMap, HeterogeneousLookup)
+{
+    containers::btree_map<std::string, int> words = {{"pear", 1},
+                                                     {"fig", 2}};
+    EXPECT_EQ(words.find("fig")->second, 2);
+    EXPECT_TRUE(words.contains("pear"));
+    EXPECT_EQ(words.lower_bound("g")->first, "pear");
+
+    containers::btree_map<long, int> prices = {{10, 1}, {20, 2}};
+    EXPECT_EQ(prices.find(20)->second, 2);
+    EXPECT_EQ(prices.upper_bound(10)->first, 20);
+
+    // Lookups require keys totally ordered with K
+    CONCEPT_ASSERT(can_find<containers::btree_map<std::string, int>
+                           ,const char*>);
+    CONCEPT_ASSERT(!can_find<containers::btree_map<std::string, int>, int>);
+    CONCEPT_ASSERT(!can_find<containers::btree_map<int, int>
+                            ,std::vector<int>>);
+}
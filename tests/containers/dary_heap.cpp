@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <testing.hpp>
+
+#include <conceptslib/containers.hpp>
+
+namespace
+{
+// Pop every element of heap, comparing them with std::priority_queue
+template<class Heap>
+void expect_same_order(Heap& heap, std::priority_queue<int>& reference)
+{
+    ASSERT_EQ(heap.size(), reference.size());
+    while (!reference.empty()) {
+        ASSERT_EQ(heap.top(), reference.top());
+        heap.pop();
+        reference.pop();
+    }
+    EXPECT_TRUE(heap.empty());
+}
+
+template<std::size_t D>
+void check_arity()
+{
+    std::mt19937 rng{D};
+    std::vector<int> values(1000);
+    for (auto& value: values) {
+        value = static_cast<int>(rng() % 500);
+    }
+
+    containers::dary_heap<int, D> pushed;
+    std::priority_queue<int> reference;
+    for (int value: values) {
+        pushed.push(value);
+        reference.push(value);
+    }
+    expect_same_order(pushed, reference);
+
+    // Bulk build, then interleaved pushes and pops
+    containers::dary_heap<int, D> built(values.begin(), values.end());
+    reference = std::priority_queue<int>(values.begin(), values.end());
+    for (int i = 0; i < 300; ++i) {
+        built.pop();
+        reference.pop();
+        built.push(i);
+        reference.push(i);
+    }
+    expect_same_order(built, reference);
+}
+
+// Orders unique_ptr<int> by value. When *countdown is set, the comparison
+// which brings it to 0 throws.
+struct ThrowingLess
+{
+    int* countdown;
+
+    bool operator()(const std::unique_ptr<int>& l,
+                    const std::unique_ptr<int>& r) const
+    {
+        if (*countdown > 0 && --*countdown == 0) {
+            throw std::runtime_error("comparison failed");
+        }
+        return *l < *r;
+    }
+};
+
+using throwing_heap =
+    containers::dary_heap<std::unique_ptr<int>, 3, ThrowingLess>;
+
+// Heap of the values 0 to n - 1
+void fill(throwing_heap& heap, int n)
+{
+    for (int i = 0; i < n; ++i) {
+        heap.push(std::make_unique<int>(i * 17 % n));
+    }
+}
+
+// Pop every element of heap, which may not be in heap order, sorted
+std::vector<int> drain(throwing_heap& heap)
+{
+    std::vector<int> values;
+    while (!heap.empty()) {
+        EXPECT_TRUE(heap.top() != nullptr);
+        values.push_back(heap.top() ? *heap.top() : -100);
+        heap.pop();
+    }
+    std::sort(values.begin(), values.end());
+    return values;
+}
+
+std::vector<int> iota(int first, int last)
+{
+    std::vector<int> values;
+    for (int i = first; i < last; ++i) {
+        values.push_back(i);
+    }
+    return values;
+}
+
+} // namespace
+
+TEST(DaryHeap, Order)
+{
+    CONCEPT_ASSERT(containers::dary_heap<int>::arity == 4);
+    CONCEPT_ASSERT(containers::dary_heap<double>::arity == 4);
+    CONCEPT_ASSERT(containers::dary_heap<std::array<char, 100>>::arity == 2);
+
+    check_arity<2>();
+    check_arity<3>();
+    check_arity<4>();
+    check_arity<16>();
+}
+
+TEST(DaryHeap, Modifiers)
+{
+    containers::dary_heap<int, 4, std::greater<int>> heap;
+    heap.push(5);
+    heap.push(3);
+    heap.emplace(8);
+    EXPECT_EQ(heap.top(), 3); // Smallest first
+
+    heap.replace_top(6);
+    EXPECT_EQ(heap.top(), 5);
+
+    const std::vector<int> more = {9, 1, 7};
+    heap.push_range(more.begin(), more.end());
+    std::vector<int> popped;
+    while (!heap.empty()) {
+        popped.push_back(heap.top());
+        heap.pop();
+    }
+    EXPECT_EQ(popped, (std::vector<int>{1, 5, 6, 7, 8, 9}));
+
+    // Move only elements
+    auto less = [](const std::unique_ptr<int>& l,
+                   const std::unique_ptr<int>& r) { return *l < *r; };
+    containers::dary_heap<std::unique_ptr<int>, 3, decltype(less)> owners(
+        less);
+    for (int i = 0; i < 10; ++i) {
+        owners.push(std::make_unique<int>(i * 7 % 10));
+    }
+    EXPECT_EQ(*owners.top(), 9);
+    owners.pop();
+    EXPECT_EQ(*owners.top(), 8);
+    owners.clear();
+    EXPECT_TRUE(owners.empty());
+}
+
+TEST(DaryHeap, ThrowingComparisons)
+{
+    // No element is lost when a comparison throws in the middle of sifting
+    for (int limit = 1; limit <= 3; ++limit) {
+        int countdown = 0;
+        throwing_heap heap(ThrowingLess{&countdown});
+
+        fill(heap, 39);
+        countdown = limit;
+        EXPECT_THROW(heap.push(std::make_unique<int>(39)),
+                     std::runtime_error);
+        EXPECT_EQ(drain(heap), iota(0, 40));
+
+        fill(heap, 39);
+        countdown = limit;
+        EXPECT_THROW(heap.replace_top(std::make_unique<int>(-1)),
+                     std::runtime_error);
+        EXPECT_EQ(drain(heap), iota(-1, 38));
+
+        // pop still removes the top
+        fill(heap, 39);
+        countdown = limit;
+        EXPECT_THROW(heap.pop(), std::runtime_error);
+        EXPECT_EQ(drain(heap), iota(0, 38));
+    }
+}
+
+TEST(DaryHeap, IndexedPriorities)
+{
+    using Heap = containers::indexed_dary_heap<int, 2, std::greater<int>>;
+
+    Heap heap(6);
+    EXPECT_EQ(heap.key_count(), 6u);
+    heap.push(0, 50);
+    heap.push(3, 30);
+    heap.push(5, 40);
+    EXPECT_TRUE(heap.contains(3));
+    EXPECT_FALSE(heap.contains(1));
+    EXPECT_EQ(heap.top_key(), 3u);
+
+    heap.decrease_key(0, 10);
+    EXPECT_EQ(heap.top_key(), 0u);
+    EXPECT_EQ(heap.priority(0), 10);
+
+    heap.update(0, 45); // Lowers the priority
+    heap.update(1, 35); // Adds the key
+    EXPECT_EQ(heap.size(), 4u);
+
+    std::vector<std::size_t> keys;
+    while (!heap.empty()) {
+        keys.push_back(heap.top_key());
+        heap.pop();
+    }
+    EXPECT_EQ(keys, (std::vector<std::size_t>{3, 1, 5, 0}));
+    EXPECT_FALSE(heap.contains(3));
+
+    // Bulk build: the key i has the priority values[i]
+    const std::vector<int> values = {4, 2, 9, 0, 7};
+    Heap built(values.begin(), values.end());
+    EXPECT_EQ(built.top_key(), 3u);
+    built.update(2, -1);
+    EXPECT_EQ(built.top_key(), 2u);
+    built.clear();
+    EXPECT_FALSE(built.contains(0));
+}
+
+TEST(DaryHeap, Dijkstra)
+{
+    // Edges (from, to, weight) of a directed graph
+    struct Edge { std::size_t to; int weight; };
+    const std::vector<std::vector<Edge>> graph = {
+        {{1, 7}, {2, 9}, {5, 14}},
+        {{0, 7}, {2, 10}, {3, 15}},
+        {{0, 9}, {1, 10}, {3, 11}, {5, 2}},
+        {{1, 15}, {2, 11}, {4, 6}},
+        {{3, 6}, {5, 9}},
+        {{0, 14}, {2, 2}, {4, 9}}};
+
+    constexpr int infinity = std::numeric_limits<int>::max();
+    std::vector<int> distance(graph.size(), infinity);
+    containers::indexed_dary_heap<int, 4, std::greater<int>> queue(
+        graph.size());
+    distance[0] = 0;
+    queue.push(0, 0);
+    while (!queue.empty()) {
+        const std::size_t u = queue.top_key();
+        queue.pop();
+        for (const Edge& e: graph[u]) {
+            const int d = distance[u] + e.weight;
+            if (d < distance[e.to]) {
+                distance[e.to] = d;
+                queue.update(e.to, d);
+            }
+        }
+    }
+    EXPECT_EQ(distance, (std::vector<int>{0, 7, 9, 20, 20, 11}));
+}
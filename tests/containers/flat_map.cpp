@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <testing.hpp>
+
+#include <conceptslib/containers.hpp>
+
+namespace
+{
+template<class Map, class Q, class = void>
+constexpr bool can_find = false;
+
+template<class Map, class Q>
+constexpr bool can_find<Map, Q, std::void_t<decltype(
+    std::declval<const Map&>().find(std::declval<const Q&>()))>> = true;
+
+} // namespace
+
+TEST(FlatMap, Construction)
+{
+    // Of equal keys, the first one is kept
+    const std::vector<std::pair<int, char>> elements = {
+        {3, 'c'}, {1, 'a'}, {3, 'x'}, {2, 'b'}, {1, 'y'}};
+    containers::flat_map<int, char> map(elements.begin(), elements.end());
+    EXPECT_EQ(map.keys(), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ(map.values(), (std::vector<char>{'a', 'b', 'c'}));
+
+    const containers::flat_map<int, char> same = {{2, 'b'}, {1, 'a'},
+                                                  {3, 'c'}};
+    EXPECT_TRUE(map == same);
+    map[3] = 'z';
+    EXPECT_TRUE(map != same);
+}
+
+TEST(FlatMap, Modifiers)
+{
+    containers::flat_map<int, std::string> map;
+    EXPECT_TRUE(map.try_emplace(5, "e").second);
+    EXPECT_TRUE(map.insert({1, "a"}).second);
+    EXPECT_TRUE(map.emplace(3, "c").second);
+    EXPECT_FALSE(map.emplace(3, "x").second);
+    EXPECT_EQ(map.at(3), "c");
+    EXPECT_THROW(map.at(4), std::out_of_range);
+
+    map[4] = "d";
+    map.insert_or_assign(1, "A");
+    std::string joined;
+    for (const auto& [key, value]: map) {
+        joined += std::to_string(key) + value;
+    }
+    EXPECT_EQ(joined, "1A3c4d5e");
+
+    // Random access iterators
+    auto it = map.begin() + 2;
+    EXPECT_EQ(it->first, 4);
+    it->second = "D";
+    EXPECT_EQ(map.end() - map.begin(), 4);
+    EXPECT_EQ(map.at(4), "D");
+
+    it = map.erase(map.find(3));
+    EXPECT_EQ(it->first, 4);
+    EXPECT_EQ(map.erase(1), 1u);
+    EXPECT_EQ(map.erase(1), 0u);
+    EXPECT_EQ(map.keys(), (std::vector<int>{4, 5}));
+}
+
+TEST(FlatMap, BoolValues)
+{
+    // The values are bool objects, not the bits of a std::vector<bool>
+    containers::flat_map<int, bool> map = {{3, true}, {1, false}};
+    bool& value = map.at(1);
+    value = true;
+    EXPECT_TRUE(map.at(1));
+    map[2] = false;
+    map.emplace(0, true);
+    for (auto [key, flag]: map) {
+        flag = key % 2 == 0;
+    }
+    EXPECT_EQ(map.size(), 4u);
+    EXPECT_TRUE(map.at(0) && !map.at(1) && map.at(2) && !map.at(3));
+    EXPECT_TRUE(std::equal(map.values().begin(), map.values().end(),
+                           std::vector<bool>{true, false, true, false}.begin()));
+
+    map.erase(2);
+    const containers::flat_map<int, bool> copy = map;
+    EXPECT_TRUE(copy == map);
+    EXPECT_EQ(copy.values().size(), 3u);
+    EXPECT_FALSE(copy.at(3));
+}
+
+TEST(FlatMap, Lookup)
+{
+    std::mt19937 rng{11};
+    containers::flat_map<int, int> map;
+    std::map<int, int> reference;
+    for (int i = 0; i < 2000; ++i) {
+        const int k = static_cast<int>(rng() % 1000);
+        EXPECT_EQ(map.try_emplace(k, i).second,
+                  reference.try_emplace(k, i).second);
+    }
+    EXPECT_TRUE(std::equal(map.keys().begin(), map.keys().end(),
+                           reference.begin(), reference.end(),
+                           [](int k, const auto& e) { return k == e.first; }));
+    for (int k = -1; k <= 1001; ++k) {
+        const auto lower = map.lower_bound(k);
+        const auto upper = map.upper_bound(k);
+        const auto expected = reference.equal_range(k);
+        ASSERT_EQ(lower == map.end(), expected.first == reference.end());
+        ASSERT_EQ(upper == map.end(), expected.second == reference.end());
+        if (expected.second != reference.end()) {
+            ASSERT_EQ(upper->first, expected.second->first);
+        }
+        ASSERT_EQ(map.contains(k), reference.count(k) == 1);
+    }
+}
+
+TEST(FlatMap, HeterogeneousLookup)
+{
+    const containers::flat_map<std::string, int> words = {{"pear", 1},
+                                                          {"fig", 2}};
+    EXPECT_EQ(words.find("fig")->second, 2);
+    EXPECT_EQ(words.count("kiwi"), 0u);
+    const auto range = words.equal_range("pear");
+    EXPECT_EQ(std::distance(range.first, range.second), 1);
+
+    // Lookups require keys totally ordered with K
+    CONCEPT_ASSERT(can_find<containers::flat_map<std::string, int>
+                           ,const char*>);
+    CONCEPT_ASSERT(can_find<containers::flat_map<long, int>, int>);
+    CONCEPT_ASSERT(!can_find<containers::flat_map<std::string, int>, int>);
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <testing.hpp>
+
+#include <conceptslib/containers.hpp>
+
+namespace
+{
+using namespace std::string_view_literals;
+
+constexpr auto methods = containers::make_frozen_map<std::string_view, int>({
+    {"GET", 1}, {"HEAD", 2}, {"POST", 3}, {"PUT", 4}, {"DELETE", 5},
+    {"CONNECT", 6}, {"OPTIONS", 7}, {"TRACE", 8}, {"PATCH", 9}});
+
+enum class color { red, green, blue };
+
+// 200 integer keys: the displacements must separate many collisions
+template<std::size_t... Is>
+constexpr auto make_squares(std::index_sequence<Is...>)
+{
+    const std::pair<long, long> elements[] = {
+        {static_cast<long>(Is * 7919), static_cast<long>(Is * Is)}...};
+    return containers::make_frozen_map(elements);
+}
+
+constexpr auto squares = make_squares(std::make_index_sequence<200>{});
+
+} // namespace
+
+TEST(FrozenMap, ConstantEvaluation)
+{
+    CONCEPT_ASSERT(methods.size() == 9);
+    CONCEPT_ASSERT(methods.at("GET"sv) == 1);
+    CONCEPT_ASSERT(methods.at("PATCH"sv) == 9);
+    CONCEPT_ASSERT(!methods.contains("get"sv));
+    CONCEPT_ASSERT(!methods.contains(""sv));
+    CONCEPT_ASSERT(methods.index_of("POST"sv) == 2);
+    CONCEPT_ASSERT(methods.index_of("BREW"sv) == 9);
+    // Iteration follows the given order
+    CONCEPT_ASSERT(methods.begin()->first == "GET"sv);
+
+    constexpr auto colors = containers::make_frozen_map<color, char>(
+        {{color::red, 'r'}, {color::green, 'g'}, {color::blue, 'b'}});
+    CONCEPT_ASSERT(colors.at(color::blue) == 'b');
+
+    CONCEPT_ASSERT(squares.at(199 * 7919) == 199 * 199);
+    CONCEPT_ASSERT(!squares.contains(1));
+}
+
+TEST(FrozenMap, Runtime)
+{
+    for (const auto& [key, value]: methods) {
+        EXPECT_EQ(methods.at(key), value);
+    }
+    std::size_t found = 0;
+    for (long i = 0; i < 200 * 7919; ++i) {
+        found += squares.count(i);
+    }
+    EXPECT_EQ(found, 200u);
+
+    const std::string method = "OPTIONS";
+    EXPECT_EQ(methods.find(method)->second, 7);
+    EXPECT_THROW(methods.at("BREW"), std::out_of_range);
+
+    using map = containers::frozen_map<int, int, 2>;
+    const std::pair<int, int> duplicates[] = {{1, 1}, {1, 2}};
+    EXPECT_THROW(map{duplicates}, std::invalid_argument);
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <testing.hpp>
+
+#include <conceptslib/containers.hpp>
+
+namespace
+{
+template<class Map, class Q, class = void>
+constexpr bool can_find = false;
+
+template<class Map, class Q>
+constexpr bool can_find<Map, Q, std::void_t<decltype(
+    std::declval<const Map&>().find(std::declval<const Q&>()))>> = true;
+
+// Every key has the same hash value: probes are as long as possible
+struct CollidingHash
+{
+    std::size_t operator()(int) const noexcept { return 42; }
+};
+
+template<class Map>
+void compare_with_unordered_map(unsigned seed)
+{
+    std::mt19937 rng{seed};
+    Map map;
+    std::unordered_map<int, int> reference;
+    for (int i = 0; i < 5000; ++i) {
+        const int k = static_cast<int>(rng() % 300);
+        if (rng() % 3 == 0) {
+            ASSERT_EQ(map.erase(k), reference.erase(k));
+        } else {
+            ASSERT_EQ(map.try_emplace(k, i).second,
+                      reference.try_emplace(k, i).second);
+        }
+    }
+    ASSERT_EQ(map.size(), reference.size());
+    for (int k = 0; k < 300; ++k) {
+        const auto it = map.find(k);
+        const auto expected = reference.find(k);
+        ASSERT_EQ(it == map.end(), expected == reference.end());
+        if (expected != reference.end()) {
+            ASSERT_EQ(it->second, expected->second);
+        }
+    }
+}
+
+} // namespace
+
+TEST(HashMap, Modifiers)
+{
+    containers::hash_map<int, std::string> map = {{3, "c"}, {1, "a"}};
+    EXPECT_TRUE(map.insert({2, "b"}).second);
+    EXPECT_FALSE(map.try_emplace(1, "x").second);
+    EXPECT_EQ(map.at(2), "b");
+    EXPECT_THROW(map.at(4), std::out_of_range);
+
+    map[4] = "d";
+    map.insert_or_assign(1, "A");
+    EXPECT_EQ(map.size(), 4u);
+    EXPECT_EQ(map.at(1), "A");
+
+    // Erasing moves the last element to the position of the erased one
+    auto it = map.erase(map.find(3));
+    EXPECT_EQ(it->first, 4);
+    EXPECT_EQ(map.erase(3), 0u);
+    EXPECT_EQ(map.erase(1), 1u);
+    EXPECT_EQ(map.size(), 2u);
+    EXPECT_TRUE(map == (containers::hash_map<int, std::string>{{2, "b"},
+                                                               {4, "d"}}));
+
+    // Erase everything while iterating
+    it = map.begin();
+    while (it != map.end()) {
+        it = map.erase(it);
+    }
+    EXPECT_TRUE(map.empty());
+
+    containers::hash_map<int, std::unique_ptr<int>> owners;
+    owners.reserve(100);
+    for (int i = 0; i < 100; ++i) {
+        owners.try_emplace(i, std::make_unique<int>(i));
+    }
+    EXPECT_EQ(*owners.at(42), 42);
+}
+
+TEST(HashMap, BoolValues)
+{
+    // The values are bool objects, not the bits of a std::vector<bool>
+    containers::hash_map<int, bool> map = {{1, false}, {2, true}};
+    bool& value = map.at(1);
+    value = true;
+    EXPECT_TRUE(map.at(1));
+    for (int i = 3; i < 100; ++i) {
+        map[i] = i % 3 == 0;
+    }
+    for (auto [key, flag]: map) {
+        flag = !flag;
+    }
+    EXPECT_FALSE(map.at(2));
+    EXPECT_FALSE(map.at(3));
+    EXPECT_TRUE(map.at(4));
+
+    // Erasing moves the last value to the position of the erased one
+    EXPECT_EQ(map.erase(1), 1u);
+    EXPECT_EQ(map.size(), 98u);
+    EXPECT_FALSE(map.at(99));
+    const containers::hash_map<int, bool> copy = map;
+    EXPECT_TRUE(copy == map);
+}
+
+TEST(HashMap, AgainstUnorderedMap)
+{
+    compare_with_unordered_map<containers::hash_map<int, int>>(1);
+    compare_with_unordered_map<containers::hash_map<int, int
+                                                   ,CollidingHash>>(2);
+}
+
+TEST(HashMap, HeterogeneousLookup)
+{
+    containers::hash_map<std::string, int> words = {{"pear", 1}, {"fig", 2}};
+    EXPECT_EQ(words.find(std::string_view("fig"))->second, 2);
+    EXPECT_TRUE(words.contains("pear"));
+    EXPECT_EQ(words.count("kiwi"), 0u);
+    EXPECT_EQ(words.erase(std::string_view("pear")), 1u);
+    EXPECT_FALSE(words.contains("pear"));
+
+    using string_map = containers::hash_map<std::string, int>;
+    CONCEPT_ASSERT(can_find<string_map, std::string_view>);
+    CONCEPT_ASSERT(can_find<string_map, const char*>);
+    CONCEPT_ASSERT(!can_find<string_map, int>);
+
+    // The hash function must be transparent
+    using std_hash_map =
+        containers::hash_map<std::string, int, std::hash<std::string>>;
+    CONCEPT_ASSERT(!containers::detail::heterogeneous_hash_lookup_v<
+        std::string, std::string_view, std::hash<std::string>>);
+    CONCEPT_ASSERT(!can_find<std_hash_map, std::string_view>);
+}
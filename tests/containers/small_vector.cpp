@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <testing.hpp>
+
+#include <conceptslib/containers.hpp>
+
+class SmallVector: public ::testing::Test
+{
+protected:
+    // Keeps track of the number of live objects to detect leaks
+    struct Counted
+    {
+        static inline int live = 0;
+
+        Counted(int v = 0): value{v} { ++live; }
+        Counted(const Counted& other): value{other.value} { ++live; }
+        Counted(Counted&& other) noexcept: value{other.value} { ++live; }
+        Counted& operator=(const Counted&) = default;
+        Counted& operator=(Counted&&) = default;
+        ~Counted() { --live; }
+
+        friend bool operator==(const Counted& l, const Counted& r)
+        { return l.value == r.value; }
+
+        int value;
+    };
+
+    // Counted, but its move constructor may throw
+    struct ThrowingMove: Counted
+    {
+        using Counted::Counted;
+        ThrowingMove(const ThrowingMove&) = default;
+        ThrowingMove(ThrowingMove&& other) noexcept(false): Counted(other) { }
+        ThrowingMove& operator=(const ThrowingMove&) = default;
+        ThrowingMove& operator=(ThrowingMove&&) = default;
+    };
+
+    void SetUp() override { Counted::live = 0; }
+    void TearDown() override { EXPECT_EQ(Counted::live, 0); }
+};
+
+TEST_F(SmallVector, Relocation)
+{
+    using containers::detail::trivially_relocatable_v;
+
+    CONCEPT_ASSERT(trivially_relocatable_v<int>);
+    struct Aggregate { int i; double d; };
+
+    CONCEPT_ASSERT(trivially_relocatable_v<Aggregate>);
+    CONCEPT_ASSERT(!trivially_relocatable_v<std::string>);
+    CONCEPT_ASSERT(!trivially_relocatable_v<Counted>);
+
+    using containers::detail::nothrow_relocatable_v;
+    CONCEPT_ASSERT(nothrow_relocatable_v<int>);
+    CONCEPT_ASSERT(nothrow_relocatable_v<std::string>);
+    CONCEPT_ASSERT(nothrow_relocatable_v<Counted>);
+    CONCEPT_ASSERT(!nothrow_relocatable_v<ThrowingMove>);
+}
+
+TEST_F(SmallVector, InlineThenHeap)
+{
+    containers::small_vector<int, 4> v;
+    EXPECT_TRUE(v.empty());
+    EXPECT_TRUE(v.is_inline());
+    EXPECT_EQ(v.capacity(), 4u);
+
+    for (int i = 0; i < 4; ++i) {
+        v.push_back(i);
+    }
+    EXPECT_TRUE(v.is_inline());
+
+    v.push_back(4);
+    EXPECT_FALSE(v.is_inline());
+    EXPECT_GE(v.capacity(), 5u);
+    EXPECT_EQ(v, (containers::small_vector<int, 4>{0, 1, 2, 3, 4}));
+
+    containers::small_vector<int, 0> none;
+    EXPECT_EQ(none.capacity(), 0u);
+    none.push_back(1);
+    EXPECT_FALSE(none.is_inline());
+    EXPECT_EQ(none.back(), 1);
+}
+
+TEST_F(SmallVector, NonTrivialElements)
+{
+    {
+        containers::small_vector<Counted, 2> v;
+        for (int i = 0; i < 10; ++i) {
+            v.emplace_back(i);
+        }
+        EXPECT_EQ(Counted::live, 10);
+        for (int i = 0; i < 10; ++i) {
+            EXPECT_EQ(v[i].value, i);
+        }
+        v.resize(3);
+        EXPECT_EQ(Counted::live, 3);
+        v.resize(5, Counted{7});
+        EXPECT_EQ(v.back().value, 7);
+    }
+
+    containers::small_vector<std::string, 2> s = {"a", "b"};
+    s.push_back(s[0]); // Reallocation while referring to an element
+    s.push_back(std::string(100, 'x'));
+    EXPECT_EQ(s[2], "a");
+    EXPECT_EQ(s[3].size(), 100u);
+}
+
+TEST_F(SmallVector, MoveOnlyElements)
+{
+    CONCEPT_ASSERT(!std::is_copy_constructible_v<std::unique_ptr<int>>);
+
+    containers::small_vector<std::unique_ptr<int>, 2> v;
+    for (int i = 0; i < 5; ++i) {
+        v.push_back(std::make_unique<int>(i));
+    }
+    auto moved = std::move(v);
+    EXPECT_TRUE(v.empty());
+    EXPECT_EQ(*moved[4], 4);
+}
+
+TEST_F(SmallVector, CopyAndMove)
+{
+    using Vector = containers::small_vector<Counted, 4>;
+
+    Vector small = {1, 2};
+    Vector large = {1, 2, 3, 4, 5, 6};
+
+    Vector copy = small;
+    EXPECT_EQ(copy, small);
+    copy = large;
+    EXPECT_EQ(copy, large);
+    copy = small;
+    EXPECT_EQ(copy, small);
+
+    Vector moved_inline = std::move(small);
+    EXPECT_TRUE(moved_inline.is_inline());
+    EXPECT_TRUE(small.empty());
+
+    const Counted* heap = large.data();
+    Vector moved_heap = std::move(large);
+    EXPECT_EQ(moved_heap.data(), heap); // Heap buffer is stolen
+    EXPECT_TRUE(large.is_inline());
+
+    moved_inline = std::move(moved_heap);
+    EXPECT_EQ(moved_inline.size(), 6u);
+    moved_heap = std::move(copy);
+    EXPECT_EQ(moved_heap, (Vector{1, 2}));
+
+    swap(moved_inline, moved_heap);
+    EXPECT_EQ(moved_inline, (Vector{1, 2}));
+    EXPECT_EQ(moved_heap.size(), 6u);
+}
+
+TEST_F(SmallVector, InsertAndErase)
+{
+    containers::small_vector<int, 4> v = {1, 2, 4};
+
+    auto it = v.insert(v.begin() + 2, 3);
+    EXPECT_EQ(*it, 3);
+    v.insert(v.begin(), 0);
+    v.insert(v.end(), 5);
+    EXPECT_EQ(v, (containers::small_vector<int, 4>{0, 1, 2, 3, 4, 5}));
+
+    it = v.erase(v.begin() + 1);
+    EXPECT_EQ(*it, 2);
+    it = v.erase(v.begin(), v.begin() + 2);
+    EXPECT_EQ(*it, 3);
+    EXPECT_EQ(v, (containers::small_vector<int, 4>{3, 4, 5}));
+
+    v.pop_back();
+    v.clear();
+    EXPECT_TRUE(v.empty());
+}
+
+TEST_F(SmallVector, InsertInTheMiddle)
+{
+    auto values = [](const auto& v) {
+        containers::small_vector<int, 8> out;
+        for (const auto& x: v) {
+            out.push_back(x.value);
+        }
+        return out;
+    };
+    using Ints = containers::small_vector<int, 8>;
+
+    // Shifted in place, then grown around the new element
+    {
+        containers::small_vector<Counted, 4> v = {1, 2, 4};
+        v.insert(v.begin() + 2, Counted{3});
+        EXPECT_TRUE(v.is_inline());
+        v.insert(v.begin() + 1, Counted{-1});
+        EXPECT_FALSE(v.is_inline());
+        EXPECT_EQ(values(v), (Ints{1, -1, 2, 3, 4}));
+        EXPECT_EQ(Counted::live, 5);
+
+        // The inserted value may be an element of the vector
+        v.insert(v.begin(), v.back());
+        v.insert(v.begin() + 2, v[1]);
+        EXPECT_EQ(values(v), (Ints{4, 1, 1, -1, 2, 3, 4}));
+    }
+
+    // Appended and rotated into place
+    {
+        containers::small_vector<ThrowingMove, 4> v = {1, 2, 4};
+        v.insert(v.begin() + 2, ThrowingMove{3});
+        v.insert(v.begin() + 1, ThrowingMove{-1});
+        v.insert(v.begin(), v.back());
+        EXPECT_EQ(values(v), (Ints{4, 1, -1, 2, 3, 4}));
+    }
+}
+
+TEST_F(SmallVector, Comparison)
+{
+    using Vector = containers::small_vector<int, 2>;
+
+    EXPECT_EQ(Vector({1, 2}), Vector({1, 2}));
+    EXPECT_NE(Vector({1, 2}), Vector({1, 2, 3}));
+    EXPECT_LT(Vector({1, 2}), Vector({1, 2, 3}));
+    EXPECT_LT(Vector({1, 2, 3}), Vector({2}));
+    EXPECT_GE(Vector({2}), Vector({1, 2, 3}));
+}
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <testing.hpp>
+
+#include <conceptslib/concepts.hpp>
+#include <conceptslib/containers.hpp>
+
+class SoaVector: public ::testing::Test
+{
+protected:
+    // Keeps track of the number of live objects to detect leaks. Copies
+    // throw once throw_after reaches zero.
+    struct Counted
+    {
+        static inline int live = 0;
+        static inline int throw_after = -1;
+
+        Counted(int v = 0): value{v} { ++live; }
+        Counted(const Counted& other): value{other.value}
+        {
+            if (throw_after >= 0 && throw_after-- == 0) {
+                throw std::runtime_error("copy");
+            }
+            ++live;
+        }
+        Counted& operator=(const Counted&) = default;
+        ~Counted() { --live; }
+
+        friend bool operator==(const Counted& l, const Counted& r)
+        { return l.value == r.value; }
+        friend bool operator!=(const Counted& l, const Counted& r)
+        { return !(l == r); }
+
+        int value;
+    };
+
+    struct Point
+    {
+        int x;
+        double y;
+        std::string name;
+    };
+
+    struct MoveOnly
+    {
+        std::unique_ptr<int> p;
+    };
+
+    struct Record
+    {
+        int id = 7;
+        Counted counted;
+    };
+
+    void SetUp() override
+    {
+        Counted::live = 0;
+        Counted::throw_after = -1;
+    }
+    void TearDown() override { EXPECT_EQ(Counted::live, 0); }
+};
+
+TEST_F(SoaVector, Concepts)
+{
+    using Vector = containers::soa_vector<Point>;
+    using traits::common_reference_t;
+
+    CONCEPT_ASSERT(concepts::Regular<Vector>);
+    CONCEPT_ASSERT(concepts::Movable<containers::soa_vector<MoveOnly>>);
+    CONCEPT_ASSERT(Vector::field_count == 3);
+    CONCEPT_ASSERT(std::is_same_v<Vector::field_type<1>, double>);
+
+    using Ref = Vector::reference;
+    using ConstRef = Vector::const_reference;
+    CONCEPT_ASSERT(std::is_same_v<common_reference_t<Ref, Point&>, Point>);
+    CONCEPT_ASSERT(std::is_same_v<common_reference_t<const Point&, ConstRef>
+                                 ,Point>);
+    CONCEPT_ASSERT(std::is_same_v<common_reference_t<Ref, ConstRef>
+                                 ,ConstRef>);
+    CONCEPT_ASSERT(concepts::CommonReference<Ref, Point&>);
+    CONCEPT_ASSERT(concepts::CommonReference<Ref&&, const Point&>);
+    CONCEPT_ASSERT(concepts::CommonReference<Ref, ConstRef>);
+    CONCEPT_ASSERT(!std::is_assignable_v<ConstRef, Point>);
+}
+
+TEST_F(SoaVector, Layout)
+{
+    containers::soa_vector<Point> v;
+    EXPECT_TRUE(v.empty());
+    for (int i = 0; i < 10; ++i) {
+        v.push_back({i, i / 2., std::to_string(i)});
+    }
+    EXPECT_EQ(v.size(), 10u);
+    EXPECT_GE(v.capacity(), 10u);
+
+    // Each field is an array
+    const int* x = v.data<0>();
+    const double* y = v.data<1>();
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(x[i], i);
+        EXPECT_EQ(y[i], i / 2.);
+        EXPECT_EQ(&v[i].get<0>(), x + i);
+    }
+    EXPECT_EQ(v.data<2>()[3], "3");
+
+    v.emplace_back(10, 5., "10");
+    EXPECT_EQ(v.back().get<2>(), "10");
+    v.pop_back();
+    EXPECT_EQ(v.size(), 10u);
+}
+
+TEST_F(SoaVector, References)
+{
+    containers::soa_vector<Point> v = {{1, 1., "a"}, {2, 2., "b"}};
+
+    Point p = v[0];
+    EXPECT_EQ(p.name, "a");
+
+    // Assignment writes through to the fields
+    v[0] = Point{3, 3., "c"};
+    EXPECT_EQ(v.data<0>()[0], 3);
+    v[1] = v[0];
+    EXPECT_EQ(v.data<2>()[1], "c");
+    v[1].get<1>() = 4.;
+    EXPECT_EQ(v.data<1>()[1], 4.);
+
+    const auto& cv = v;
+    v[0] = cv[1];
+    EXPECT_EQ(v[0], cv[1]);
+    EXPECT_EQ(v[0], (Point{3, 4., "c"}));
+    EXPECT_NE(v[0], p);
+
+    v[0] = p;
+    swap(v[0], v[1]);
+    EXPECT_EQ(v[1], p);
+
+    auto [x, y, name] = v[1].fields();
+    x = 9;
+    EXPECT_EQ(v.data<0>()[1], 9);
+    EXPECT_EQ(name, "a");
+    EXPECT_EQ(y, 1.);
+}
+
+TEST_F(SoaVector, Iterators)
+{
+    containers::soa_vector<Point> v;
+    for (int i : {3, 1, 4, 1, 5, 9, 2, 6}) {
+        v.push_back({i, -i * 1., std::to_string(i)});
+    }
+
+    EXPECT_EQ(v.end() - v.begin(), 8);
+    containers::soa_vector<Point>::const_iterator it = v.begin();
+    EXPECT_EQ(it, v.cbegin());
+    EXPECT_EQ((*(it + 2)).get<0>(), 4);
+    EXPECT_EQ(it[5].get<2>(), "9");
+
+    std::sort(v.begin(), v.end(), [](const Point& l, const Point& r) {
+        return l.x < r.x;
+    });
+    int previous = 0;
+    for (auto element : v) {
+        EXPECT_LE(previous, element.get<0>());
+        EXPECT_EQ(element.get<1>(), -element.get<0>());
+        EXPECT_EQ(element.get<2>(), std::to_string(element.get<0>()));
+        previous = element.get<0>();
+    }
+}
+
+TEST_F(SoaVector, CopyAndMove)
+{
+    using Vector = containers::soa_vector<Record>;
+    {
+        Vector v(3);
+        EXPECT_EQ(v[2].get<0>(), 7); // Default member initializers
+        EXPECT_EQ(Counted::live, 3);
+        v.resize(5, Record{1, Counted{2}});
+        EXPECT_EQ(v[4].get<1>().value, 2);
+
+        Vector copy = v;
+        EXPECT_EQ(copy, v);
+        EXPECT_EQ(Counted::live, 10);
+
+        const Counted* counted = v.data<1>();
+        Vector moved = std::move(v);
+        EXPECT_EQ(moved.data<1>(), counted); // Arrays are stolen
+        EXPECT_TRUE(v.empty());
+
+        v = moved;
+        moved.resize(1);
+        EXPECT_NE(v, moved);
+        swap(v, moved);
+        EXPECT_EQ(v.size(), 1u);
+        v.clear();
+        EXPECT_EQ(Counted::live, 10); // copy and moved
+    }
+    EXPECT_EQ(Counted::live, 0);
+}
+
+TEST_F(SoaVector, StrongExceptionGuarantee)
+{
+    // Counted may throw when copied, so growing copies every field
+    containers::soa_vector<Record> v;
+    v.reserve(2);
+    v.push_back({1, Counted{1}});
+    v.push_back({2, Counted{2}});
+
+    Counted::throw_after = 2;
+    EXPECT_THROW(v.push_back({3, Counted{3}}), std::runtime_error);
+    EXPECT_EQ(v.size(), 2u);
+    EXPECT_EQ(v.capacity(), 2u);
+    EXPECT_EQ(v[1].get<1>().value, 2);
+    EXPECT_EQ(Counted::live, 2);
+
+    Counted::throw_after = -1;
+    v.push_back({3, Counted{3}});
+    EXPECT_EQ(v[2].get<0>(), 3);
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <stdexcept>
+#include <string_view>
+
+#include <testing.hpp>
+
+#include <conceptslib/containers.hpp>
+
+namespace
+{
+using containers::static_map;
+using namespace std::string_view_literals;
+
+constexpr static_map<std::string_view, int, 8> http_methods = {
+    {"GET", 1}, {"POST", 2}, {"PUT", 3}, {"DELETE", 4}, {"GET", 5}};
+
+constexpr static_map<int, char, 16> hex_digits()
+{
+    static_map<int, char, 16> digits;
+    for (int i = 15; i >= 0; --i) {
+        digits[i] = static_cast<char>(i < 10 ? '0' + i : 'a' + i - 10);
+    }
+    digits.insert_or_assign(10, 'A');
+    digits.erase(15);
+    return digits;
+}
+
+} // namespace
+
+TEST(StaticMap, ConstantEvaluation)
+{
+    CONCEPT_ASSERT(http_methods.size() == 4);
+    CONCEPT_ASSERT(http_methods.at("GET"sv) == 1);
+    CONCEPT_ASSERT(http_methods.contains("PUT"sv));
+    CONCEPT_ASSERT(!http_methods.contains("PATCH"sv));
+    // Sorted by key
+    CONCEPT_ASSERT(http_methods.begin()->first == "DELETE"sv);
+
+    constexpr auto digits = hex_digits();
+    CONCEPT_ASSERT(digits.size() == 15);
+    CONCEPT_ASSERT(digits.at(9) == '9');
+    CONCEPT_ASSERT(digits.at(10) == 'A');
+    CONCEPT_ASSERT(digits.count(15) == 0);
+}
+
+TEST(StaticMap, HeterogeneousLookup)
+{
+    // A const char* is looked up without building a string_view key first
+    const char* key = "POST";
+    EXPECT_EQ(http_methods.find(key)->second, 2);
+    EXPECT_TRUE(http_methods.contains("DELETE"));
+    EXPECT_THROW(http_methods.at("PATCH"), std::out_of_range);
+}
+
+TEST(StaticMap, Runtime)
+{
+    static_map<int, int, 2> map;
+    EXPECT_TRUE(map.insert({2, 20}).second);
+    EXPECT_FALSE(map.insert({2, 30}).second);
+    EXPECT_EQ(map.at(2), 20);
+    map[1] = 10;
+    EXPECT_THROW(map[3] = 30, std::length_error);
+    EXPECT_EQ(map.erase(1), 1u);
+    EXPECT_EQ(map.erase(1), 0u);
+    EXPECT_EQ(map, (static_map<int, int, 2>{{2, 20}}));
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <stdexcept>
+#include <string>
+
+#include <testing.hpp>
+
+#include <conceptslib/containers.hpp>
+
+namespace
+{
+using containers::static_vector;
+
+// Squares of 0..n-1, built during constant evaluation
+template<std::size_t N>
+constexpr static_vector<int, N> squares(int n)
+{
+    static_vector<int, N> v;
+    for (int i = 0; i < n; ++i) {
+        v.push_back(i * i);
+    }
+    return v;
+}
+
+constexpr static_vector<int, 8> edited()
+{
+    static_vector<int, 8> v = {1, 2, 4, 5};
+    v.insert(v.begin() + 2, 3);
+    v.insert(v.begin(), v.back());
+    v.erase(v.begin() + 1, v.begin() + 3);
+    v.pop_back();
+    return v;
+}
+
+} // namespace
+
+TEST(StaticVector, ConstantEvaluation)
+{
+    constexpr auto v = squares<16>(10);
+    CONCEPT_ASSERT(v.size() == 10);
+    CONCEPT_ASSERT(v.capacity() == 16);
+    CONCEPT_ASSERT(v[3] == 9 && v.back() == 81 && v.at(9) == 81);
+    CONCEPT_ASSERT(!v.empty() && !v.full());
+
+    constexpr auto e = edited();
+    CONCEPT_ASSERT(e == (static_vector<int, 8>{5, 3, 4}));
+    CONCEPT_ASSERT(e != (static_vector<int, 8>{5, 3}));
+
+    int sum = 0;
+    for (int x: v) {
+        sum += x;
+    }
+    EXPECT_EQ(sum, 285);
+}
+
+TEST(StaticVector, Runtime)
+{
+    static_vector<std::string, 3> v(2, "a");
+    v.emplace_back(3, 'b');
+    EXPECT_TRUE(v.full());
+    EXPECT_EQ(v.back(), "bbb");
+    EXPECT_THROW(v.push_back("c"), std::length_error);
+    EXPECT_THROW(v.at(3), std::out_of_range);
+
+    v.resize(1);
+    EXPECT_EQ(v.size(), 1u);
+    v.resize(3, "z");
+    EXPECT_EQ(v[2], "z");
+    v.clear();
+    EXPECT_TRUE(v.empty());
+}
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <testing.hpp>
+
+#include <conceptslib/concepts.hpp>
+#include <conceptslib/functional.hpp>
+
+namespace
+{
+struct Plus
+{
+    constexpr int operator()(int a, int b) const noexcept { return a + b; }
+};
+
+struct Negate
+{
+    constexpr int operator()(int a) const { return -a; }
+};
+
+// Reports the value category and constness it is called with
+struct Category
+{
+    int operator()() & { return 0; }
+    int operator()() const & { return 1; }
+    int operator()() && { return 2; }
+    int operator()() const && { return 3; }
+};
+
+struct Point
+{
+    int x;
+    int y;
+
+    constexpr int norm1() const { return x + y; }
+};
+
+} // namespace
+
+TEST(FunctionalAdaptors, BindFront)
+{
+    constexpr auto add2 = functional::bind_front(Plus{}, 2);
+    static_assert(add2(3) == 5);
+
+    auto concat = functional::bind_front(std::plus<std::string>{},
+                                         std::string("a"));
+    EXPECT_EQ(concat("b"), "ab");
+
+    // Pointers to members are invoked through functional::invoke
+    const Point p{1, 2};
+    EXPECT_EQ(functional::bind_front(&Point::norm1, p)(), 3);
+    EXPECT_EQ(functional::bind_front(&Point::y)(&p), 2);
+
+    // Arguments are decayed copies: the bound value does not dangle
+    auto bound = [] {
+        std::string s = "abc";
+        return functional::bind_front(
+            [](const std::string& s, std::size_t i) { return s[i]; }, s);
+    }();
+    EXPECT_EQ(bound(1), 'b');
+}
+
+TEST(FunctionalAdaptors, Compose)
+{
+    constexpr auto negate_sum = functional::compose(Negate{}, Plus{});
+    static_assert(negate_sum(1, 2) == -3);
+
+    auto f = functional::compose([](int x) { return x * 10; },
+                                 [](int x) { return x + 1; },
+                                 [](int x) { return x * 2; });
+    EXPECT_EQ(f(3), 70);
+
+    auto length = functional::compose(&std::string::size,
+                                      [](std::string s) { return s + s; });
+    EXPECT_EQ(length("abc"), 6u);
+}
+
+TEST(FunctionalAdaptors, Projected)
+{
+    constexpr auto sum_x = functional::projected(Plus{}, &Point::x);
+    static_assert(sum_x(Point{1, 2}, Point{3, 4}) == 4);
+
+    auto less_by_norm = functional::projected(std::less<>{}, &Point::norm1);
+    EXPECT_TRUE(less_by_norm(Point{1, 1}, Point{0, 3}));
+    EXPECT_FALSE(less_by_norm(Point{2, 2}, Point{0, 3}));
+}
+
+TEST(FunctionalAdaptors, EmptyCallablesTakeNoSpace)
+{
+    auto lambda = [](int a, int b) { return a * b; };
+
+    // An adaptor of empty callables has the minimum size of an object
+    EXPECT_EQ(sizeof(functional::bind_front(Plus{})), 1u);
+    EXPECT_EQ(sizeof(functional::bind_front(lambda)), 1u);
+    EXPECT_EQ(sizeof(functional::bind_front(Plus{}, 1)), sizeof(int));
+    EXPECT_EQ(sizeof(functional::bind_front(lambda, 1, 2)), 2 * sizeof(int));
+    EXPECT_EQ(sizeof(functional::compose(Negate{}, lambda)), 1u);
+    EXPECT_EQ(sizeof(functional::compose(Negate{}, lambda, Plus{})), 1u);
+    EXPECT_EQ(sizeof(functional::compose(
+                  Negate{}, functional::bind_front(lambda, 1))),
+              sizeof(int));
+    EXPECT_EQ(sizeof(functional::projected(Plus{}, &Point::x)),
+              sizeof(&Point::x));
+    EXPECT_TRUE((std::is_trivially_copyable_v<
+        decltype(functional::bind_front(Plus{}, 1))>));
+
+    // Only the captures take space
+    auto capture = [n = 1](int a) { return a + n; };
+    EXPECT_EQ(sizeof(functional::compose(capture, Negate{})), sizeof(int));
+}
+
+TEST(FunctionalAdaptors, ValueCategory)
+{
+    auto f = functional::bind_front(Category{});
+    const auto cf = functional::bind_front(Category{});
+    EXPECT_EQ(f(), 0);
+    EXPECT_EQ(cf(), 1);
+    EXPECT_EQ(std::move(f)(), 2);
+    EXPECT_EQ(std::move(cf)(), 3);
+
+    auto g = functional::compose(Negate{}, Category{});
+    EXPECT_EQ(g(), 0);
+    EXPECT_EQ(std::as_const(g)(), -1);
+    EXPECT_EQ(std::move(g)(), -2);
+
+    // Bound arguments are moved out of an rvalue adaptor
+    auto sink = functional::bind_front(
+        [](std::unique_ptr<int> p) { return *p; }, std::make_unique<int>(7));
+    EXPECT_EQ(std::move(sink)(), 7);
+}
+
+TEST(FunctionalAdaptors, Constraints)
+{
+    auto add = functional::bind_front(Plus{}, 1);
+    using Add = decltype(add);
+    CONCEPT_ASSERT(concepts::Invocable<Add&, int>);
+    CONCEPT_ASSERT(!concepts::Invocable<Add&>);
+    CONCEPT_ASSERT(!concepts::Invocable<Add&, std::string>);
+
+    using Composed = decltype(functional::compose(Negate{}, Plus{}));
+    CONCEPT_ASSERT(concepts::Invocable<Composed, int, int>);
+    CONCEPT_ASSERT(!concepts::Invocable<Composed, int>);
+
+    using Projected = decltype(functional::projected(Plus{}, &Point::x));
+    CONCEPT_ASSERT(concepts::Invocable<Projected, Point, Point>);
+    CONCEPT_ASSERT(!concepts::Invocable<Projected, int, int>);
+
+    // Move only bound arguments can only be used by an rvalue adaptor
+    auto sink = functional::bind_front(
+        [](std::unique_ptr<int> p) { return *p; }, std::make_unique<int>(7));
+    using Sink = decltype(sink);
+    CONCEPT_ASSERT(concepts::Invocable<Sink>);
+    CONCEPT_ASSERT(!concepts::Invocable<Sink&>);
+}
+
+TEST(FunctionalAdaptors, Noexcept)
+{
+    auto add = functional::bind_front(Plus{}, 1);
+    EXPECT_TRUE(noexcept(add(2)));
+
+    auto negate = functional::bind_front(Negate{});
+    EXPECT_FALSE(noexcept(negate(2)));
+
+    auto negate_sum = functional::compose(Negate{}, Plus{});
+    EXPECT_FALSE(noexcept(negate_sum(1, 2)));
+
+    auto sum_x = functional::projected(Plus{}, &Point::x);
+    EXPECT_TRUE(noexcept(sum_x(Point{}, Point{})));
+}
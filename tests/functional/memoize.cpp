@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <testing.hpp>
+
+#include <conceptslib/functional.hpp>
+
+namespace
+{
+// Counts its calls: equality preserving, since the count is not observable
+// through the result
+struct Square
+{
+    int* calls;
+
+    int operator()(int x) const
+    {
+        ++*calls;
+        return x * x;
+    }
+};
+
+struct Repeat
+{
+    int* calls;
+
+    std::string operator()(const std::string& s, int n) const
+    {
+        ++*calls;
+        std::string result;
+        for (int i = 0; i < n; ++i) {
+            result += s;
+        }
+        return result;
+    }
+};
+
+// Its copies throw while throw_copies is set
+struct Fussy
+{
+    static inline bool throw_copies = false;
+
+    int value = 0;
+
+    Fussy() = default;
+    explicit Fussy(int v): value{v} { }
+
+    Fussy(const Fussy& other): value{other.value}
+    {
+        if (throw_copies) {
+            throw std::bad_alloc();
+        }
+    }
+
+    Fussy& operator=(const Fussy& other)
+    {
+        if (throw_copies) {
+            throw std::bad_alloc();
+        }
+        value = other.value;
+        return *this;
+    }
+
+    friend bool operator==(const Fussy& a, const Fussy& b)
+    { return a.value == b.value; }
+    friend bool operator!=(const Fussy& a, const Fussy& b)
+    { return a.value != b.value; }
+};
+
+struct FussySquare
+{
+    int* calls;
+
+    int operator()(const Fussy& x) const
+    {
+        ++*calls;
+        return x.value * x.value;
+    }
+};
+
+struct AtomicSquare
+{
+    std::atomic<int>* calls;
+
+    long operator()(int x) const
+    {
+        ++*calls;
+        return static_cast<long>(x) * x;
+    }
+};
+
+} // namespace
+
+template<>
+struct std::hash<Fussy>
+{
+    std::size_t operator()(const Fussy& x) const noexcept
+    {
+        return std::hash<int>{}(x.value);
+    }
+};
+
+TEST(Memoize, CachesResults)
+{
+    int calls = 0;
+    auto square = functional::make_memoize<8, int>(Square{&calls});
+
+    EXPECT_EQ(square(3), 9);
+    EXPECT_EQ(square(3), 9);
+    EXPECT_EQ(square(4), 16);
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(square.hits(), 1u);
+    EXPECT_EQ(square.misses(), 2u);
+    EXPECT_EQ(square.size(), 2u);
+    EXPECT_EQ(square.capacity(), 8u);
+
+    square.clear();
+    EXPECT_EQ(square.size(), 0u);
+    EXPECT_EQ(square(3), 9);
+    EXPECT_EQ(calls, 3);
+}
+
+TEST(Memoize, SeveralArguments)
+{
+    int calls = 0;
+    functional::memoize<Repeat, 4, std::string, int> repeat(Repeat{&calls});
+
+    EXPECT_EQ(repeat("ab", 2), "abab");
+    EXPECT_EQ(repeat("ab", 3), "ababab");
+    EXPECT_EQ(repeat("ab", 2), "abab");
+    EXPECT_EQ(repeat("a", 2), "aa");
+    EXPECT_EQ(calls, 3);
+}
+
+TEST(Memoize, EvictsWithClock)
+{
+    int calls = 0;
+    auto square = functional::make_memoize<2, int>(Square{&calls});
+
+    square(1);
+    square(2);
+    EXPECT_EQ(square(1), 1); // Marks 1 as referenced
+    EXPECT_EQ(calls, 2);
+
+    // The hand clears the bit of 1 and evicts 2
+    square(3);
+    EXPECT_EQ(square.size(), 2u);
+    EXPECT_EQ(calls, 3);
+    square(1);
+    EXPECT_EQ(calls, 3);
+    square(2);
+    EXPECT_EQ(calls, 4);
+}
+
+TEST(Memoize, StaysConsistentUnderEviction)
+{
+    int calls = 0;
+    auto square = functional::make_memoize<16, int>(Square{&calls});
+
+    for (int round = 0; round < 4; ++round) {
+        for (int i = 0; i < 200; ++i) {
+            const int x = (i * 37 + round) % 53;
+            EXPECT_EQ(square(x), x * x);
+        }
+    }
+    EXPECT_EQ(square.size(), 16u);
+    EXPECT_EQ(square.hits() + square.misses(), 800u);
+}
+
+TEST(Memoize, NothingCachedWhenTheFunctionThrows)
+{
+    int calls = 0;
+    auto checked = functional::make_memoize<4, int>([&calls](int x) {
+        ++calls;
+        if (x < 0) {
+            throw std::domain_error("negative");
+        }
+        return x;
+    });
+
+    EXPECT_THROW(checked(-1), std::domain_error);
+    EXPECT_EQ(checked.size(), 0u);
+    EXPECT_THROW(checked(-1), std::domain_error);
+    EXPECT_EQ(calls, 2);
+    EXPECT_EQ(checked(1), 1);
+}
+
+TEST(Memoize, ThrowingArgumentCopies)
+{
+    int calls = 0;
+    auto square = functional::make_memoize<2, Fussy>(FussySquare{&calls});
+
+    // Growing: nothing is cached
+    Fussy::throw_copies = true;
+    EXPECT_THROW(square(Fussy{1}), std::bad_alloc);
+    Fussy::throw_copies = false;
+    EXPECT_EQ(square.size(), 0u);
+
+    // Full: the entry the hand points to stays cached
+    EXPECT_EQ(square(Fussy{1}), 1);
+    EXPECT_EQ(square(Fussy{2}), 4);
+    Fussy::throw_copies = true;
+    EXPECT_THROW(square(Fussy{3}), std::bad_alloc);
+    Fussy::throw_copies = false;
+    EXPECT_EQ(square.size(), 2u);
+
+    // Later evictions find the bucket of every entry
+    EXPECT_EQ(square(Fussy{4}), 16);
+    EXPECT_EQ(square(Fussy{5}), 25);
+    EXPECT_EQ(square(Fussy{5}), 25);
+    EXPECT_EQ(calls, 6);
+}
+
+TEST(ShardedMemoize, CachesResults)
+{
+    std::atomic<int> calls{0};
+    functional::sharded_memoize<AtomicSquare, 64, 4, int> square(
+        AtomicSquare{&calls});
+
+    EXPECT_EQ(square.capacity(), 64u);
+    EXPECT_EQ(square(5), 25);
+    EXPECT_EQ(square(5), 25);
+    EXPECT_EQ(calls.load(), 1);
+    EXPECT_EQ(square.hits(), 1u);
+    EXPECT_EQ(square.misses(), 1u);
+    EXPECT_EQ(square.size(), 1u);
+}
+
+TEST(ShardedMemoize, MakeShardedMemoize)
+{
+    std::atomic<int> calls{0};
+    auto square = functional::make_sharded_memoize<32, 2, int>(
+        AtomicSquare{&calls});
+    EXPECT_EQ(square(3), 9);
+    EXPECT_EQ(square(3), 9);
+
+    // The counters can be read through a const reference
+    const auto& view = square;
+    EXPECT_EQ(view.capacity(), 32u);
+    EXPECT_EQ(view.size(), 1u);
+    EXPECT_EQ(view.hits(), 1u);
+    EXPECT_EQ(view.misses(), 1u);
+    EXPECT_EQ(calls.load(), 1);
+}
+
+TEST(ShardedMemoize, ConcurrentCalls)
+{
+    std::atomic<int> calls{0};
+    functional::sharded_memoize<AtomicSquare, 256, 8, int> square(
+        AtomicSquare{&calls});
+
+    std::vector<std::thread> threads;
+    std::atomic<int> errors{0};
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&square, &errors, t] {
+            for (int i = 0; i < 2000; ++i) {
+                const int x = (i * 7 + t) % 100;
+                if (square(x) != static_cast<long>(x) * x) {
+                    ++errors;
+                }
+            }
+        });
+    }
+    for (std::thread& thread: threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(errors.load(), 0);
+    EXPECT_EQ(square.hits() + square.misses(), 8000u);
+    EXPECT_LE(square.size(), 100u);
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include <testing.hpp>
+
+#include <conceptslib/numeric.hpp>
+
+namespace
+{
+template<class L, class R>
+using sum_t = decltype(std::declval<L>() + std::declval<R>());
+
+template<class L, class R>
+using quotient_t = decltype(std::declval<L>() / std::declval<R>());
+
+// Arithmetic but not a Field
+struct Ring
+{
+    int value;
+
+    Ring& operator+=(const Ring& r) { value += r.value; return *this; }
+    Ring& operator-=(const Ring& r) { value -= r.value; return *this; }
+    Ring& operator*=(const Ring& r) { value *= r.value; return *this; }
+
+    friend Ring operator+(Ring l, const Ring& r) { return l += r; }
+    friend Ring operator-(Ring l, const Ring& r) { return l -= r; }
+    friend Ring operator*(Ring l, const Ring& r) { return l *= r; }
+};
+
+} // namespace
+
+TEST(NumericExpression, FusedEvaluation)
+{
+    const numeric::array<double> b = {1, 2, 3, 4};
+    const numeric::array<double> c = {2, 2, 2, 2};
+    const numeric::array<double> d = {0, 1, 0, 1};
+    const numeric::array<double> e = {5, 6, 7, 8};
+
+    numeric::array<double> a = b * c + d * e;
+    EXPECT_EQ(a, (numeric::array<double>{2, 10, 6, 16}));
+
+    a = (a - b) / c;
+    EXPECT_EQ(a, (numeric::array<double>{.5, 4, 1.5, 6}));
+
+    a = -a;
+    EXPECT_EQ(a, (numeric::array<double>{-.5, -4, -1.5, -6}));
+}
+
+TEST(NumericExpression, LazyUntilAssigned)
+{
+    const numeric::array<int> b = {1, 2, 3};
+    const numeric::array<int> c = {4, 5, 6};
+
+    auto expr = b * c + 1;
+    CONCEPT_ASSERT(!std::is_same_v<decltype(expr), numeric::array<int>>);
+    EXPECT_EQ(expr.size(), 3u);
+    EXPECT_EQ(expr[1], 11);
+    EXPECT_EQ(numeric::eval(expr), (numeric::array<int>{5, 11, 19}));
+}
+
+TEST(NumericExpression, Scalars)
+{
+    const numeric::array<int> b = {1, 2, 3};
+
+    EXPECT_EQ(numeric::array<int>(2 * b), (numeric::array<int>{2, 4, 6}));
+    EXPECT_EQ(numeric::array<int>(b * 2), (numeric::array<int>{2, 4, 6}));
+    EXPECT_EQ(numeric::array<int>(10 - b), (numeric::array<int>{9, 8, 7}));
+}
+
+TEST(NumericExpression, CompoundAssignment)
+{
+    numeric::array<int> a = {1, 2, 3};
+    const numeric::array<int> b = {4, 5, 6};
+
+    a += b * b;
+    EXPECT_EQ(a, (numeric::array<int>{17, 27, 39}));
+    a -= b;
+    EXPECT_EQ(a, (numeric::array<int>{13, 22, 33}));
+    a *= b - 3;
+    EXPECT_EQ(a, (numeric::array<int>{13, 44, 99}));
+}
+
+TEST(NumericExpression, MismatchedSizes)
+{
+    numeric::array<int> a = {1, 2, 3};
+    const numeric::array<int> b = {4, 5};
+
+    EXPECT_THROW(a + b, std::length_error);
+    EXPECT_THROW(2 * a - b * 3, std::length_error);
+    EXPECT_THROW(a += b, std::length_error);
+    EXPECT_EQ(a, (numeric::array<int>{1, 2, 3}));
+
+    // Scalars are broadcast to any size
+    EXPECT_EQ(numeric::array<int>(b + 1), (numeric::array<int>{5, 6}));
+}
+
+TEST(NumericExpression, Aliasing)
+{
+    numeric::array<int> a = {1, 2, 3};
+
+    a = a * a + a;
+    EXPECT_EQ(a, (numeric::array<int>{2, 6, 12}));
+
+    numeric::array<int> empty;
+    empty = a + a;
+    EXPECT_EQ(empty, (numeric::array<int>{4, 12, 24}));
+}
+
+TEST(NumericExpression, CommonType)
+{
+    const numeric::array<int> i = {1, 2, 3};
+    const numeric::array<float> f = {.5f, .5f, .5f};
+    const numeric::array<double> d = {.25, .25, .25};
+
+    CONCEPT_ASSERT(std::is_same_v<decltype(i * f)::value_type, float>);
+    CONCEPT_ASSERT(std::is_same_v<decltype(i * f + d)::value_type, double>);
+    CONCEPT_ASSERT(std::is_same_v<decltype(i * 2.)::value_type, double>);
+
+    EXPECT_EQ(numeric::eval(i * f + d),
+              (numeric::array<double>{.75, 1.25, 1.75}));
+
+    // Narrowing happens on assignment only
+    numeric::array<int> narrowed = i * f;
+    EXPECT_EQ(narrowed, (numeric::array<int>{0, 1, 1}));
+}
+
+TEST(NumericExpression, Constraints)
+{
+    using numeric::array;
+
+    CONCEPT_ASSERT(concepts::exists<sum_t, array<int>, array<double>>);
+    CONCEPT_ASSERT(concepts::exists<sum_t, array<int>, int>);
+    CONCEPT_ASSERT(concepts::exists<sum_t, double, array<int>>);
+    CONCEPT_ASSERT(concepts::exists<sum_t, array<Ring>, array<Ring>>);
+
+    CONCEPT_ASSERT(!concepts::exists<sum_t, array<int>, std::string>);
+    CONCEPT_ASSERT(!concepts::exists<sum_t, array<int>, array<Ring>>);
+
+    CONCEPT_ASSERT(concepts::exists<quotient_t, array<double>, array<int>>);
+    CONCEPT_ASSERT(!concepts::exists<quotient_t, array<Ring>, array<Ring>>);
+}
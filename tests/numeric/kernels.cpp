@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstdint>
+#include <vector>
+
+#include <testing.hpp>
+
+#include <conceptslib/numeric.hpp>
+
+namespace
+{
+// User type satisfying Arithmetic: processed by the scalar fallback
+struct Real
+{
+    Real() = default;
+    Real(double v): value{v} { }
+
+    double value;
+
+    Real& operator+=(const Real& r) { value += r.value; return *this; }
+    Real& operator-=(const Real& r) { value -= r.value; return *this; }
+    Real& operator*=(const Real& r) { value *= r.value; return *this; }
+
+    friend Real operator+(Real l, const Real& r) { return l += r; }
+    friend Real operator-(Real l, const Real& r) { return l -= r; }
+    friend Real operator*(Real l, const Real& r) { return l *= r; }
+
+    friend bool operator==(const Real& l, const Real& r)
+    { return l.value == r.value; }
+    friend bool operator!=(const Real& l, const Real& r) { return !(l == r); }
+    friend bool operator<(const Real& l, const Real& r)
+    { return l.value < r.value; }
+    friend bool operator>(const Real& l, const Real& r) { return r < l; }
+    friend bool operator<=(const Real& l, const Real& r) { return !(r < l); }
+    friend bool operator>=(const Real& l, const Real& r) { return !(l < r); }
+};
+
+// Small integers keep every result exact regardless of summation order
+template<class T>
+std::vector<T> make_sequence(std::size_t n, int offset = 0)
+{
+    std::vector<T> v(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        v[i] = T(static_cast<int>((i * 7 + offset) % 23) - 11);
+    }
+    return v;
+}
+
+// Sizes around multiples of the widest pack exercise the scalar remainders
+constexpr std::size_t sizes[] = {0, 1, 3, 7, 8, 15, 16, 17, 31, 64, 67, 1000};
+
+} // namespace
+
+template<class T>
+class NumericKernels: public ::testing::Test
+{ };
+
+using KernelTypes =
+    ::testing::Types<std::int8_t, int, std::int64_t, unsigned, float, double,
+                     Real>;
+TYPED_TEST_SUITE(NumericKernels, KernelTypes);
+
+TEST(NumericSimd, Vectorizable)
+{
+    using numeric::simd::is_vectorizable_v;
+
+    CONCEPT_ASSERT(is_vectorizable_v<int> == SUPPORTS_VECTOR_EXTENSIONS);
+    CONCEPT_ASSERT(is_vectorizable_v<double> == SUPPORTS_VECTOR_EXTENSIONS);
+    CONCEPT_ASSERT(!is_vectorizable_v<bool>);
+    CONCEPT_ASSERT(!is_vectorizable_v<long double>);
+    CONCEPT_ASSERT(!is_vectorizable_v<Real>);
+}
+
+TYPED_TEST(NumericKernels, Axpy)
+{
+    using T = TypeParam;
+    for (auto n: sizes) {
+        auto x = make_sequence<T>(n);
+        auto y = make_sequence<T>(n, 5);
+        auto expected = y;
+        for (std::size_t i = 0; i < n; ++i) {
+            expected[i] += T(3) * x[i];
+        }
+        numeric::axpy(T(3), x.data(), y.data(), n);
+        EXPECT_EQ(y, expected) << "n = " << n;
+    }
+}
+
+TYPED_TEST(NumericKernels, SumAndDot)
+{
+    using T = TypeParam;
+    for (auto n: sizes) {
+        auto x = make_sequence<T>(n);
+        auto y = make_sequence<T>(n, 5);
+        T sum{};
+        T dot{};
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += x[i];
+            dot += x[i] * y[i];
+        }
+        EXPECT_EQ(numeric::sum(x.data(), n), sum) << "n = " << n;
+        EXPECT_EQ(numeric::dot(x.data(), y.data(), n), dot) << "n = " << n;
+    }
+}
+
+TYPED_TEST(NumericKernels, MinMax)
+{
+    using T = TypeParam;
+    for (auto n: sizes) {
+        if (n == 0) {
+            continue;
+        }
+        auto x = make_sequence<T>(n, 3);
+        T min = x[0];
+        T max = x[0];
+        for (const auto& value: x) {
+            min = value < min ? value : min;
+            max = max < value ? value : max;
+        }
+        EXPECT_EQ(numeric::min(x.data(), n), min) << "n = " << n;
+        EXPECT_EQ(numeric::max(x.data(), n), max) << "n = " << n;
+    }
+}
+
+TYPED_TEST(NumericKernels, Map)
+{
+    using T = TypeParam;
+    const auto square = [](const auto& v) { return v * v; };
+    for (auto n: sizes) {
+        auto x = make_sequence<T>(n);
+        std::vector<T> expected(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            expected[i] = x[i] * x[i];
+        }
+
+        std::vector<T> scalar(n);
+        numeric::map(x.data(), scalar.data(), n, square);
+        EXPECT_EQ(scalar, expected) << "n = " << n;
+
+        std::vector<T> lanewise(n);
+        numeric::map(x.data(), lanewise.data(), n, numeric::lanewise(square));
+        EXPECT_EQ(lanewise, expected) << "n = " << n;
+    }
+}
+
+TEST(NumericMap, ConvertsResult)
+{
+    const std::vector<int> x = {1, 2, 3, 4, 5};
+    std::vector<double> out(x.size());
+    numeric::map(x.data(), out.data(), x.size(), [](int i) { return i / 2.; });
+    EXPECT_EQ(out, (std::vector<double>{.5, 1., 1.5, 2., 2.5}));
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ *
+ * Symbol audit probe: uses concepts, requirements and detectors in constant
+ * expressions, at run time and by reference. symbol_audit.cmake checks that
+ * the object file carries no internal copy of them.
+ */
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <conceptslib/concepts.hpp>
+#include <conceptslib/type_traits.hpp>
+
+struct Widget
+{
+    int id;
+
+    friend bool operator==(const Widget& a, const Widget& b)
+    { return a.id == b.id; }
+    friend bool operator!=(const Widget& a, const Widget& b)
+    { return a.id != b.id; }
+};
+
+static_assert(concepts::Regular<Widget>);
+static_assert(!concepts::StrictTotallyOrdered<Widget>);
+static_assert(concepts::Invocable<std::plus<>, int, int>);
+static_assert(std::is_same_v<traits::common_reference_t<int&, const int&>,
+                             const int&>);
+
+bool by_value()
+{
+    return concepts::Semiregular<std::string> &&
+           concepts::StrictTotallyOrdered<std::vector<int>> &&
+           concepts::Hashable<std::string>;
+}
+
+bool check(const bool& b)
+{
+    return b;
+}
+
+// Binding a reference odr-uses the variables: they are emitted, but merged
+bool by_reference()
+{
+    return check(concepts::Movable<Widget>) &&
+           check(traits::is_detected_v<traits::common_reference_t,
+                                       Widget&, const Widget&>);
+}
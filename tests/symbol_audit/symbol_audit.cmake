@@ -0,0 +1,95 @@
+# Copyright (c) Nuno Alves de Sousa 2019
+#
+# Use, modification and distribution is subject to the Boost Software License,
+# Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+# http://www.boost.org/LICENSE_1_0.txt)
+#
+# Symbol audit: compiles each of the SOURCES (separated by commas) to an
+# object file in OUTPUT_DIR, and prints its size, its number of symbols, those
+# of them which name an entity of the concepts or traits namespaces, and the
+# size of its DWARF sections.
+#
+# Library symbols with internal linkage are copies which every object file
+# carries: concepts, requirements and detectors are inline variables, so that
+# they are only emitted when they are odr-used, as COMDAT symbols which the
+# linker merges. The exception are their instantiations for types without
+# external linkage, such as local classes and closure types: those are
+# counted apart. With -DSTRICT=ON the
+# audit fails when an object file has any other internal copy.
+#
+# Usage: cmake -DCOMPILER=<c++> -DFLAGS=<flags> -DSOURCES=<file,...>
+#              -DOUTPUT_DIR=<dir> -DNM=<nm> -DSIZE=<size> [-DSTRICT=ON]
+#              -P symbol_audit.cmake
+cmake_minimum_required(VERSION 3.14) # file(SIZE)
+
+separate_arguments(FLAGS UNIX_COMMAND "${FLAGS}")
+string(REPLACE "," ";" SOURCES "${SOURCES}")
+file(MAKE_DIRECTORY ${OUTPUT_DIR})
+
+message(STATUS "object bytes / symbols / library symbols / internal copies /"
+               " copies for local types / DWARF bytes")
+set(failures 0)
+foreach(source IN LISTS SOURCES)
+    get_filename_component(directory ${source} DIRECTORY)
+    get_filename_component(area ${directory} NAME)
+    get_filename_component(name ${source} NAME_WE)
+    set(object ${OUTPUT_DIR}/${area}_${name}.o)
+    execute_process(COMMAND ${COMPILER} ${FLAGS} -c ${source} -o ${object}
+                    RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Compiling ${source} failed")
+    endif()
+
+    execute_process(COMMAND ${NM} -C ${object} OUTPUT_VARIABLE symbols)
+    string(REGEX REPLACE "\n$" "" symbols "${symbols}")
+    string(REPLACE ";" "\;" symbols "${symbols}")
+    string(REPLACE "\n" ";" symbols "${symbols}")
+    list(LENGTH symbols total)
+    set(library 0)
+    set(copies 0)
+    set(local_copies 0)
+    set(examples)
+    foreach(symbol IN LISTS symbols)
+        if(NOT symbol MATCHES "^[0-9a-f ]+ (.) (.*)$")
+            continue()
+        endif()
+        set(kind ${CMAKE_MATCH_1})
+        set(entity "${CMAKE_MATCH_2}")
+        set(library_entity
+            "^(std::experimental::[a-z_0-9]+::)?(concepts|traits)::")
+        if(NOT entity MATCHES "${library_entity}")
+            continue()
+        endif()
+        math(EXPR library "${library} + 1")
+        if(kind MATCHES "^[bdrt]$")
+            if(entity MATCHES "\\(\\)::|\\{lambda\\(|\\(anonymous namespace\\)")
+                math(EXPR local_copies "${local_copies} + 1")
+            else()
+                math(EXPR copies "${copies} + 1")
+                list(APPEND examples "${entity}")
+            endif()
+        endif()
+    endforeach()
+
+    file(SIZE ${object} bytes)
+    execute_process(COMMAND ${SIZE} -A ${object} OUTPUT_VARIABLE sections)
+    string(REGEX MATCHALL "\n\\.debug_[a-z_]+ +[0-9]+" debug "${sections}")
+    set(dwarf 0)
+    foreach(section IN LISTS debug)
+        string(REGEX REPLACE ".* " "" section_bytes "${section}")
+        math(EXPR dwarf "${dwarf} + ${section_bytes}")
+    endforeach()
+
+    message(STATUS "${area}/${name}: ${bytes} / ${total} / ${library} / "
+                   "${copies} / ${local_copies} / ${dwarf}")
+    if(copies GREATER 0)
+        list(GET examples 0 example)
+        message(STATUS "  internal copy: ${example}")
+        math(EXPR failures "${failures} + 1")
+    endif()
+endforeach()
+
+if(STRICT AND failures GREATER 0)
+    message(FATAL_ERROR "${failures} object files carry internal copies of "
+                        "library variables")
+endif()
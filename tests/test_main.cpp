@@ -1,22 +1,14 @@
-#include <iostream>
-
-#include <gtest/gtest.h>
-
-class ConceptFixture: public testing::Test
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <testing.hpp>
+
+int main(int argc, char* argv[])
 {
-
-};
-
-TEST_F(ConceptFixture, test_eq) {
-    EXPECT_EQ(0, 0);
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
 }
-
-TEST_F(ConceptFixture, test_eq2) {
-    EXPECT_EQ(1, 1);
-}
-
-//int main (int argc, char* argv[])
-//{
-//    ::testing::InitGoogleTest(&argc, argv);
-//    return RUN_ALL_TESTS();
-//}
\ No newline at end of file
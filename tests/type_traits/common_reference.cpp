@@ -7,7 +7,7 @@
  */
 #include <type_traits>
 
-#include <gtest/gtest.h>
+#include <testing.hpp>
 
 #include <conceptslib/type_traits.hpp>
 
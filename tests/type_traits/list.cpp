@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <testing.hpp>
+
+#include <conceptslib/type_traits.hpp>
+
+namespace
+{
+template<class T>
+struct size_of: std::integral_constant<std::size_t, sizeof(T)> { };
+
+template<std::size_t N>
+struct bytes
+{
+    char data[N];
+};
+
+// List of 300 types, so that every algorithm runs over a long pack
+template<class Is>
+struct long_list_imp;
+
+template<std::size_t... Is>
+struct long_list_imp<std::index_sequence<Is...>>
+{
+    using type = traits::list<bytes<Is % 7 + 1>...>;
+};
+
+using long_list = long_list_imp<std::make_index_sequence<300>>::type;
+
+} // namespace
+
+TEST(TypeList, AtIndexOfContains)
+{
+    using traits::list;
+    using L = list<int, char, int, double>;
+
+    CONCEPT_ASSERT(L::size == 4);
+    CONCEPT_ASSERT(std::is_same_v<traits::at_t<L, 0>, int>);
+    CONCEPT_ASSERT(std::is_same_v<traits::at_t<L, 3>, double>);
+    CONCEPT_ASSERT(std::is_same_v<traits::at_t<list<int&, const int>, 1>,
+                                  const int>);
+
+    CONCEPT_ASSERT(traits::index_of_v<L, int> == 0);
+    CONCEPT_ASSERT(traits::index_of_v<L, double> == 3);
+    CONCEPT_ASSERT(traits::index_of_v<L, float> == 4);
+    CONCEPT_ASSERT(traits::index_of_v<list<>, int> == 0);
+
+    CONCEPT_ASSERT(traits::contains_v<L, char>);
+    CONCEPT_ASSERT(!traits::contains_v<L, const char>);
+    CONCEPT_ASSERT(!traits::contains_v<list<>, int>);
+
+    CONCEPT_ASSERT(std::is_same_v<traits::at_t<long_list, 299>,
+                                  bytes<299 % 7 + 1>>);
+    CONCEPT_ASSERT(traits::index_of_v<long_list, bytes<7>> == 6);
+}
+
+TEST(TypeList, FilterPartitionTransform)
+{
+    using traits::list;
+    using L = list<int, char*, long, void, int*>;
+
+    CONCEPT_ASSERT(std::is_same_v<traits::filter_t<L, std::is_pointer>,
+                                  list<char*, int*>>);
+    CONCEPT_ASSERT(std::is_same_v<traits::filter_t<L, std::is_class>,
+                                  list<>>);
+    CONCEPT_ASSERT(std::is_same_v<traits::filter_t<list<>, std::is_class>,
+                                  list<>>);
+
+    using parts = traits::partition<L, std::is_integral>;
+    CONCEPT_ASSERT(std::is_same_v<parts::selected, list<int, long>>);
+    CONCEPT_ASSERT(std::is_same_v<parts::rejected, list<char*, void, int*>>);
+
+    CONCEPT_ASSERT(std::is_same_v<
+        traits::transform_t<list<int, const char>, std::add_pointer_t>,
+        list<int*, const char*>>);
+    CONCEPT_ASSERT(std::is_same_v<
+        traits::transform_t<list<>, std::add_pointer_t>, list<>>);
+
+    using big = traits::filter_t<long_list, std::is_empty>;
+    CONCEPT_ASSERT(big::size == 0);
+    using parts_of_long = traits::partition<long_list, std::is_trivial>;
+    CONCEPT_ASSERT(parts_of_long::selected::size == 300);
+}
+
+TEST(TypeList, UniqueSortBy)
+{
+    using traits::list;
+
+    CONCEPT_ASSERT(std::is_same_v<
+        traits::unique_t<list<int, char, int, int, double, char>>,
+        list<int, char, double>>);
+    CONCEPT_ASSERT(std::is_same_v<traits::unique_t<list<>>, list<>>);
+    // Distinct qualified types are kept
+    CONCEPT_ASSERT(std::is_same_v<traits::unique_t<list<int, const int, int&>>,
+                                  list<int, const int, int&>>);
+
+    // Stable: types of the same size keep their order
+    CONCEPT_ASSERT(std::is_same_v<
+        traits::sort_by_t<list<double, char, int, bool, float>, size_of>,
+        list<char, bool, int, float, double>>);
+    CONCEPT_ASSERT(std::is_same_v<traits::sort_by_t<list<>, size_of>,
+                                  list<>>);
+
+    using distinct = traits::unique_t<long_list>;
+    CONCEPT_ASSERT(std::is_same_v<distinct,
+                                  list<bytes<1>, bytes<2>, bytes<3>, bytes<4>,
+                                       bytes<5>, bytes<6>, bytes<7>>>);
+    using sorted = traits::sort_by_t<long_list, size_of>;
+    CONCEPT_ASSERT(std::is_same_v<traits::at_t<sorted, 0>, bytes<1>>);
+    CONCEPT_ASSERT(std::is_same_v<traits::at_t<sorted, 299>, bytes<7>>);
+    CONCEPT_ASSERT(traits::index_of_v<sorted, bytes<2>> == 43);
+}
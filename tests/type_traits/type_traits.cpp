@@ -7,7 +7,7 @@
  *
  *
  */
-#include <gtest/gtest.h>
+#include <testing.hpp>
 
 #include <conceptslib/type_traits.hpp>
 
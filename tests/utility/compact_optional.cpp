@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+
+#include <testing.hpp>
+
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+// An 8-byte handle where 0 is never a valid id
+struct Handle
+{
+    std::uint64_t id;
+
+    friend bool operator==(Handle l, Handle r) { return l.id == r.id; }
+    friend bool operator!=(Handle l, Handle r) { return l.id != r.id; }
+    friend bool operator<(Handle l, Handle r) { return l.id < r.id; }
+};
+
+struct HandlePolicy
+{
+    static constexpr Handle empty_value() { return {0}; }
+    static constexpr bool is_empty(Handle h) { return h.id == 0; }
+};
+
+struct NotAPolicy
+{
+    static Handle empty_value();
+};
+
+struct NotEqualityComparable { };
+
+template<class T, class = void>
+constexpr bool has_default_policy = false;
+
+template<class T>
+constexpr bool has_default_policy<
+    T, std::void_t<utility::default_policy_t<T>>> = true;
+
+} // namespace
+
+TEST(CompactOptional, Size)
+{
+    using utility::compact_optional;
+
+    CONCEPT_ASSERT(sizeof(compact_optional<std::uint64_t>) ==
+                   sizeof(std::uint64_t));
+    CONCEPT_ASSERT(sizeof(compact_optional<int>) == sizeof(int));
+    CONCEPT_ASSERT(sizeof(compact_optional<double>) == sizeof(double));
+    CONCEPT_ASSERT(sizeof(compact_optional<float>) == sizeof(float));
+    CONCEPT_ASSERT(sizeof(compact_optional<int*>) == sizeof(int*));
+    CONCEPT_ASSERT(sizeof(compact_optional<Handle, HandlePolicy>) ==
+                   sizeof(Handle));
+
+    CONCEPT_ASSERT(sizeof(std::optional<std::uint64_t>) >
+                   sizeof(compact_optional<std::uint64_t>));
+}
+
+TEST(CompactOptional, Policies)
+{
+    using utility::OptionalPolicy;
+    using utility::sentinel;
+
+    CONCEPT_ASSERT(OptionalPolicy<HandlePolicy, Handle>);
+    CONCEPT_ASSERT(OptionalPolicy<sentinel<int, -1>, int>);
+    CONCEPT_ASSERT(!OptionalPolicy<NotAPolicy, Handle>);
+    CONCEPT_ASSERT(!OptionalPolicy<HandlePolicy, std::string>);
+
+    CONCEPT_ASSERT(has_default_policy<int>);
+    CONCEPT_ASSERT(has_default_policy<unsigned char>);
+    CONCEPT_ASSERT(has_default_policy<double>);
+    CONCEPT_ASSERT(has_default_policy<const char*>);
+    CONCEPT_ASSERT(!has_default_policy<bool>);
+    CONCEPT_ASSERT(!has_default_policy<Handle>);
+    CONCEPT_ASSERT(!has_default_policy<NotEqualityComparable>);
+}
+
+TEST(CompactOptional, Sentinel)
+{
+    utility::compact_optional<int, utility::sentinel<int, -1>> o;
+    EXPECT_FALSE(o.has_value());
+    EXPECT_EQ(o, std::nullopt);
+    EXPECT_EQ(o.value_or(7), 7);
+    EXPECT_THROW(o.value(), std::bad_optional_access);
+
+    o = 3;
+    EXPECT_TRUE(o);
+    EXPECT_EQ(*o, 3);
+    EXPECT_EQ(o.value(), 3);
+
+    o = std::nullopt;
+    EXPECT_FALSE(o);
+
+    o.emplace(-1); // The sentinel itself is the empty state
+    EXPECT_FALSE(o);
+}
+
+TEST(CompactOptional, DefaultPolicies)
+{
+    utility::compact_optional<std::int64_t> i;
+    EXPECT_FALSE(i);
+    i = 0;
+    EXPECT_TRUE(i);
+
+    utility::compact_optional<unsigned> u = 42u;
+    EXPECT_EQ(*u, 42u);
+    u.reset();
+    EXPECT_FALSE(u);
+
+    int x = 0;
+    utility::compact_optional<int*> p;
+    EXPECT_FALSE(p);
+    p = &x;
+    EXPECT_EQ(*p, &x);
+}
+
+TEST(CompactOptional, FloatingPoint)
+{
+    utility::compact_optional<double> d;
+    EXPECT_FALSE(d);
+
+    // Arithmetic NaNs and infinities are values, not the empty state
+    d = std::numeric_limits<double>::quiet_NaN();
+    EXPECT_TRUE(d);
+    EXPECT_TRUE(std::isnan(*d));
+    d = std::numeric_limits<double>::infinity();
+    EXPECT_TRUE(d);
+    d = 0. / std::numeric_limits<double>::infinity();
+    EXPECT_TRUE(d);
+
+    utility::compact_optional<float> f = 1.5f;
+    EXPECT_EQ(*f, 1.5f);
+    f.reset();
+    EXPECT_FALSE(f);
+}
+
+#if SUPPORTS_BUILTIN_BIT_CAST
+TEST(CompactOptional, ConstexprBitPattern)
+{
+    constexpr utility::compact_optional<double> empty;
+    CONCEPT_ASSERT(!empty.has_value());
+    constexpr utility::compact_optional<double> nan =
+        std::numeric_limits<double>::quiet_NaN();
+    CONCEPT_ASSERT(nan.has_value());
+
+    // Three bytes: the pattern is truncated as by memcpy
+    struct rgb { unsigned char r, g, b; };
+    using policy = utility::bit_pattern<rgb, 0xFFFFFFFF>;
+    constexpr rgb white = policy::empty_value();
+    CONCEPT_ASSERT(white.r == 0xFF && white.g == 0xFF && white.b == 0xFF);
+    CONCEPT_ASSERT(policy::is_empty(white));
+    CONCEPT_ASSERT(!policy::is_empty(rgb{0xFF, 0xFF, 0}));
+}
+#endif
+
+TEST(CompactOptional, Comparison)
+{
+    using Optional = utility::compact_optional<Handle, HandlePolicy>;
+
+    const Optional empty;
+    const Optional one = Handle{1};
+    const Optional two = Handle{2};
+
+    EXPECT_EQ(empty, Optional{});
+    EXPECT_EQ(one, Optional{Handle{1}});
+    EXPECT_NE(one, two);
+    EXPECT_NE(empty, one);
+
+    EXPECT_LT(empty, one);
+    EXPECT_LT(one, two);
+    EXPECT_FALSE(empty < empty);
+    EXPECT_GE(two, one);
+    EXPECT_EQ(one->id, 1u);
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <testing.hpp>
+
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+// Entry i of the table of the reflected CRC-32 polynomial
+constexpr std::uint32_t crc32_entry(std::size_t i)
+{
+    auto crc = static_cast<std::uint32_t>(i);
+    for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc >> 1) ^ (crc & 1 ? 0xEDB88320u : 0u);
+    }
+    return crc;
+}
+
+template<class F, class = void>
+constexpr bool can_make_table = false;
+
+template<class F>
+constexpr bool can_make_table<
+    F, std::void_t<decltype(utility::make_table<4>(std::declval<F>()))>> =
+    true;
+
+} // namespace
+
+TEST(UtilityMakeTable, ConstantEvaluation)
+{
+    constexpr auto crc = utility::make_table<256>(crc32_entry);
+    CONCEPT_ASSERT(std::is_same_v<decltype(crc),
+                                  const std::array<std::uint32_t, 256>>);
+    CONCEPT_ASSERT(crc[0] == 0);
+    CONCEPT_ASSERT(crc[1] == 0x77073096u);
+    CONCEPT_ASSERT(crc[255] == 0x2D02EF8Du);
+
+    constexpr auto is_digit = utility::make_table<128>([](std::size_t c) {
+        return c >= '0' && c <= '9';
+    });
+    CONCEPT_ASSERT(is_digit['7'] && !is_digit['a']);
+
+    // CRC-32 of "123456789"
+    std::uint32_t sum = 0xFFFFFFFFu;
+    for (char c: {'1', '2', '3', '4', '5', '6', '7', '8', '9'}) {
+        sum = crc[(sum ^ static_cast<unsigned char>(c)) & 0xFF] ^ (sum >> 8);
+    }
+    EXPECT_EQ(sum ^ 0xFFFFFFFFu, 0xCBF43926u);
+}
+
+TEST(UtilityMakeTable, Constraints)
+{
+    auto by_index = [](std::size_t i) { return i; };
+    auto by_string = [](const char*) { return 0; };
+    CONCEPT_ASSERT(can_make_table<decltype(by_index)>);
+    CONCEPT_ASSERT(!can_make_table<decltype(by_string)>);
+}
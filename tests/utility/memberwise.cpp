@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+
+#include <testing.hpp>
+
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+struct Point
+{
+    int x;
+    int y;
+};
+
+// Padding after tag, and a floating point field
+struct Sample
+{
+    char tag;
+    double value;
+    Point at;
+};
+
+struct Named
+{
+    std::string name;
+    Point at;
+};
+
+// Its operator== only compares the low byte of bits
+struct Flags
+{
+    std::uint32_t bits;
+
+    friend bool operator==(const Flags& a, const Flags& b)
+    { return (a.bits & 0xff) == (b.bits & 0xff); }
+};
+
+// No padding, but a field with its own operator==
+struct Tagged
+{
+    Flags flags;
+    std::uint32_t id;
+};
+
+} // namespace
+
+template<>
+struct std::hash<Flags>
+{
+    std::size_t operator()(const Flags& flags) const noexcept
+    {
+        return std::hash<std::uint32_t>{}(flags.bits & 0xff);
+    }
+};
+
+TEST(UtilityMemberwise, Equal)
+{
+    using utility::memberwise_equal;
+
+    EXPECT_TRUE(memberwise_equal(Point{1, 2}, Point{1, 2}));
+    EXPECT_FALSE(memberwise_equal(Point{1, 2}, Point{1, 3}));
+
+    // Padding bytes are not compared
+    Sample a;
+    Sample b;
+    std::memset(&a, 0x00, sizeof(a));
+    std::memset(&b, 0xff, sizeof(b));
+    a = {'a', 1.5, {1, 2}};
+    b = {'a', 1.5, {1, 2}};
+    EXPECT_TRUE(memberwise_equal(a, b));
+
+    // Floating point fields compare by value
+    EXPECT_TRUE(memberwise_equal(Sample{'a', 0.0, {}}, Sample{'a', -0.0, {}}));
+
+    EXPECT_TRUE(memberwise_equal(Named{"a", {1, 2}}, Named{"a", {1, 2}}));
+    EXPECT_FALSE(memberwise_equal(Named{"a", {1, 2}}, Named{"b", {1, 2}}));
+
+    // Fields with their own operator== are compared with it, not by bytes
+    CONCEPT_ASSERT(std::has_unique_object_representations_v<Tagged>);
+    EXPECT_TRUE(memberwise_equal(Tagged{{0x101}, 7}, Tagged{{0x201}, 7}));
+    EXPECT_FALSE(memberwise_equal(Tagged{{0x101}, 7}, Tagged{{0x102}, 7}));
+}
+
+TEST(UtilityMemberwise, Less)
+{
+    using utility::memberwise_less;
+
+    EXPECT_TRUE(memberwise_less(Point{1, 5}, Point{2, 0}));
+    EXPECT_TRUE(memberwise_less(Point{1, 1}, Point{1, 2}));
+    EXPECT_FALSE(memberwise_less(Point{1, 2}, Point{1, 2}));
+    EXPECT_FALSE(memberwise_less(Point{2, 0}, Point{1, 5}));
+
+    // Byte order would put 256 before 1 on little endian platforms
+    EXPECT_TRUE(memberwise_less(Point{1, 0}, Point{256, 0}));
+
+    // Nested aggregates are ordered memberwise
+    EXPECT_TRUE(memberwise_less(Named{"a", {1, 2}}, Named{"a", {1, 3}}));
+    EXPECT_FALSE(memberwise_less(Named{"b", {0, 0}}, Named{"a", {1, 3}}));
+}
+
+TEST(UtilityMemberwise, Hash)
+{
+    using utility::memberwise_hash;
+
+    EXPECT_EQ(memberwise_hash(Point{1, 2}), memberwise_hash(Point{1, 2}));
+    EXPECT_NE(memberwise_hash(Point{1, 2}), memberwise_hash(Point{2, 1}));
+
+    // Equal values have equal hashes, whatever their padding and signed zeros
+    Sample a;
+    Sample b;
+    std::memset(&a, 0x00, sizeof(a));
+    std::memset(&b, 0xff, sizeof(b));
+    a = {'a', 0.0, {1, 2}};
+    b = {'a', -0.0, {1, 2}};
+    EXPECT_EQ(memberwise_hash(a), memberwise_hash(b));
+
+    std::unordered_set<Named, utility::memberwise_hasher,
+                       utility::memberwise_equal_to> set;
+    set.insert({"a", {1, 2}});
+    set.insert({"a", {1, 2}});
+    set.insert({"b", {1, 2}});
+    EXPECT_EQ(set.size(), 2u);
+
+    // Fields with their own operator== are hashed with their std::hash
+    const Tagged c{{0x101}, 7};
+    const Tagged d{{0x201}, 7};
+    EXPECT_TRUE(utility::memberwise_equal(c, d));
+    EXPECT_EQ(memberwise_hash(c), memberwise_hash(d));
+}
+
+TEST(UtilityMemberwise, Serialize)
+{
+    using utility::serialized_size_v;
+
+    // Padding is not written
+    CONCEPT_ASSERT(serialized_size_v<Point> == sizeof(Point));
+    CONCEPT_ASSERT(serialized_size_v<Sample> ==
+                   sizeof(char) + sizeof(double) + sizeof(Point));
+    CONCEPT_ASSERT(serialized_size_v<std::uint16_t> == 2);
+
+    const Sample sample{'z', 2.5, {-1, 7}};
+    unsigned char buffer[serialized_size_v<Sample>];
+    EXPECT_EQ(utility::serialize(sample, buffer),
+              buffer + serialized_size_v<Sample>);
+
+    Sample copy{};
+    EXPECT_EQ(utility::deserialize(copy, buffer),
+              buffer + serialized_size_v<Sample>);
+    EXPECT_EQ(copy.tag, 'z');
+    EXPECT_EQ(copy.value, 2.5);
+    EXPECT_EQ(copy.at.x, -1);
+    EXPECT_EQ(copy.at.y, 7);
+}
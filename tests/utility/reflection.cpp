@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <testing.hpp>
+
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+struct Empty { };
+
+struct Point
+{
+    int x;
+    int y;
+};
+
+struct Record
+{
+    std::string name;
+    std::optional<int> age;
+    std::vector<double> scores;
+    Point location;
+};
+
+struct Defaults
+{
+    int a = 1;
+    double b = 2.0;
+    char c = 'c';
+};
+
+struct Large
+{
+    int f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15, f16,
+        f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30,
+        f31, f32;
+};
+
+class NotAggregate
+{
+public:
+    NotAggregate(int) { }
+};
+
+} // namespace
+
+TEST(UtilityReflection, FieldCount)
+{
+    using utility::field_count_v;
+
+    CONCEPT_ASSERT(field_count_v<Empty> == 0);
+    CONCEPT_ASSERT(field_count_v<Point> == 2);
+    CONCEPT_ASSERT(field_count_v<Record> == 4);
+    CONCEPT_ASSERT(field_count_v<Defaults> == 3);
+    CONCEPT_ASSERT(field_count_v<Large> == 32);
+
+    CONCEPT_ASSERT(utility::reflectable_v<Record>);
+    CONCEPT_ASSERT(utility::reflectable_v<Large>);
+    CONCEPT_ASSERT(!utility::reflectable_v<NotAggregate>);
+    CONCEPT_ASSERT(!utility::reflectable_v<int>);
+    CONCEPT_ASSERT(!utility::reflectable_v<int[2]>);
+}
+
+TEST(UtilityReflection, FieldAccess)
+{
+    Record r{"ada", 36, {1.0, 2.0}, {3, 4}};
+
+    // Fields in declaration order, as lvalues
+    utility::visit_fields(r, [](std::string& name, std::optional<int>& age,
+                                std::vector<double>& scores, Point& location) {
+        EXPECT_EQ(name, "ada");
+        EXPECT_EQ(age, 36);
+        EXPECT_EQ(scores.size(), 2u);
+        location.x = 5;
+    });
+    EXPECT_EQ(r.location.x, 5);
+
+    auto fields = utility::tie_fields(r);
+    utility::get<0>(fields) = "grace";
+    EXPECT_EQ(r.name, "grace");
+    CONCEPT_ASSERT(std::is_same_v<utility::fields_t<const Point>,
+                                  utility::tuple<const int&, const int&>>);
+
+    Large large{};
+    int sum = 0;
+    int i = 0;
+    utility::for_each_field(large, [&](int& field) { field = ++i; });
+    utility::for_each_field(std::as_const(large),
+                            [&](const int& field) { sum += field; });
+    EXPECT_EQ(large.f32, 32);
+    EXPECT_EQ(sum, 32 * 33 / 2);
+}
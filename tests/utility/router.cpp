@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <string>
+#include <type_traits>
+#include <variant>
+
+#include <testing.hpp>
+
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+struct Ping { int id; };
+
+struct Data { std::string payload; };
+
+struct Shutdown { };
+
+struct OnPing
+{
+    constexpr int operator()(const Ping& p) const { return p.id; }
+};
+
+struct OnData
+{
+    int calls = 0;
+
+    int operator()(const Data& d)
+    {
+        ++calls;
+        return static_cast<int>(d.payload.size());
+    }
+};
+
+struct Fallback
+{
+    template<class T>
+    constexpr int operator()(const T&) const { return -1; }
+};
+
+} // namespace
+
+TEST(UtilityRouter, HandlerIndex)
+{
+    using R = utility::router<OnPing, OnData, Fallback>;
+
+    CONCEPT_ASSERT(R::handler_index<Ping> == 0);
+    CONCEPT_ASSERT(R::handler_index<Data&> == 1);
+    CONCEPT_ASSERT(R::handler_index<Shutdown> == 2);
+    CONCEPT_ASSERT(utility::router<OnPing>::handler_index<Data> == 1);
+}
+
+TEST(UtilityRouter, Route)
+{
+    utility::router route{OnPing{}, OnData{}, Fallback{}};
+
+    EXPECT_EQ(route(Ping{7}), 7);
+    EXPECT_EQ(route(Data{"abc"}), 3);
+    EXPECT_EQ(route(Shutdown{}), -1);
+
+    using Message = std::variant<Ping, Data, Shutdown>;
+    Message messages[] = {Ping{2}, Data{"hello"}, Shutdown{}, Data{""}};
+    int results[4];
+    for (int i = 0; i < 4; ++i) {
+        results[i] = route(messages[i]);
+    }
+    EXPECT_EQ(results[0], 2);
+    EXPECT_EQ(results[1], 5);
+    EXPECT_EQ(results[2], -1);
+    EXPECT_EQ(results[3], 0);
+}
+
+TEST(UtilityRouter, Const)
+{
+    // A const router only calls handlers which are invocable when const:
+    // data goes to the fallback
+    const utility::router route{OnPing{}, OnData{}, Fallback{}};
+    using R = std::remove_const_t<decltype(route)>;
+    CONCEPT_ASSERT(std::is_same_v<R::handlers,
+                                  traits::list<OnPing, OnData, Fallback>>);
+
+    EXPECT_EQ(route(Data{"abc"}), -1);
+    EXPECT_EQ(route(std::variant<Ping, Data>{Ping{4}}), 4);
+}
+
+TEST(UtilityRouter, Constexpr)
+{
+    constexpr utility::router route{OnPing{}, Fallback{}};
+    constexpr int id = route(std::variant<Ping, Shutdown>{Ping{9}});
+    CONCEPT_ASSERT(id == 9);
+}
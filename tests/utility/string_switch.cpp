@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <string>
+#include <string_view>
+
+#include <testing.hpp>
+
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+constexpr auto command = utility::make_string_switch(
+    {"get", "set", "del", "incr", "decr", "expire"});
+
+int run(std::string_view name)
+{
+    switch (command(name)) {
+    case command.case_("get"): return 1;
+    case command.case_("set"): return 2;
+    case command.case_("del"): return 3;
+    case command.case_("incr"):
+    case command.case_("decr"): return 4;
+    case command.none: return 0;
+    default: return -1;
+    }
+}
+
+} // namespace
+
+TEST(UtilityStringSwitch, Cases)
+{
+    CONCEPT_ASSERT(command.none == 6);
+    CONCEPT_ASSERT(command("expire") == 5);
+    CONCEPT_ASSERT(command("EXPIRE") == command.none);
+
+    EXPECT_EQ(run("get"), 1);
+    EXPECT_EQ(run("set"), 2);
+    EXPECT_EQ(run(std::string("del")), 3);
+    EXPECT_EQ(run("decr"), 4);
+    EXPECT_EQ(run("expire"), -1);
+    EXPECT_EQ(run("flush"), 0);
+    EXPECT_EQ(run(""), 0);
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <testing.hpp>
+
+#include <conceptslib/concepts.hpp>
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+struct Empty { };
+
+struct OtherEmpty { };
+
+struct Final final { };
+
+struct Unordered
+{
+    friend bool operator==(Unordered, Unordered) { return true; }
+    friend bool operator!=(Unordered, Unordered) { return false; }
+};
+
+template<class T, class U, class = void>
+constexpr bool has_less = false;
+
+template<class T, class U>
+constexpr bool has_less<T, U, std::void_t<decltype(std::declval<T>() <
+                                                   std::declval<U>())>> =
+    true;
+
+template<class T, class U, class = void>
+constexpr bool has_equal = false;
+
+template<class T, class U>
+constexpr bool has_equal<T, U, std::void_t<decltype(std::declval<T>() ==
+                                                    std::declval<U>())>> =
+    true;
+
+} // namespace
+
+TEST(UtilityTuple, Layout)
+{
+    using utility::tuple;
+
+    CONCEPT_ASSERT(sizeof(tuple<int, Empty>) == sizeof(int));
+    CONCEPT_ASSERT(sizeof(tuple<Empty, int, OtherEmpty>) == sizeof(int));
+    CONCEPT_ASSERT(sizeof(tuple<char, int, char>) == 3 * sizeof(int));
+    CONCEPT_ASSERT(sizeof(tuple<Final, int>) > sizeof(int));
+    CONCEPT_ASSERT(std::is_empty_v<tuple<>>);
+    CONCEPT_ASSERT(std::is_trivially_copyable_v<tuple<int, double, Empty>>);
+    CONCEPT_ASSERT(!std::is_trivially_copyable_v<tuple<int, std::string>>);
+
+    // Nested empty tuples are stored, so their leaves stay unambiguous
+    tuple<Empty, tuple<Empty>> nested;
+    EXPECT_EQ(&utility::get<0>(utility::get<1>(nested)),
+              &utility::get<0>(utility::get<1>(nested)));
+    EXPECT_NE(static_cast<void*>(&utility::get<1>(nested)),
+              static_cast<void*>(&nested));
+}
+
+TEST(UtilityTuple, Protocol)
+{
+    using T = utility::tuple<int, const double, std::string&>;
+
+    CONCEPT_ASSERT(std::tuple_size_v<T> == 3);
+    CONCEPT_ASSERT(std::is_same_v<std::tuple_element_t<0, T>, int>);
+    CONCEPT_ASSERT(std::is_same_v<std::tuple_element_t<1, T>, const double>);
+    CONCEPT_ASSERT(std::is_same_v<std::tuple_element_t<2, T>, std::string&>);
+
+    std::string s = "s";
+    T t(1, 2.5, s);
+    CONCEPT_ASSERT(std::is_same_v<decltype(utility::get<0>(t)), int&>);
+    CONCEPT_ASSERT(std::is_same_v<decltype(utility::get<0>(std::move(t)))
+                                 ,int&&>);
+    CONCEPT_ASSERT(std::is_same_v<decltype(utility::get<2>(std::move(t)))
+                                 ,std::string&>);
+    CONCEPT_ASSERT(std::is_same_v<decltype(utility::get<2>(std::as_const(t)))
+                                 ,std::string&>);
+    CONCEPT_ASSERT(std::is_same_v<decltype(utility::get<0>(std::as_const(t)))
+                                 ,const int&>);
+
+    auto& [i, d, str] = t;
+    EXPECT_EQ(i, 1);
+    EXPECT_EQ(d, 2.5);
+    str += "t";
+    EXPECT_EQ(s, "st");
+
+    EXPECT_EQ(utility::apply([](int a, double b, const std::string& c) {
+        return a + b + static_cast<double>(c.size());
+    }, t), 5.5);
+}
+
+TEST(UtilityTuple, Construction)
+{
+    using utility::tuple;
+
+    CONCEPT_ASSERT(std::is_default_constructible_v<tuple<int, std::string>>);
+    CONCEPT_ASSERT(!std::is_default_constructible_v<tuple<int&>>);
+    CONCEPT_ASSERT(!std::is_constructible_v<tuple<int, int>, int>);
+    CONCEPT_ASSERT(concepts::Regular<tuple<int, std::string>>);
+    CONCEPT_ASSERT(concepts::Movable<tuple<std::unique_ptr<int>>>);
+    CONCEPT_ASSERT(!concepts::Copyable<tuple<std::unique_ptr<int>>>);
+
+    const tuple<int, std::string> t{};
+    EXPECT_EQ(utility::get<0>(t), 0);
+    EXPECT_TRUE(utility::get<1>(t).empty());
+
+    // Converting constructor and deduction guide
+    tuple<long, std::string> converted = tuple<int, const char*>(3, "abc");
+    EXPECT_EQ(utility::get<0>(converted), 3);
+    EXPECT_EQ(utility::get<1>(converted), "abc");
+    CONCEPT_ASSERT(std::is_same_v<decltype(tuple(1, 2.)), tuple<int, double>>);
+
+    auto made = utility::make_tuple(1, std::ref(converted));
+    CONCEPT_ASSERT(std::is_same_v<decltype(made)
+                                 ,tuple<int, tuple<long, std::string>&>>);
+
+    // A tuple of one tuple is not confused with the copy constructor
+    tuple<tuple<int>> nested(tuple<int>(4));
+    EXPECT_EQ(utility::get<0>(utility::get<0>(nested)), 4);
+
+    auto p = std::make_unique<int>(5);
+    tuple<std::unique_ptr<int>> owner(std::move(p));
+    auto moved = std::move(owner);
+    EXPECT_EQ(*utility::get<0>(moved), 5);
+
+    // Tuples of rvalue references are moved but not copied, as std::tuple
+    CONCEPT_ASSERT(std::is_move_constructible_v<tuple<int&&>>);
+    CONCEPT_ASSERT(!std::is_copy_constructible_v<tuple<int&&>>);
+    CONCEPT_ASSERT(std::is_move_constructible_v<std::tuple<int&&>>);
+    std::string s = "forwarded";
+    int x = 6;
+    auto forwarded = utility::forward_as_tuple(std::move(s), x);
+    auto moved_refs = std::move(forwarded);
+    EXPECT_EQ(utility::get<0>(moved_refs), "forwarded");
+    EXPECT_EQ(&utility::get<1>(moved_refs), &x);
+}
+
+TEST(UtilityTuple, Assignment)
+{
+    int a = 0;
+    std::string b;
+    utility::tie(a, b) = utility::make_tuple(1, "one");
+    EXPECT_EQ(a, 1);
+    EXPECT_EQ(b, "one");
+
+    utility::tuple<int, std::string> t(2, "two");
+    utility::tuple<int, std::string> u;
+    u = t;
+    EXPECT_EQ(u, t);
+
+    utility::tie(a, b) = std::move(t);
+    EXPECT_EQ(a, 2);
+    EXPECT_EQ(b, "two");
+
+    utility::tuple<int, std::string> v(3, "three");
+    swap(u, v);
+    EXPECT_EQ(utility::get<0>(u), 3);
+    EXPECT_EQ(utility::get<1>(v), "two");
+}
+
+TEST(UtilityTuple, Comparison)
+{
+    using utility::tuple;
+
+    CONCEPT_ASSERT(concepts::StrictTotallyOrdered<tuple<int, std::string>>);
+    CONCEPT_ASSERT(has_equal<tuple<Unordered>, tuple<Unordered>>);
+    CONCEPT_ASSERT(!has_less<tuple<Unordered>, tuple<Unordered>>);
+    CONCEPT_ASSERT(!has_equal<tuple<Empty>, tuple<Empty>>);
+
+    using T = tuple<int, std::string, double>;
+    const T a(1, "b", 2.);
+    EXPECT_EQ(a, T(1, "b", 2.));
+    EXPECT_NE(a, T(1, "b", 3.));
+    EXPECT_LT(a, T(2, "a", 0.));
+    EXPECT_LT(a, T(1, "c", 0.));
+    EXPECT_LT(a, T(1, "b", 3.));
+    EXPECT_FALSE(a < a);
+    EXPECT_LE(a, a);
+    EXPECT_GT(T(1, "b", 3.), a);
+    EXPECT_GE(a, T(0, "z", 9.));
+}
+
+TEST(UtilityTuple, CommonReference)
+{
+    using traits::common_reference_t;
+    using utility::tuple;
+
+    CONCEPT_ASSERT(std::is_same_v<common_reference_t<tuple<int>, tuple<long>>
+                                 ,tuple<long>>);
+    CONCEPT_ASSERT(std::is_same_v<
+        common_reference_t<tuple<int&>, tuple<const int&>>,
+        tuple<const int&>>);
+    CONCEPT_ASSERT(std::is_same_v<
+        common_reference_t<tuple<int&, double>, tuple<int, double>&>,
+        tuple<int&, double>>);
+    CONCEPT_ASSERT(std::is_same_v<
+        common_reference_t<const tuple<int>&, tuple<int&>>,
+        tuple<const int&>>);
+
+    // Different sizes or elements without a common reference
+    CONCEPT_ASSERT(!traits::is_detected_v<common_reference_t
+                                         ,tuple<int>, tuple<int, int>>);
+    CONCEPT_ASSERT(!traits::is_detected_v<common_reference_t
+                                         ,tuple<int>, tuple<std::string>>);
+
+    CONCEPT_ASSERT(concepts::CommonReference<tuple<int&>, tuple<int>>);
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <string>
+#include <vector>
+
+#include <testing.hpp>
+
+#include <conceptslib/utility.hpp>
+
+namespace plugins
+{
+struct Audio { };
+
+template<class T>
+struct Filter { };
+
+} // namespace plugins
+
+TEST(UtilityTypeId, TypeName)
+{
+    using utility::type_name;
+
+    CONCEPT_ASSERT(type_name<int>() == "int");
+    CONCEPT_ASSERT(type_name<plugins::Audio>() == "plugins::Audio");
+    EXPECT_EQ(type_name<const int&>(), "const int&");
+    EXPECT_EQ(type_name<plugins::Filter<plugins::Audio>>(),
+              "plugins::Filter<plugins::Audio>");
+}
+
+TEST(UtilityTypeId, Identifiers)
+{
+    using utility::type_id_v;
+
+    // Constant expressions, usable as case labels
+    constexpr utility::type_id_t id = type_id_v<plugins::Audio>;
+    switch (id) {
+    case type_id_v<int>: FAIL(); break;
+    case type_id_v<plugins::Audio>: SUCCEED(); break;
+    default: FAIL();
+    }
+
+    CONCEPT_ASSERT(type_id_v<int> != type_id_v<long>);
+    CONCEPT_ASSERT(type_id_v<int> != type_id_v<const int>);
+    CONCEPT_ASSERT(type_id_v<int> != type_id_v<int&>);
+    CONCEPT_ASSERT(type_id_v<plugins::Filter<int>> !=
+                   type_id_v<plugins::Filter<long>>);
+    CONCEPT_ASSERT(type_id_v<std::string> == type_id_v<std::string>);
+}
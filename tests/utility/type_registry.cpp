@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <array>
+#include <string>
+#include <utility>
+
+#include <testing.hpp>
+
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+template<int N>
+struct Plugin { };
+
+template<class Registry, int... Ns>
+void expect_indices(std::integer_sequence<int, Ns...>)
+{
+    const utility::type_id_t ids[] = {utility::type_id_v<Plugin<Ns>>...};
+    for (std::size_t i = 0; i < sizeof...(Ns); ++i) {
+        EXPECT_EQ(Registry::index_of(ids[i]), i);
+    }
+}
+
+} // namespace
+
+TEST(UtilityTypeRegistry, IndexOf)
+{
+    using Registry = utility::type_registry<int, std::string, double, char>;
+
+    CONCEPT_ASSERT(Registry::size() == 4);
+    CONCEPT_ASSERT(Registry::index_of<int>() == 0);
+    CONCEPT_ASSERT(Registry::index_of<std::string>() == 1);
+    CONCEPT_ASSERT(Registry::index_of<double>() == 2);
+    CONCEPT_ASSERT(Registry::index_of<char>() == 3);
+    CONCEPT_ASSERT(Registry::index_of<long>() == Registry::npos);
+    CONCEPT_ASSERT(Registry::contains<char>());
+    CONCEPT_ASSERT(!Registry::contains<const char>());
+
+    EXPECT_EQ(Registry::index_of(utility::type_id_v<double>), 2u);
+    EXPECT_FALSE(Registry::contains(0));
+
+    using Empty = utility::type_registry<>;
+    CONCEPT_ASSERT(Empty::index_of<int>() == Empty::npos);
+}
+
+TEST(UtilityTypeRegistry, EverySize)
+{
+    expect_indices<utility::type_registry<Plugin<0>>>(
+        std::make_integer_sequence<int, 1>{});
+    expect_indices<utility::type_registry<Plugin<0>, Plugin<1>, Plugin<2>>>(
+        std::make_integer_sequence<int, 3>{});
+    expect_indices<utility::type_registry<Plugin<0>, Plugin<1>, Plugin<2>,
+                                          Plugin<3>, Plugin<4>, Plugin<5>,
+                                          Plugin<6>>>(
+        std::make_integer_sequence<int, 7>{});
+}
+
+TEST(UtilityTypeRegistry, Handlers)
+{
+    using Registry = utility::type_registry<int, double, std::string>;
+
+    constexpr std::array<int (*)(), Registry::size()> handlers = {{
+        [] { return 1; },
+        [] { return 2; },
+        [] { return 3; },
+    }};
+
+    EXPECT_EQ(handlers[Registry::index_of(utility::type_id_v<double>)](), 2);
+    EXPECT_EQ(handlers[Registry::index_of(utility::type_id_v<std::string>)](),
+              3);
+}
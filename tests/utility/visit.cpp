@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) Nuno Alves de Sousa 2019
+ *
+ * Use, modification and distribution is subject to the Boost Software License,
+ * Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+ * http://www.boost.org/LICENSE_1_0.txt)
+ */
+#include <string>
+#include <type_traits>
+#include <variant>
+
+#include <testing.hpp>
+
+#include <conceptslib/utility.hpp>
+
+namespace
+{
+struct Base
+{
+    virtual ~Base() = default;
+    virtual int id() const { return 0; }
+};
+
+struct Derived: Base
+{
+    int id() const override { return 1; }
+};
+
+struct Overloaded
+{
+    int operator()(int i) const { return i; }
+    long operator()(long l) const { return l * 10; }
+    double operator()(double d) const { return d; }
+};
+
+struct OnlyInt
+{
+    void operator()(int) const { }
+};
+
+struct Throws
+{
+    Throws() = default;
+    Throws(const Throws&) { throw 0; }
+    Throws& operator=(const Throws&) = default;
+};
+
+template<class F, class... Vs>
+constexpr bool can_visit =
+    !std::is_same_v<traits::detected_t<utility::detail::visit_result_t
+                                      ,F, Vs...>
+                   ,traits::nonesuch>;
+
+} // namespace
+
+TEST(UtilityVisit, ResultType)
+{
+    using V = std::variant<int, long, double>;
+    using utility::detail::visit_result_t;
+
+    CONCEPT_ASSERT(std::is_same_v<visit_result_t<Overloaded, V&>, double>);
+
+    // References to a common base are preserved
+    auto self = [](auto& x) -> auto& { return x; };
+    using B = std::variant<Base, Derived>;
+    CONCEPT_ASSERT(std::is_same_v<visit_result_t<decltype(self), B&>, Base&>);
+    CONCEPT_ASSERT(std::is_same_v<visit_result_t<decltype(self), const B&>
+                                 ,const Base&>);
+
+    // Every alternative must be invocable
+    CONCEPT_ASSERT(can_visit<OnlyInt, std::variant<int>&>);
+    CONCEPT_ASSERT(!can_visit<OnlyInt, std::variant<int, std::string>&>);
+
+    // The results must have a common reference
+    auto mixed = [](auto x) {
+        if constexpr (std::is_same_v<decltype(x), int>) {
+            return std::string{};
+        } else {
+            return 0;
+        }
+    };
+    CONCEPT_ASSERT(!can_visit<decltype(mixed), std::variant<int, long>&>);
+}
+
+TEST(UtilityVisit, Single)
+{
+    std::variant<int, long, double> v = 2L;
+    EXPECT_EQ(utility::visit(Overloaded{}, v), 20.);
+    v = 1.5;
+    EXPECT_EQ(utility::visit(Overloaded{}, v), 1.5);
+    v = 3;
+    EXPECT_EQ(utility::visit(Overloaded{}, v), 3.);
+
+    std::variant<Base, Derived> b = Derived{};
+    auto self = [](auto& x) -> auto& { return x; };
+    EXPECT_EQ(utility::visit(self, b).id(), 1);
+}
+
+TEST(UtilityVisit, ManyAlternatives)
+{
+    // More alternatives than cases of a single switch
+    using V = std::variant<char, short, int, long, long long, unsigned char,
+                           unsigned short, unsigned, unsigned long, float>;
+    using uchar = unsigned char;
+    using ushort = unsigned short;
+    const V values[] = {char{}, short{}, 0, 0L, 0LL, uchar{}, ushort{}, 0U, 0UL,
+                        0.f};
+    auto size = [](auto x) { return sizeof(x); };
+    for (const auto& v: values) {
+        EXPECT_EQ(utility::visit(size, v), std::visit(size, v));
+    }
+}
+
+TEST(UtilityVisit, Multiple)
+{
+    std::variant<int, std::string> a = 2;
+    std::variant<int, double, std::string> b = 3.5;
+    auto describe = [](const auto& x, const auto& y) {
+        return std::string(typeid(x).name()) + typeid(y).name();
+    };
+
+    for (int i = 0; i < 2; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            if (i == 1) { a = "a"; }
+            if (j == 0) { b = 1; }
+            if (j == 1) { b = 1.; }
+            if (j == 2) { b = "b"; }
+            EXPECT_EQ(utility::visit(describe, a, b),
+                      std::visit(describe, a, b));
+        }
+    }
+
+    // Rvalue variants pass rvalue alternatives
+    auto moved = [](auto&& x, auto&&) {
+        return std::is_rvalue_reference_v<decltype(x)>;
+    };
+    EXPECT_TRUE(utility::visit(moved, std::move(a), b));
+}
+
+TEST(UtilityVisit, Table)
+{
+    // 9^3 combinations of three variants
+    using V = std::variant<char, short, int, long, unsigned char,
+                           unsigned short, unsigned, unsigned long, float>;
+    auto sizes = [](auto x, auto y, auto z) {
+        return sizeof(x) * 100 + sizeof(y) * 10 + sizeof(z);
+    };
+    const V values[] = {char{}, 0, 0UL, 0.f};
+    for (const auto& x: values) {
+        for (const auto& y: values) {
+            for (const auto& z: values) {
+                EXPECT_EQ(utility::visit(sizes, x, y, z),
+                          std::visit(sizes, x, y, z));
+            }
+        }
+    }
+}
+
+TEST(UtilityVisit, Valueless)
+{
+    std::variant<int, Throws> v;
+    try {
+        v = Throws{};
+    } catch (int) { }
+    ASSERT_TRUE(v.valueless_by_exception());
+    EXPECT_THROW(utility::visit([](auto&) { }, v), std::bad_variant_access);
+
+    std::variant<int> w;
+    EXPECT_THROW(utility::visit([](auto&, auto&) { }, w, v),
+                 std::bad_variant_access);
+}